@@ -185,6 +185,24 @@ int main(int, char**)
 		{
 			ImGui::Begin("Stats");
 			ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+			gObj<IReportDistanceFields> asDistanceFields = technique.Dynamic_Cast<IReportDistanceFields>();
+			if (asDistanceFields) {
+				DistanceFieldSelection* selections;
+				int count;
+				asDistanceFields->getDistanceFields(selections, count);
+				long long totalMemory = 0;
+				for (int i = 0; i < count; i++)
+				{
+					ImGui::Text("DF %d: %d tris, %dx%dx%d, cell %.4f, %.1f MB%s", i, selections[i].Triangles,
+						selections[i].Size.x, selections[i].Size.y, selections[i].Size.z,
+						selections[i].CellSize, selections[i].Memory / (1024.0 * 1024.0),
+						selections[i].FromCache ? " (cached)" : "");
+					if (selections[i].MeasuredRays > 0)
+						ImGui::Text("    steps %.2f (field) %.2f (pyramid)", selections[i].FlatSteps, selections[i].PyramidSteps);
+					totalMemory += selections[i].Memory;
+				}
+				ImGui::Text("Distance fields %.1f MB", totalMemory / (1024.0 * 1024.0));
+			}
 			ImGui::End();
 		}
 #endif
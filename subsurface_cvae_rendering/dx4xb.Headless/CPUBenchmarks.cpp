@@ -0,0 +1,224 @@
+// CPUBenchmarks.cpp : Prints the single thread throughput of the CPU tools of dx4xb.Techniques.
+// Usage: CPUBenchmarks [benchmark...] (all benchmarks without arguments). Not a test, the accuracy is checked by CPUChecks.
+
+#include "Techniques/CPU/TriangleBatch.h"
+#include "Techniques/CPU/CounterRandom.h"
+#include "Techniques/CPU/LowDiscrepancy.h"
+#include "Techniques/CPU/PhaseSampling.h"
+#include "Techniques/CPU/MLP.h"
+#include "Techniques/CVAEPathtracing/CVAEModelsCheck.h"
+#include "Techniques/CVAEPathtracing/CVAEStaticModels.h"
+#include "Techniques/CVAEPathtracing/TabularSampling.h"
+#include "Techniques/CVAEPathtracing/TableBuilder.h"
+#include "Techniques/CVAEPathtracing/DistanceFieldBuilder.h"
+#include "Techniques/CVAEPathtracing/DistanceFieldQuery.h"
+#include "Techniques/CVAEPathtracing/DistanceFieldPyramid.h"
+
+// Folder of the networks (CVAEScatteringModel.bin and CVAEScatteringModelX.bin written by compiling2Binary.py)
+#ifndef CVAE_MODELS_DIRECTORY
+#define CVAE_MODELS_DIRECTORY "../dx4xb.Techniques/Techniques/CVAEPathtracing/"
+#endif
+
+static bool LoadModels(CVAEModels& models) {
+	if (models.Load(CVAE_MODELS_DIRECTORY "CVAEScatteringModel.bin"))
+		return true;
+	printf("  can not load the networks of " CVAE_MODELS_DIRECTORY "CVAEScatteringModel.bin\n");
+	return false;
+}
+
+static void BenchmarkTriangles() {
+	TriangleBatchBenchmark report = BenchmarkTriangleBatch();
+	printf("  width %d: %.2f ns scalar, %.2f ns batch (x%.1f) per distance\n",
+		report.Width, report.ScalarNanoseconds, report.BatchNanoseconds, report.Speedup);
+}
+
+static void BenchmarkRandoms() {
+	RandomCostReport report = MeasureRandomCost();
+	printf("  %d numbers per ray: %.1f ns HybridTaus, %.1f ns CounterRandom, %.1f ns CounterRandomBatch\n",
+		report.NumbersPerRay, report.HybridTausNanoseconds, report.CounterNanoseconds, report.CounterBatchNanoseconds);
+	printf("  skipping 1000 numbers: %.1f ns HybridTaus, %.1f ns CounterRandom\n",
+		report.HybridTausSkipNanoseconds, report.CounterSkipNanoseconds);
+
+	SamplerConvergenceReport convergence = MeasureSamplerConvergence();
+	printf("  convergence images: %.0f ms Random, %.0f ms OwenSobol, %.0f ms BlueNoiseSobol\n",
+		convergence.Milliseconds[0], convergence.Milliseconds[1], convergence.Milliseconds[2]);
+}
+
+static void BenchmarkPhase() {
+	PhaseSamplingReport report = BenchmarkPhaseSampling();
+	printf("  g %.3f: %.2f ns scalar, %.2f ns fast scalar, %.2f ns batch, %.2f ns table per direction\n",
+		report.G, report.ScalarNanoseconds, report.FastScalarNanoseconds, report.BatchNanoseconds, report.TableNanoseconds);
+}
+
+static void BenchmarkMath() {
+	BatchMathReport report = MeasureBatchMath();
+	const BatchMathError* functions[] = { report.Exp, report.Log, report.Softplus, report.Sigmoid, report.Tanh };
+	const char* names[] = { "exp", "log", "softplus", "sigmoid", "tanh" };
+	printf("  width %d, Mvalues/s of Reference, Accurate and Fast\n", report.Width);
+	for (int f = 0; f < 5; f++)
+		printf("  %-10s %8.1f %8.1f %8.1f\n", names[f], functions[f][0].ValuesPerSecond / 1e6f,
+			functions[f][1].ValuesPerSecond / 1e6f, functions[f][2].ValuesPerSecond / 1e6f);
+}
+
+static void BenchmarkNetworks() {
+	CVAEModels models;
+	if (!LoadModels(models))
+		return;
+	const MLPModel* networks[] = { &models.Len, &models.Path, &models.Scat };
+	const char* names[] = { "len", "path", "scat" };
+	StaticCVAEModelsBenchmark statics = BenchmarkStaticCVAEModels(false);
+	const StaticMLPBenchmark* staticNetworks[] = { &statics.Len, &statics.Path, &statics.Scat };
+	printf("  Ksamples/s of MLPModel scalar and batch, StaticMLP scalar and batch\n");
+	for (int n = 0; n < 3; n++)
+	{
+		MLPBatchBenchmark batch = BenchmarkMLPBatch(*networks[n], 1024);
+		printf("  %-10s %8.1f %8.1f %8.1f %8.1f\n", names[n], batch.ScalarSamplesPerSecond / 1e3f, batch.BatchSamplesPerSecond / 1e3f,
+			staticNetworks[n]->StaticSamplesPerSecond / 1e3f, staticNetworks[n]->StaticBatchSamplesPerSecond / 1e3f);
+	}
+
+	CVAEPrecisionReport half = CheckCVAEPrecision(models, MLPPrecision::Float16);
+	CVAEPrecisionReport bytes = CheckCVAEPrecision(models, MLPPrecision::Int8);
+	CVAEPrecisionReport fast = CheckCVAEMathMode(models, MLPMathMode::Fast);
+	printf("  Ksamples/s of the three networks: %.1f fp32, %.1f fp16, %.1f int8, %.1f fast activations\n",
+		half.ReferenceSamplesPerSecond / 1e3f, half.SamplesPerSecond / 1e3f, bytes.SamplesPerSecond / 1e3f, fast.SamplesPerSecond / 1e3f);
+}
+
+static void BenchmarkSamplers() {
+	CVAEModels models;
+	if (!LoadModels(models))
+		return;
+	CVAEBatchSamplingBenchmark cvae = BenchmarkCVAEBatchSampling(models, true);
+	printf("  CVAE: %.1f Kexits/s scalar, %.1f Kexits/s batch (exit ratio %.3f), %.1f M latents/s scalar, %.1f M latents/s batch\n",
+		cvae.ScalarExitsPerSecond / 1e3f, cvae.BatchExitsPerSecond / 1e3f, cvae.ExitRatio,
+		cvae.ScalarLatentsPerSecond / 1e6f, cvae.BatchLatentsPerSecond / 1e6f);
+
+	SphereSamplerAccuracy walks = CompareCVAESampler(models, 0.875f, 0.999f, 8);
+	printf("  g 0.875, phi 0.999, r 8: %.0f ns per CVAE sample, %.0f ns per walk\n",
+		walks.NanosecondsPerSample, walks.ReferenceNanosecondsPerSample);
+
+	// tables of the resolution of STFXTechnique would take hours, a reduced build shows the cost of the searches
+	const unsigned int bins[] = { 16, 8, 32, 16, 8, 8 };
+	TableBuildSettings settings = { TABULAR_METHOD_STFX, { bins[0], bins[1], bins[2], bins[3], bins[4], bins[5] }, 1 << 14, 1 };
+	TabularFile file;
+	TabularSampler sampler;
+	if (!BuildTables("stfx_benchmark.bin", settings) ||
+		!ConvertSTFXTables("stfx_benchmark.bin", "stfx_benchmark.tab", TABULAR_ENCODING_FLOAT32, bins) ||
+		!file.Open("stfx_benchmark.tab") || !sampler.Bind(file))
+	{
+		printf("  can not build the tables stfx_benchmark.tab\n");
+		return;
+	}
+	TabularSamplingBenchmark tabular = BenchmarkTabularSampling(sampler);
+	printf("  STFX tables: %.1f Ksamples/s scalar, %.1f Ksamples/s batch (exit ratio %.3f)\n",
+		tabular.ScalarSamplesPerSecond / 1e3f, tabular.BatchSamplesPerSecond / 1e3f, tabular.ExitRatio);
+	SphereSamplerAccuracy tables = CompareTabularSampler(sampler, 0.875f, 0.999f, 8);
+	printf("  g 0.875, phi 0.999, r 8: %.0f ns per table sample\n", tables.NanosecondsPerSample);
+
+	TabularFile aliases;
+	if (!ConvertToAliasTables(file, "stfx_benchmark_alias.tab") || !aliases.Open("stfx_benchmark_alias.tab"))
+	{
+		printf("  can not write the alias tables stfx_benchmark_alias.tab\n");
+		return;
+	}
+	AliasSamplingReport alias = CompareAliasTable(*file.Find("CDF_XW"), *aliases.Find("CDF_XW"));
+	printf("  CDF_XW: %.1f Msamples/s alias, %.1f Msamples/s cdf search\n",
+		alias.SamplesPerSecond / 1e6f, alias.ReferenceSamplesPerSecond / 1e6f);
+
+	// stored sizes of the encodings
+	for (unsigned int encoding : { TABULAR_ENCODING_UNORM16, TABULAR_ENCODING_UNORM16_DELTA_RANS })
+	{
+		TabularFile encoded;
+		if (!ConvertSTFXTables("stfx_benchmark.bin", "stfx_benchmark_encoded.tab", encoding, bins) || !encoded.Open("stfx_benchmark_encoded.tab"))
+		{
+			printf("  can not write the tables stfx_benchmark_encoded.tab\n");
+			return;
+		}
+		for (int t = 0; t < encoded.TableCount(); t++)
+		{
+			const TabularTable& table = encoded.Table(t);
+			TabularEncodingReport report = CompareTabularTable(table, file.Table(t).Values(), 1 << 16);
+			printf("  %s %s: %llu bytes, %.2fx smaller than floats\n", table.Name(),
+				encoding == TABULAR_ENCODING_UNORM16 ? "unorm16" : "unorm16 deltas", report.StoredBytes, report.CompressionRatio);
+		}
+	}
+}
+
+static void BenchmarkDistanceFields() {
+	// UV sphere of radius 1 in a 64^3 grid with a margin of 4 cells
+	EllipsoidMesh sphere(float3(1, 1, 1));
+	const int resolution = 64;
+	float4x4 toGrid = mul(Transforms::Translate(1, 1, 1), Transforms::Scale(float3(1, 1, 1) * ((resolution - 8) * 0.5f)));
+	toGrid = mul(toGrid, Transforms::Translate(4, 4, 4));
+	int3 size = int3(resolution, resolution, resolution);
+
+	DistanceFieldBuilder builder;
+	float buildMilliseconds = builder.Build(sphere.Positions, sphere.Indices, sphere.TriangleCount, toGrid, size);
+	printf("  %d triangles in %dx%dx%d: %.1f ms full build\n", sphere.TriangleCount, size.x, size.y, size.z, buildMilliseconds);
+
+	DistanceFieldQueryBenchmark queries = BenchmarkDistanceFieldQueries(DistanceFieldQuery(builder.Field, size));
+	printf("  Mqueries/s random, coherent: nearest %.1f %.1f, trilinear %.1f %.1f, nearest8 %.1f %.1f, trilinear8 %.1f %.1f\n",
+		queries.NearestRandom, queries.NearestCoherent, queries.TrilinearRandom, queries.TrilinearCoherent,
+		queries.Nearest8Random, queries.Nearest8Coherent, queries.Trilinear8Random, queries.Trilinear8Coherent);
+
+	DistanceFieldPyramid pyramid;
+	pyramid.Build(builder.Field, size);
+	DistanceFieldStepStatistics steps = MeasureSphereTracingSteps(pyramid);
+	printf("  %d rays: %.2f steps flat, %.2f steps pyramid\n", steps.Rays, steps.FlatSteps, steps.PyramidSteps);
+
+	DistanceFieldDeformationBenchmark deformation = BenchmarkLocalDeformation(sphere.Positions, sphere.VertexCount,
+		sphere.Indices, sphere.TriangleCount, toGrid, size, 0.2f, 0.1f);
+	printf("  %d edits: %.2f ms per update (%.0f triangles, %.0f recomputed, %.0f clamped, %.0f spread cells)\n",
+		deformation.Edits, deformation.UpdateMilliseconds, deformation.ChangedTriangles,
+		deformation.RecomputedCells, deformation.ClampedCells, deformation.SpreadCells);
+
+	// step counts of the anisotropic grids chosen by SphereTracingBase (MeasurePyramidSteps)
+	EllipsoidMesh ellipsoid(float3(1, 0.55f, 0.3f));
+	for (int r : { 45, 100, 181 })
+	{
+		float4x4 ellipsoidToGrid = ellipsoid.GridTransform(r, size);
+		builder.Build(ellipsoid.Positions, ellipsoid.Indices, ellipsoid.TriangleCount, ellipsoidToGrid, size);
+		pyramid.Build(builder.Field, size);
+		steps = MeasureSphereTracingSteps(pyramid);
+		printf("  ellipsoid in %dx%dx%d, %d rays: %.2f steps flat, %.2f steps pyramid\n",
+			size.x, size.y, size.z, steps.Rays, steps.FlatSteps, steps.PyramidSteps);
+	}
+}
+
+struct Benchmark {
+	const char* Name;
+	void (*Run)();
+};
+
+static const Benchmark benchmarks[] = {
+	{ "triangle_batch", BenchmarkTriangles },
+	{ "randoms", BenchmarkRandoms },
+	{ "phase_sampling", BenchmarkPhase },
+	{ "batch_math", BenchmarkMath },
+	{ "networks", BenchmarkNetworks },
+	{ "samplers", BenchmarkSamplers },
+	{ "distance_fields", BenchmarkDistanceFields },
+};
+
+int main(int argc, char** argv) {
+	int run = 0;
+	for (const Benchmark& benchmark : benchmarks)
+	{
+		bool selected = argc == 1;
+		for (int a = 1; a < argc; a++)
+			selected |= strcmp(argv[a], benchmark.Name) == 0;
+		if (!selected)
+			continue;
+		printf("%s\n", benchmark.Name);
+		benchmark.Run();
+		run++;
+	}
+	if (run == 0)
+	{
+		printf("No benchmark named");
+		for (int a = 1; a < argc; a++)
+			printf(" %s", argv[a]);
+		printf("\n");
+		return 1;
+	}
+	return 0;
+}
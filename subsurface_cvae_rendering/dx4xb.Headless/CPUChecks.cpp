@@ -0,0 +1,525 @@
+// CPUChecks.cpp : Runs the checks of the CPU tools of dx4xb.Techniques and fails if a report is out of its bounds.
+// Usage: CPUChecks [check...] (all checks without arguments). CMakeLists.txt registers a test per check.
+// The bounds of the comparisons between two implementations of the same function are the documented tolerances,
+// the bounds of the approximations (reduced precision, tables, networks) are regressions with a margin over the
+// values of the current networks and tables.
+// Timings are not checked, see CPUBenchmarks.cpp.
+
+#include "Techniques/CPU/TriangleBatch.h"
+#include "Techniques/CPU/CounterRandom.h"
+#include "Techniques/CPU/LowDiscrepancy.h"
+#include "Techniques/CPU/PhaseSampling.h"
+#include "Techniques/CPU/MLP.h"
+#include "Techniques/CVAEPathtracing/CVAEModelsCheck.h"
+#include "Techniques/CVAEPathtracing/CVAEStaticModels.h"
+#include "Techniques/CVAEPathtracing/TabularSampling.h"
+#include "Techniques/CVAEPathtracing/TableBuilder.h"
+#include "Techniques/CVAEPathtracing/DistanceFieldPyramid.h"
+#include "Techniques/CVAEPathtracing/DistanceFieldQueryCheck.h"
+#include "Techniques/CVAEPathtracing/ScatterDataset.h"
+#include "Techniques/Pathtracing/CPUPathtracingCheck.h"
+
+// Folder of the networks (model files CVAEScatteringModel.bin and CVAEScatteringModelX.bin written by compiling2Binary.py
+// and the baked shaders CVAEScatteringModel.h and CVAEScatteringModelX.h they are checked against)
+#ifndef CVAE_MODELS_DIRECTORY
+#define CVAE_MODELS_DIRECTORY "../dx4xb.Techniques/Techniques/CVAEPathtracing/"
+#endif
+
+// Folder of the files written by the checks (the build folder with CMakeLists.txt)
+#ifndef CHECKS_DIRECTORY
+#define CHECKS_DIRECTORY ""
+#endif
+
+static int failures = 0;
+
+// Reports a value of a report against its bound, counts the failure.
+static void Expect(const char* name, double value, bool passed, const char* bound) {
+	printf("  %-56s %12.6g  %s %s\n", name, value, passed ? "ok  " : "FAIL", bound);
+	if (!passed)
+		failures++;
+}
+
+#define EXPECT_AT_MOST(value, bound) Expect(#value, (double)(value), (value) <= (bound), "<= " #bound)
+#define EXPECT_AT_LEAST(value, bound) Expect(#value, (double)(value), (value) >= (bound), ">= " #bound)
+
+// Files of a check in CHECKS_DIRECTORY, removed when the check ends (declared first, so files mapped by the check are
+// closed before).
+struct CheckFiles {
+	char Paths[8][MAX_PATH];
+	int Count = 0;
+
+	CheckFiles() {}
+	CheckFiles(const CheckFiles&) = delete;
+	CheckFiles& operator = (const CheckFiles&) = delete;
+
+	~CheckFiles() {
+		for (int i = 0; i < Count; i++)
+			DeleteFileA(Paths[i]);
+	}
+
+	// Path of a file of the check.
+	const char* operator()(const char* name) {
+		sprintf_s(Paths[Count], "%s%s", CHECKS_DIRECTORY, name);
+		return Paths[Count++];
+	}
+};
+
+static bool LoadModels(CVAEModels& models, bool extended) {
+	const char* fileName = extended ? CVAE_MODELS_DIRECTORY "CVAEScatteringModelX.bin" : CVAE_MODELS_DIRECTORY "CVAEScatteringModel.bin";
+	if (models.Load(fileName))
+		return true;
+	printf("  can not load the networks of %s\n", fileName);
+	failures++;
+	return false;
+}
+
+static void CheckTriangleBatches() {
+	TriangleBatchCheck check = CheckTriangleBatch();
+	EXPECT_AT_MOST(check.Larger, 0);
+	EXPECT_AT_MOST(check.Smaller, 0);
+	EXPECT_AT_MOST(check.MaxError, 1e-4f);
+	printf("  distanceP2T differs in %d of %d cases (not checked), up to %g\n",
+		check.ReferenceMismatches, check.Tests, check.ReferenceMaxError);
+}
+
+static void CheckRandoms() {
+	RandomQualityReport counter = CheckRandomQuality<CounterRandom>();
+	EXPECT_AT_MOST(counter.Suspicious, 0);
+	// the generator of the shaders, its seeding is what CounterRandom fixes
+	RandomQualityReport hybridTaus = CheckRandomQuality<HybridTausRandom>();
+	printf("  HybridTausRandom suspicious tests (not checked) %d\n", hybridTaus.Suspicious);
+	RandomCostReport cost = MeasureRandomCost(64, 64);
+	EXPECT_AT_MOST(cost.BatchMismatches, 0);
+}
+
+static void CheckSamplerConvergence() {
+	SamplerConvergenceReport report = MeasureSamplerConvergence();
+	// random sampling converges as N^-0.5, the scrambled Sobol sequences faster
+	EXPECT_AT_LEAST(report.Slope[0], -0.6f);
+	EXPECT_AT_MOST(report.Slope[0], -0.4f);
+	EXPECT_AT_MOST(report.Slope[1], report.Slope[0] - 0.1f);
+	EXPECT_AT_MOST(report.Slope[2], report.Slope[0] - 0.1f);
+}
+
+static void CheckPhaseSampling() {
+	for (float g : { -0.5f, 0.0f, 0.875f })
+	{
+		printf(" g = %g\n", g);
+		PhaseSamplingReport report = BenchmarkPhaseSampling(g, 1 << 18);
+		EXPECT_AT_MOST(report.BatchCosError, 1e-5f);
+		EXPECT_AT_MOST(report.TableCosError, 1e-2f);
+		EXPECT_AT_MOST(report.FrameError, 1e-5f);
+		EXPECT_AT_MOST(report.LengthError, 1e-5f);
+		EXPECT_AT_MOST(fabsf(report.BatchMeanCosine - g), 0.01f);
+		EXPECT_AT_MOST(fabsf(report.TableMeanCosine - g), 0.01f);
+		EXPECT_AT_MOST(report.BatchDistance, 0.01f);
+		EXPECT_AT_MOST(report.TableDistance, 0.01f);
+	}
+}
+
+static void CheckBatchMath() {
+	BatchMathReport report = MeasureBatchMath(1 << 18);
+	const BatchMathError* functions[] = { report.Exp, report.Log, report.Softplus, report.Sigmoid, report.Tanh };
+	const char* names[] = { "exp", "log", "softplus", "sigmoid", "tanh" };
+	for (int f = 0; f < 5; f++)
+	{
+		printf(" %s\n", names[f]);
+		const BatchMathError& accurate = functions[f][(int)MLPMathMode::Accurate];
+		const BatchMathError& fast = functions[f][(int)MLPMathMode::Fast];
+		EXPECT_AT_MOST(accurate.NonFinite, 0);
+		EXPECT_AT_MOST(accurate.MaxRelativeError, 3e-7f);
+		EXPECT_AT_MOST(fast.NonFinite, 0);
+		EXPECT_AT_MOST(fast.MaxRelativeError, 3e-5f);
+	}
+	EXPECT_AT_MOST(report.Softplus[(int)MLPMathMode::Fast].MaxAbsoluteError, 8e-6f);
+}
+
+static void CheckModels() {
+	for (bool extended : { false, true })
+	{
+		printf(" %s\n", extended ? "extended" : "base");
+		CVAEModels models;
+		if (!LoadModels(models, extended))
+			continue;
+		// same networks in fp32 with other orders of the sums
+		CVAEModelsConformance conformance = CheckCVAEModels(models, extended, 20000);
+		EXPECT_AT_MOST(conformance.LenError, 5e-4f);
+		EXPECT_AT_MOST(conformance.PathError, 5e-4f);
+		EXPECT_AT_MOST(conformance.ScatError, 5e-4f);
+		// the weights scanned from the generated shader are the ones of the model file
+		CVAEModels imported;
+		const char* shaderFile = extended ? CVAE_MODELS_DIRECTORY "CVAEScatteringModelX.h" : CVAE_MODELS_DIRECTORY "CVAEScatteringModel.h";
+		int differentWords = -1;
+		if (imported.ImportFromHLSL(shaderFile) && imported.ImageSize() == models.ImageSize())
+		{
+			float* a = new float[models.ImageSize()];
+			float* b = new float[models.ImageSize()];
+			models.WriteImage(a);
+			imported.WriteImage(b);
+			differentWords = 0;
+			for (int w = 0; w < models.ImageSize(); w++)
+				differentWords += memcmp(&a[w], &b[w], 4) != 0;
+			delete[] a;
+			delete[] b;
+		}
+		EXPECT_AT_LEAST(differentWords, 0);
+		EXPECT_AT_MOST(differentWords, 0);
+		// what CVAETechniqueBase accepts for its model buffer
+		bool fits = models.FitsModelBuffer();
+		EXPECT_AT_LEAST((int)fits, 1);
+		models.Scat.Clear();
+		bool withoutScattering = models.FitsModelBuffer();
+		EXPECT_AT_MOST((int)withoutScattering, 0);
+		models.Scat.AddLayer(12, CVAE_BUFFER_MAX_WIDTH + 16, MLPActivation::Softplus);
+		models.Scat.AddLayer(CVAE_BUFFER_MAX_WIDTH + 16, 12, MLPActivation::None);
+		bool wide = models.FitsModelBuffer();
+		EXPECT_AT_MOST((int)wide, 0);
+	}
+}
+
+static void CheckModelPrecision() {
+	CVAEModels models;
+	if (!LoadModels(models, false))
+		return;
+	CVAEPrecisionReport fast = CheckCVAEMathMode(models, MLPMathMode::Fast, 20000);
+	EXPECT_AT_MOST(fast.Overflows, 0);
+	EXPECT_AT_MOST(fast.AbsorptionMismatch, 1e-3f);
+	EXPECT_AT_MOST(fast.ExitPosition.Max, 1e-3f);
+	CVAEPrecisionReport half = CheckCVAEPrecision(models, MLPPrecision::Float16, 20000);
+	EXPECT_AT_MOST(half.Overflows, 0);
+	EXPECT_AT_MOST(half.AbsorptionMismatch, 0.01f);
+	EXPECT_AT_MOST(half.ExitPosition.Mean, 0.01f);
+	// int8 weights are not accurate enough for the length network, only kept from getting worse
+	CVAEPrecisionReport bytes = CheckCVAEPrecision(models, MLPPrecision::Int8, 20000);
+	EXPECT_AT_MOST(bytes.Overflows, 0);
+	EXPECT_AT_MOST(bytes.AbsorptionMismatch, 0.01f);
+	EXPECT_AT_MOST(bytes.ExitPosition.Mean, 0.15f);
+}
+
+static void CheckModelBatches() {
+	for (bool extended : { false, true })
+	{
+		printf(" %s\n", extended ? "extended" : "base");
+		StaticCVAEModelsBenchmark statics = BenchmarkStaticCVAEModels(extended, 256, 1 << 12);
+		EXPECT_AT_MOST(statics.Len.MaxError, 5e-4f);
+		EXPECT_AT_MOST(statics.Path.MaxError, 5e-4f);
+		EXPECT_AT_MOST(statics.Scat.MaxError, 5e-4f);
+
+		CVAEModels models;
+		if (!LoadModels(models, extended))
+			continue;
+		CVAEBatchSamplingBenchmark batches = BenchmarkCVAEBatchSampling(models, true, 512, 1 << 14);
+		EXPECT_AT_MOST(batches.Mismatches, (1 << 14) / 1000);
+		EXPECT_AT_MOST(batches.MaxExitError, 1e-3f);
+		EXPECT_AT_MOST(batches.MaxScatteringError, 1e-3f);
+	}
+}
+
+static void CheckSphereSamplers() {
+	// the scalar walks against the batched ones, equal up to the noise of the histograms
+	SphereSamplerAccuracy walks = CompareSphereSampler(0.5f, 0.99f, 4,
+		[](float g, float phi, float r, int count, unsigned int seed, SphereExitStatistics& statistics) {
+			WalkSphereScalar(g, phi, r, true, count, seed, statistics);
+		}, 1 << 17);
+	EXPECT_AT_MOST(walks.ExitProbabilityError, 0.01f);
+	EXPECT_AT_MOST(walks.EventsError, 0.02f);
+	EXPECT_AT_MOST(walks.ThetaDistance, 3 * walks.ThetaNoise + 0.005f);
+
+	CVAEModels models;
+	if (!LoadModels(models, false))
+		return;
+	SphereSamplerAccuracy cvae = CompareCVAESampler(models, 0.5f, 0.99f, 4, 1 << 17);
+	EXPECT_AT_MOST(cvae.ExitProbabilityError, 0.1f);
+	EXPECT_AT_MOST(cvae.ThetaDistance, 0.2f);
+}
+
+static void CheckPyramid() {
+	// the grid where clamped mips overestimated the radius, then random anisotropic sizes that are not powers of two
+	int sizes[25][3] = { { 32, 32, 30 } };
+	unsigned int state = 12345;
+	for (int g = 1; g < 25; g++)
+		for (int a = 0; a < 3; a++)
+		{
+			state = state * 747796405u + 2891336453u;
+			sizes[g][a] = 3 + (int)((state >> 8) % 62);
+			if ((sizes[g][a] & (sizes[g][a] - 1)) == 0)
+				sizes[g][a]++;
+		}
+	DistanceFieldPyramidCheck total = { 0, 0, 0, 0 };
+	for (int g = 0; g < 25; g++)
+	{
+		DistanceFieldPyramidCheck check = CheckPyramidRadius(int3(sizes[g][0], sizes[g][1], sizes[g][2]), 4, 1 << 13, g);
+		total.Points += check.Points;
+		total.Overestimates += check.Overestimates;
+		total.MaxExcess = maxf(total.MaxExcess, check.MaxExcess);
+		total.Improved += check.Improved;
+	}
+	printf("  %d points in 25 grids, %d improved by the coarse levels\n", total.Points, total.Improved);
+	EXPECT_AT_MOST(total.Overestimates, 0);
+	EXPECT_AT_MOST(total.MaxExcess, 1e-4f);
+}
+
+static void CheckGridSizes() {
+	// grids chosen by SphereTracingBase::SelectGridResolutions for boxes of several shapes,
+	// every resolution of the largest axis between MinGridSize (16) and MaxGridSize (256) is possible
+	const float3 extents[] = { float3(1, 1, 1), float3(1, 0.7f, 0.3f), float3(0.45f, 1, 0.06f) };
+	DistanceFieldPyramidCheck total = { 0, 0, 0, 0 };
+	int grids = 0;
+	for (const float3& extent : extents)
+		for (int resolution = 16; resolution <= 256; resolution += 20)
+		{
+			int3 size = DistanceFieldGridSize(float3(0, 0, 0), extent, resolution);
+			DistanceFieldPyramidCheck check = CheckPyramidRadius(size, 4, 1 << 12, grids++);
+			total.Points += check.Points;
+			total.Overestimates += check.Overestimates;
+			total.MaxExcess = maxf(total.MaxExcess, check.MaxExcess);
+			total.Improved += check.Improved;
+		}
+	printf("  %d points in %d grids, %d improved by the coarse levels\n", total.Points, grids, total.Improved);
+	EXPECT_AT_MOST(total.Overestimates, 0);
+	EXPECT_AT_MOST(total.MaxExcess, 1e-4f);
+}
+
+static void CheckLocalUpdates() {
+	DistanceFieldUpdateCheck check = CheckLocalUpdates(32, 8);
+	printf("  %lld cells after %d edits, %lld recomputed, %lld tighter than a full build (up to %g cells)\n",
+		check.Cells, check.Edits, check.RecomputedCells, check.Tighter, check.MaxTighter);
+	EXPECT_AT_MOST(check.Overestimates, 0);
+	EXPECT_AT_MOST(check.MaxExcess, 1e-4f);
+	EXPECT_AT_MOST(check.RecomputedMismatches, 0);
+	EXPECT_AT_MOST(check.MaxRecomputedDifference, 0.0f);
+}
+
+static void CheckQueries() {
+	DistanceFieldQueryCheck check = CheckDistanceFieldQueries(32, 1 << 13);
+	printf("  %d points in and around the grid\n", check.Points);
+	EXPECT_AT_MOST(check.NearestOverestimates, 0);
+	EXPECT_AT_MOST(check.TrilinearOverestimates, 0);
+	EXPECT_AT_MOST(check.Trilinear8Overestimates, 0);
+	EXPECT_AT_MOST(check.MaxExcess, 1e-4f);
+	EXPECT_AT_MOST(check.Nearest8Difference, 1e-5f);
+	EXPECT_AT_MOST(check.Trilinear8Difference, 1e-5f);
+}
+
+static void CheckScatterDatasets() {
+	ScatterDatasetCheck check = CheckScatterDataset(CHECKS_DIRECTORY "scatter_check.ds", 1 << 17, 4);
+	printf("  %d rows, %d lines with NaN\n", check.Rows, check.NaNLines);
+	long long writtenRowsError = llabs(check.WrittenRows - check.Rows);
+	long long convertedRowsError = llabs(check.ConvertedRows - (check.Lines - check.NaNLines));
+	EXPECT_AT_MOST(check.FileErrors, 0);
+	EXPECT_AT_MOST(writtenRowsError, 0);
+	EXPECT_AT_MOST(check.WrittenMismatches, 0);
+	EXPECT_AT_MOST(convertedRowsError, 0);
+	EXPECT_AT_MOST(check.ConvertedMismatches, 0);
+}
+
+// Tables of a tiny STFX build, enough to check the samplers and the encodings.
+// Every check builds its own files so the tests can run in parallel.
+static const unsigned int checkSTFXBins[] = { 8, 8, 16, 8, 4, 4 };
+
+static bool BuildCheckTables(const char* legacyFileName, const char* fileName, unsigned int encoding) {
+	TableBuildSettings settings = { TABULAR_METHOD_STFX, {}, 1 << 12, 1 };
+	for (int a = 0; a < 6; a++)
+		settings.Bins[a] = checkSTFXBins[a];
+	bool built = BuildTables(legacyFileName, settings) &&
+		ConvertSTFXTables(legacyFileName, fileName, encoding, checkSTFXBins);
+	if (!built)
+	{
+		printf("  can not build the tables %s\n", fileName);
+		failures++;
+	}
+	return built;
+}
+
+static void CheckTabularSampling() {
+	CheckFiles files;
+	const char* legacyFileName = files("sampling_check.bin");
+	const char* fileName = files("sampling_check.tab");
+	if (!BuildCheckTables(legacyFileName, fileName, TABULAR_ENCODING_FLOAT32))
+		return;
+	TabularFile file;
+	TabularSampler sampler;
+	if (!file.Open(fileName) || !sampler.Bind(file))
+	{
+		printf("  can not open the tables %s\n", fileName);
+		failures++;
+		return;
+	}
+	TabularSamplingBenchmark batches = BenchmarkTabularSampling(sampler, 512, 1 << 16);
+	EXPECT_AT_MOST(batches.Mismatches, (1 << 16) / 1000);
+	EXPECT_AT_MOST(batches.MaxExitError, 1e-3f);
+
+	SphereSamplerAccuracy accuracy = CompareTabularSampler(sampler, 0.5f, 0.99f, 4, 1 << 17);
+	EXPECT_AT_MOST(accuracy.ExitProbabilityError, 0.05f);
+	EXPECT_AT_MOST(accuracy.ThetaDistance, 0.15f);
+}
+
+static void CheckTableEncodings() {
+	CheckFiles files;
+	const char* legacyFileName = files("alias_check.bin");
+	const char* fileName = files("alias_check.tab");
+	const char* aliasFileName = files("alias_check_alias.tab");
+	const char* quantizedFileName = files("alias_check16.tab");
+	const char* codedFileName = files("alias_check_rans.tab");
+	if (!BuildCheckTables(legacyFileName, fileName, TABULAR_ENCODING_FLOAT32))
+		return;
+	TabularFile cdfs, aliases;
+	if (!cdfs.Open(fileName) || !ConvertToAliasTables(cdfs, aliasFileName) || !aliases.Open(aliasFileName))
+	{
+		printf("  can not write the alias tables %s\n", aliasFileName);
+		failures++;
+		return;
+	}
+	for (int t = 0; t < cdfs.TableCount(); t++)
+	{
+		printf(" %s\n", cdfs.Table(t).Name());
+		AliasSamplingReport report = CompareAliasTable(cdfs.Table(t), aliases.Table(t), 1 << 20);
+		EXPECT_AT_MOST(report.MaxDistance, 1e-3f);
+		EXPECT_AT_MOST(report.SampledDistance, 1.5f * report.NoiseDistance + 1e-3f);
+	}
+
+	MappedFile legacy;
+	if (!legacy.Open(legacyFileName) || !ConvertSTFXTables(legacyFileName, quantizedFileName, TABULAR_ENCODING_UNORM16, checkSTFXBins))
+	{
+		printf("  can not write the tables %s\n", quantizedFileName);
+		failures++;
+		return;
+	}
+	TabularFile quantized;
+	if (!quantized.Open(quantizedFileName))
+	{
+		printf("  can not open the tables %s\n", quantizedFileName);
+		failures++;
+		return;
+	}
+	const TabularTable* logN = quantized.Find("CDF_LogN");
+	printf(" %s (unorm16)\n", logN->Name());
+	TabularEncodingReport encoding = CompareTabularTable(*logN, legacy.As<float>(), 1 << 18);
+	EXPECT_AT_MOST(encoding.MaxCDFError, 1.0f / 65535);
+	EXPECT_AT_MOST(encoding.SearchMismatch, 1e-3f);
+
+	// coded deltas decode to the same unorm16 values
+	TabularFile coded;
+	if (!ConvertSTFXTables(legacyFileName, codedFileName, TABULAR_ENCODING_UNORM16_DELTA_RANS, checkSTFXBins) ||
+		!coded.Open(codedFileName))
+	{
+		printf("  can not write the tables %s\n", codedFileName);
+		failures++;
+		return;
+	}
+	for (int t = 0; t < coded.TableCount(); t++)
+	{
+		const TabularTable& table = coded.Table(t);
+		const TabularTable& expected = quantized.Table(t);
+		int differentValues = 0;
+		for (unsigned long long r = 0; r < table.Rows(); r++)
+			for (int i = 0; i < table.RowLength(); i++)
+				differentValues += table.Value(r, i) != expected.Value(r, i);
+		printf(" %s (unorm16 deltas) %llu bytes, unorm16 %llu bytes, float %llu bytes\n", table.Name(), table.StoredSize(),
+			expected.StoredSize(), table.Rows() * table.RowLength() * sizeof(float));
+		EXPECT_AT_MOST(differentValues, 0);
+		EXPECT_AT_MOST(table.StoredSize(), expected.StoredSize());
+	}
+}
+
+static void CheckBuildResume() {
+	// a tiny STF build and the STFX build of the checks, stopped after a few g bins and resumed
+	TableBuildSettings stf = { TABULAR_METHOD_STF, { 8, 16, 4, 8 }, 1 << 12, 1 };
+	TableBuildSettings stfx = { TABULAR_METHOD_STFX, {}, 1 << 12, 1 };
+	for (int a = 0; a < 6; a++)
+		stfx.Bins[a] = checkSTFXBins[a];
+	const char* names[] = { CHECKS_DIRECTORY "resume_check_stf.bin", CHECKS_DIRECTORY "resume_check_stfx.bin" };
+	const TableBuildSettings* settings[] = { &stf, &stfx };
+	for (int m = 0; m < 2; m++)
+	{
+		TableBuildResumeCheck check = CheckTableBuildResume(names[m], *settings[m], 3);
+		printf(" %s, %lld bytes, stopped after %d of %d g bins, %d resumed\n", m == 0 ? "STF" : "STFX",
+			check.Bytes, check.Stopped, check.Slices, check.Resumed);
+		int stoppedError = abs(check.Stopped - 3);
+		int resumedError = abs(check.Resumed - check.Stopped);
+		long long sizeError = llabs(check.SizeDifference);
+		EXPECT_AT_MOST(check.Failures, 0);
+		EXPECT_AT_MOST(check.StoppedFiles, 0);
+		EXPECT_AT_MOST(stoppedError, 0);
+		EXPECT_AT_MOST(resumedError, 0);
+		EXPECT_AT_MOST(sizeError, 0);
+		EXPECT_AT_MOST(check.Mismatches, 0);
+	}
+}
+
+static void CheckRansCoding() {
+	RansCoderCheck check = CheckRansCoder(1 << 16);
+	EXPECT_AT_MOST(check.Mismatches, 0);
+	EXPECT_AT_MOST(check.AcceptedTruncations, 0);
+	EXPECT_AT_MOST(check.SkewedRatio, 1.02f);
+	// uniform bytes are stored as they are
+	EXPECT_AT_MOST(check.UniformRatio, 1.0f + 1.0f / (1 << 16));
+}
+
+static void CheckPathtracing() {
+	// values of the current tracer (64x64 pixels, 48 frames), to be stored again when the paths change on purpose
+	const float storedMean[] = { 0.263132f, 0.301465f, 0.43776f };
+	const float storedVariance[] = { 11.1808f, 10.0469f, 6.31508f };
+	CPUPathtracingCheck check = CheckCPUPathtracing();
+	for (int c = 0; c < 3; c++)
+	{
+		printf(" channel %d, mean %g (standard error %g), variance %g\n", c, check.Mean[c], check.StandardError[c], check.Variance[c]);
+		float meanError = fabsf(check.Mean[c] - storedMean[c]);
+		float varianceError = fabsf(check.Variance[c] - storedVariance[c]) / storedVariance[c];
+		EXPECT_AT_MOST(meanError, 0.5f * check.StandardError[c]);
+		EXPECT_AT_MOST(varianceError, 0.02f);
+	}
+	EXPECT_AT_MOST(check.ThreadMismatches, 0);
+}
+
+struct Check {
+	const char* Name;
+	void (*Run)();
+};
+
+static const Check checks[] = {
+	{ "triangle_batch", CheckTriangleBatches },
+	{ "randoms", CheckRandoms },
+	{ "sampler_convergence", CheckSamplerConvergence },
+	{ "phase_sampling", CheckPhaseSampling },
+	{ "batch_math", CheckBatchMath },
+	{ "cvae_models", CheckModels },
+	{ "cvae_precision", CheckModelPrecision },
+	{ "cvae_batches", CheckModelBatches },
+	{ "sphere_samplers", CheckSphereSamplers },
+	{ "df_pyramid", CheckPyramid },
+	{ "df_grid_sizes", CheckGridSizes },
+	{ "df_updates", CheckLocalUpdates },
+	{ "df_queries", CheckQueries },
+	{ "scatter_dataset", CheckScatterDatasets },
+	{ "tabular_sampling", CheckTabularSampling },
+	{ "table_encodings", CheckTableEncodings },
+	{ "rans_coder", CheckRansCoding },
+	{ "table_resume", CheckBuildResume },
+	{ "cpu_pathtracing", CheckPathtracing },
+};
+
+int main(int argc, char** argv) {
+	int run = 0;
+	for (const Check& check : checks)
+	{
+		bool selected = argc == 1;
+		for (int a = 1; a < argc; a++)
+			selected |= strcmp(argv[a], check.Name) == 0;
+		if (!selected)
+			continue;
+		printf("%s\n", check.Name);
+		check.Run();
+		run++;
+	}
+	if (run == 0)
+	{
+		printf("No check named");
+		for (int a = 1; a < argc; a++)
+			printf(" %s", argv[a]);
+		printf("\n");
+		return 1;
+	}
+	printf("%d checks, %d failures\n", run, failures);
+	return failures > 0 ? 1 : 0;
+}
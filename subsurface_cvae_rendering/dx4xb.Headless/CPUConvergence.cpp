@@ -0,0 +1,35 @@
+// CPUConvergence.cpp : Prints the error against the frames of the statistics saved by CPUReference (or SAVE_STATS).
+// Usage: CPUConvergence prefix reference_sum.bin reference_frames [width] [height] [fit_frames]
+// Reads prefix_N_sum.bin and prefix_N_sqrSum.bin at every power of 2 of frames, the reference is the mean of
+// reference_sum.bin (a longer render, best with other random numbers than the measured ones). The slope is fitted
+// over the levels from fit_frames (64 by default), below them the error is mostly the imbalance of the channels.
+
+#include "Techniques/CPU/AccumulationStatistics.h"
+#include <stdlib.h>
+
+int main(int argc, char** argv) {
+	if (argc < 4)
+	{
+		printf("Usage: %s prefix reference_sum.bin reference_frames [width] [height] [fit_frames]\n", argv[0]);
+		return 1;
+	}
+	int referenceFrames = atoi(argv[3]);
+	int width = argc > 4 ? atoi(argv[4]) : 512;
+	int height = argc > 5 ? atoi(argv[5]) : 512;
+	int fitFrames = argc > 6 ? atoi(argv[6]) : 64;
+
+	SavedConvergenceReport report = MeasureSavedConvergence(argv[1], argv[2], referenceFrames, width, height, 1 << 16, fitFrames);
+	if (report.Levels == 0)
+	{
+		printf("Can not read the statistics of %s against %s\n", argv[1], argv[2]);
+		return 1;
+	}
+	printf("%8s %12s %14s %12s\n", "frames", "RMSE", "estimated", "neighbours");
+	for (int l = 0; l < report.Levels; l++)
+	{
+		const AccumulationError& e = report.Errors[l];
+		printf("%8d %12.6g %14.6g %12.4f\n", e.Frames, e.RMSE, e.EstimatedRMSE, e.NeighbourCorrelation);
+	}
+	printf("slope %.3f from %d frames\n", report.Slope, fitFrames);
+	return 0;
+}
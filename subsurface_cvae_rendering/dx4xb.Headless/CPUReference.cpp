@@ -0,0 +1,107 @@
+// CPUReference.cpp : Renders the reference image of a scene with CPUPathtracing, without a raytracing device.
+// Usage: CPUReference model.obj prefix [frames] [width] [height] [threads]
+// Writes prefix_N_sum.bin and prefix_N_sqrSum.bin (the statistics saved by SAVE_STATS) at every power of 2 of frames and
+// at the last frame, and the mean image prefix.pfm. The random numbers are selected at build time (DX4XB_RANDOMS).
+
+#include "dx4xb_scene_types.h"
+#include "Techniques/Pathtracing/CPUPathtracing.h"
+#include <stdlib.h>
+
+using namespace dx4xb;
+
+/// Model of the command line centered and scaled to the unit box, with the material of BunnyScene
+/// in dx4xb.Demo/scenes.h (glass with a dense scattering medium).
+class ReferenceScene : public SceneManager {
+	string modelPath;
+public:
+	ReferenceScene(string modelPath) : SceneManager(), modelPath(modelPath) {
+	}
+
+	void SetupScene() {
+		camera.Position = float3(0, 0, 1.6);
+		lights[0].Direction = normalize(float3(1, 1, 1));
+		lights[0].Intensity = float3(10, 10, 10);
+
+		auto model = OBJLoader::Load(modelPath);
+		model->Normalize(
+			SceneNormalization::Scale |
+			SceneNormalization::Maximum |
+			SceneNormalization::Center
+		);
+		scene->appendScene(model);
+
+		setGlassMaterial(0, 1, 1 / 1.5);
+
+		scene->VolumeMaterials().Data[0] = VolumeMaterial{
+			float3(500, 500, 500) * 0.25,
+			float3(0.999, 0.99995, 0.999),
+			float3(0.9, 0.9, 0.9)
+		};
+
+		SceneManager::SetupScene();
+	}
+};
+
+// Saves the mean of the accumulated frames as a little-endian rgb PFM (rows from bottom to top).
+static bool SaveMean(const char* fileName, const CPUPathtracing& tracer) {
+	const float* sum;
+	const float* sqrSum;
+	int frames;
+	tracer.getAccumulators(sum, sqrSum, frames);
+
+	FILE* file;
+	if (fopen_s(&file, fileName, "wb"))
+		return false;
+	int width = tracer.Width(), height = tracer.Height();
+	fprintf(file, "PF\n%d %d\n-1.0\n", width, height);
+	float* row = new float[width * 3];
+	bool written = true;
+	for (int y = height - 1; y >= 0; y--)
+	{
+		for (int x = 0; x < width; x++)
+			for (int c = 0; c < 3; c++)
+				row[x * 3 + c] = sum[(y * width + x) * 4 + c] / max(1, frames);
+		written &= fwrite(row, sizeof(float), width * 3, file) == (size_t)(width * 3);
+	}
+	delete[] row;
+	fclose(file);
+	return written;
+}
+
+int main(int argc, char** argv) {
+	if (argc < 3)
+	{
+		printf("Usage: %s model.obj prefix [frames] [width] [height] [threads]\n", argv[0]);
+		return 1;
+	}
+	int frames = argc > 3 ? atoi(argv[3]) : 64;
+	int width = argc > 4 ? atoi(argv[4]) : 512;
+	int height = argc > 5 ? atoi(argv[5]) : 512;
+
+	gObj<SceneManager> scene = new ReferenceScene(argv[1]);
+	scene->SetupScene();
+
+	CPUPathtracing tracer(width, height);
+	tracer.Threads = argc > 6 ? atoi(argv[6]) : 0;
+	tracer.SetSceneManager(scene);
+	tracer.OnLoad();
+	if (tracer.TriangleCount() == 0) // OBJLoader leaves the scene empty if the file can not be read
+	{
+		printf("Can not load the triangles of %s\n", argv[1]);
+		return 1;
+	}
+
+	CPUPathtracingReport report = tracer.Render(frames, argv[2]);
+	printf("%d triangles, %d frames of %dx%d on %d threads in %.2f s (%.0f paths/s, %.0f segments/s)\n",
+		tracer.TriangleCount(), report.Frames, width, height, report.Threads, report.Seconds,
+		report.PathsPerSecond, report.SegmentsPerSecond);
+
+	char fileName[1024];
+	sprintf_s(fileName, "%s.pfm", argv[2]);
+	if (!tracer.SaveStatistics(argv[2]) || !SaveMean(fileName, tracer))
+	{
+		printf("Can not write the images of %s\n", argv[2]);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "dx4xb_platform.h"
+#include <math.h>
+#include <stdio.h>
+
+/// Error of an image accumulated by the pathtracers (Accumulation and SqrAccumulation, float4 per pixel with rgb used)
+/// after a number of frames, against a reference mean image. Channels are averaged.
+struct AccumulationError {
+	int Frames;
+	// Root mean square error of the mean of the pixels against the reference
+	float RMSE;
+	// Root mean of the variances of the means of the pixels estimated from the squares: (sqrSum / n - mean^2) / (n - 1)
+	float EstimatedRMSE;
+	// Correlation of the errors of horizontally and vertically adjacent pixels, negative when errors are blue noise
+	float NeighbourCorrelation;
+};
+
+// stride is the number of floats per pixel of the three images, 4 for the saved textures.
+inline AccumulationError MeasureAccumulation(const float* sum, const float* sqrSum, int frames, const float* reference,
+	int width, int height, int stride = 4) {
+	AccumulationError result = {};
+	result.Frames = frames;
+	if (frames <= 0)
+		return result;
+	double squares = 0, variances = 0, neighbours = 0;
+	for (int y = 0; y < height; y++)
+		for (int x = 0; x < width; x++)
+		{
+			int p = (y * width + x) * stride;
+			for (int c = 0; c < 3; c++)
+			{
+				double mean = sum[p + c] / frames;
+				double error = mean - reference[p + c];
+				squares += error * error;
+				if (frames > 1)
+					variances += max(0.0, sqrSum[p + c] / frames - mean * mean) / (frames - 1);
+				if (x + 1 < width)
+					neighbours += error * (sum[p + stride + c] / frames - reference[p + stride + c]);
+				if (y + 1 < height)
+					neighbours += error * (sum[p + width * stride + c] / frames - reference[p + width * stride + c]);
+			}
+		}
+	double count = 3.0 * width * height;
+	double pairs = 3.0 * ((width - 1) * height + width * (height - 1));
+	result.RMSE = (float)sqrt(squares / count);
+	result.EstimatedRMSE = (float)sqrt(variances / count);
+	result.NeighbourCorrelation = squares > 0 && pairs > 0 ? (float)((neighbours / pairs) / (squares / count)) : 0;
+	return result;
+}
+
+// Reads width x height float4 pixels of a texture saved with SAVE_STATS. Returns nullptr if missing or shorter.
+inline float* LoadAccumulation(const char* fileName, int width, int height) {
+	FILE* file;
+	if (fopen_s(&file, fileName, "rb"))
+		return nullptr;
+	size_t count = (size_t)width * height * 4;
+	float* data = new float[count];
+	if (fread(data, sizeof(float), count, file) != count)
+	{
+		delete[] data;
+		data = nullptr;
+	}
+	fclose(file);
+	return data;
+}
+
+/// Errors of the statistics saved with SAVE_STATS at every power of 2 of frames (prefix_N_sum.bin and prefix_N_sqrSum.bin),
+/// e.g. of a comparison scene rendered with random streams and with RANDOMS_LOW_DISCREPANCY in two folders.
+struct SavedConvergenceReport {
+	int Levels;
+	AccumulationError Errors[32];
+	// Least squares slope of log RMSE against log frames of the levels from fitFrames (-0.5 for random sampling)
+	float Slope;
+};
+
+/// The reference is the mean of the sum saved at referenceFrames (with a long render of any sequence).
+/// Levels stop at the first missing file or at maxFrames. Returns 0 levels if the reference is missing.
+/// The pathtracers trace a channel per frame (Pass % 3), so the powers of 2 carry an imbalance of the channels that
+/// dominates the error of the first levels, the slope is fitted from fitFrames.
+inline SavedConvergenceReport MeasureSavedConvergence(const char* prefix, const char* referenceSumFile, int referenceFrames,
+	int width, int height, int maxFrames = 1 << 16, int fitFrames = 64) {
+	SavedConvergenceReport report = {};
+	float* reference = LoadAccumulation(referenceSumFile, width, height);
+	if (!reference)
+		return report;
+	for (size_t i = 0; i < (size_t)width * height * 4; i++)
+		reference[i] /= referenceFrames;
+
+	char sumFile[1024], sqrSumFile[1024];
+	for (int frames = 2; frames <= maxFrames && report.Levels < 32; frames *= 2)
+	{
+		sprintf_s(sumFile, "%s_%d_sum.bin", prefix, frames);
+		sprintf_s(sqrSumFile, "%s_%d_sqrSum.bin", prefix, frames);
+		float* sum = LoadAccumulation(sumFile, width, height);
+		float* sqrSum = LoadAccumulation(sqrSumFile, width, height);
+		bool loaded = sum && sqrSum;
+		if (loaded)
+			report.Errors[report.Levels++] = MeasureAccumulation(sum, sqrSum, frames, reference, width, height);
+		delete[] sum;
+		delete[] sqrSum;
+		if (!loaded)
+			break;
+	}
+	double n = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+	for (int l = 0; l < report.Levels; l++)
+		if (report.Errors[l].Frames >= fitFrames && report.Errors[l].RMSE > 0)
+		{
+			double x = log((double)report.Errors[l].Frames), y = log((double)report.Errors[l].RMSE);
+			n++; sx += x; sy += y; sxx += x * x; sxy += x * y;
+		}
+	if (n > 1)
+		report.Slope = (float)((n * sxy - sx * sy) / (n * sxx - sx * sx));
+	delete[] reference;
+	return report;
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+// Maximum number of bins of an alias table, aliases are stored in 16 bits.
+#define ALIAS_MAX_BINS 65536
+
+// Probability of keeping a bin meaning always.
+#define ALIAS_ALWAYS 0xFFFF
+
+/// Builds alias tables (Walker's method with Vose's construction) of discrete distributions given by their cdf.
+/// An entry per bin packs the probability of keeping the bin (unorm16 of 1/65536 steps, ALIAS_ALWAYS for 1) in the
+/// low 16 bits and the alias bin in the high 16 bits, so a table takes the same memory than the cdf it replaces.
+/// Tables are sampled in constant time with SampleAlias.
+class AliasTableBuilder {
+	double* weights = nullptr;
+	int* small = nullptr;
+	int* large = nullptr;
+	int capacity = 0;
+
+public:
+	AliasTableBuilder() {}
+	AliasTableBuilder(const AliasTableBuilder&) = delete;
+	AliasTableBuilder& operator = (const AliasTableBuilder&) = delete;
+
+	~AliasTableBuilder() {
+		delete[] weights;
+		delete[] small;
+		delete[] large;
+	}
+
+	// Builds the table of a cdf of length bins (not necessarily normalized, length <= ALIAS_MAX_BINS).
+	// A cdf without mass always selects the last bin, as a binary search over it does.
+	void Build(const float* cdf, int length, unsigned int* entries) {
+		if (length > capacity)
+		{
+			delete[] weights;
+			delete[] small;
+			delete[] large;
+			capacity = length;
+			weights = new double[length];
+			small = new int[length];
+			large = new int[length];
+		}
+
+		double total = 0;
+		for (int i = 0; i < length; i++)
+		{
+			double p = (double)cdf[i] - (i > 0 ? cdf[i - 1] : 0);
+			weights[i] = p > 0 ? p : 0;
+			total += weights[i];
+		}
+		if (total <= 0)
+		{
+			for (int i = 0; i < length; i++)
+				entries[i] = (unsigned int)(length - 1) << 16;
+			return;
+		}
+
+		int smallCount = 0, largeCount = 0;
+		for (int i = 0; i < length; i++)
+		{
+			weights[i] *= length / total;
+			if (weights[i] < 1)
+				small[smallCount++] = i;
+			else
+				large[largeCount++] = i;
+		}
+		while (smallCount > 0 && largeCount > 0)
+		{
+			int s = small[--smallCount];
+			int l = large[largeCount - 1];
+			entries[s] = Entry(weights[s], l);
+			weights[l] -= 1 - weights[s];
+			if (weights[l] < 1)
+			{
+				largeCount--;
+				small[smallCount++] = l;
+			}
+		}
+		// remaining bins (up to rounding) keep all their probability
+		while (largeCount > 0)
+		{
+			int l = large[--largeCount];
+			entries[l] = Entry(1, l);
+		}
+		while (smallCount > 0)
+		{
+			int s = small[--smallCount];
+			entries[s] = Entry(1, s);
+		}
+	}
+
+	static inline unsigned int Entry(double keep, int alias) {
+		double q = keep * 65536 + 0.5;
+		unsigned int probability = q >= ALIAS_ALWAYS ? ALIAS_ALWAYS : q <= 0 ? 0 : (unsigned int)q;
+		return ((unsigned int)alias << 16) | probability;
+	}
+};
+
+/// Samples a bin of an alias table with 32 random bits.
+/// The high part of random * length selects the bin, the next 16 bits decide between the bin and its alias.
+inline int SampleAlias(const unsigned int* entries, int length, unsigned int random) {
+	unsigned long long x = (unsigned long long)random * (unsigned int)length;
+	int bin = (int)(x >> 32);
+	unsigned int fraction = (unsigned int)x >> 16;
+	unsigned int entry = entries[bin];
+	unsigned int probability = entry & 0xFFFF;
+	return fraction < probability || probability == ALIAS_ALWAYS ? bin : (int)(entry >> 16);
+}
+
+/// Probabilities of the bins selected by an alias table.
+inline void AliasProbabilities(const unsigned int* entries, int length, double* probabilities) {
+	for (int i = 0; i < length; i++)
+		probabilities[i] = 0;
+	for (int i = 0; i < length; i++)
+	{
+		unsigned int probability = entries[i] & 0xFFFF;
+		double keep = probability == ALIAS_ALWAYS ? 1 : probability / 65536.0;
+		probabilities[i] += keep / length;
+		probabilities[entries[i] >> 16] += (1 - keep) / length;
+	}
+}
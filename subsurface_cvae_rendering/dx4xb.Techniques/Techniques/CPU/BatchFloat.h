@@ -0,0 +1,408 @@
+#pragma once
+
+#include <immintrin.h>
+#include <math.h>
+#include <string.h>
+#include "Half.h"
+
+// A batch_float holds BATCH_WIDTH floats processed at once.
+// 16 lanes with AVX-512, 8 lanes with AVX2 and 8 lanes of plain floats otherwise (left to the compiler).
+// The branch is chosen at compile time: MSVC only defines __AVX2__ with /arch:AVX2, which dx4xb.Techniques and
+// Eurographics.CVAE_ST set (EnableEnhancedInstructionSet) in every configuration. Without it the plain floats are used.
+// Loads and stores are unaligned.
+#if defined(__AVX512F__)
+
+#define BATCH_WIDTH 16
+typedef __m512 batch_float;
+
+inline batch_float BatchLoad(const float* p) { return _mm512_loadu_ps(p); }
+inline void BatchStore(float* p, batch_float a) { _mm512_storeu_ps(p, a); }
+inline batch_float BatchSet(float x) { return _mm512_set1_ps(x); }
+inline batch_float BatchAdd(batch_float a, batch_float b) { return _mm512_add_ps(a, b); }
+inline batch_float BatchSub(batch_float a, batch_float b) { return _mm512_sub_ps(a, b); }
+inline batch_float BatchMul(batch_float a, batch_float b) { return _mm512_mul_ps(a, b); }
+inline batch_float BatchDiv(batch_float a, batch_float b) { return _mm512_div_ps(a, b); }
+inline batch_float BatchSqrt(batch_float a) { return _mm512_sqrt_ps(a); }
+// a * b + c
+inline batch_float BatchMulAdd(batch_float a, batch_float b, batch_float c) { return _mm512_fmadd_ps(a, b, c); }
+inline batch_float BatchMin(batch_float a, batch_float b) { return _mm512_min_ps(a, b); }
+inline batch_float BatchMax(batch_float a, batch_float b) { return _mm512_max_ps(a, b); }
+inline batch_float BatchRound(batch_float a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+inline batch_float BatchFloor(batch_float a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+// base[indices[i]] per lane
+inline batch_float BatchGather(const float* base, const int* indices) { return _mm512_i32gather_ps(_mm512_loadu_si512(indices), base, 4); }
+// Per lane, a < b ? x : y
+inline batch_float BatchSelectLess(batch_float a, batch_float b, batch_float x, batch_float y) {
+	return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ), y, x);
+}
+// 2^n for integral n in [-126, 127]
+inline batch_float BatchPow2(batch_float n) {
+	return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(n), _mm512_set1_epi32(127)), 23));
+}
+// Mantissa in [0.5, 1) and exponent of positive normalized floats (x = mantissa * 2^exponent)
+inline batch_float BatchFrexp(batch_float x, batch_float& exponent) {
+	__m512i bits = _mm512_castps_si512(x);
+	exponent = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(126)));
+	return _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f000000)));
+}
+inline float BatchMinimum(batch_float a) { return _mm512_reduce_min_ps(a); }
+// Converts BATCH_WIDTH halves or signed bytes
+inline batch_float BatchLoadHalf(const unsigned short* p) { return _mm512_cvtph_ps(_mm256_loadu_si256((const __m256i*)p)); }
+inline batch_float BatchLoadInt8(const signed char* p) { return _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)p))); }
+// Value of every lane stored as a half
+inline batch_float BatchRoundToHalf(batch_float a) { return _mm512_cvtph_ps(_mm512_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT)); }
+
+#elif defined(__AVX2__)
+
+#define BATCH_WIDTH 8
+typedef __m256 batch_float;
+
+inline batch_float BatchLoad(const float* p) { return _mm256_loadu_ps(p); }
+inline void BatchStore(float* p, batch_float a) { _mm256_storeu_ps(p, a); }
+inline batch_float BatchSet(float x) { return _mm256_set1_ps(x); }
+inline batch_float BatchAdd(batch_float a, batch_float b) { return _mm256_add_ps(a, b); }
+inline batch_float BatchSub(batch_float a, batch_float b) { return _mm256_sub_ps(a, b); }
+inline batch_float BatchMul(batch_float a, batch_float b) { return _mm256_mul_ps(a, b); }
+inline batch_float BatchDiv(batch_float a, batch_float b) { return _mm256_div_ps(a, b); }
+inline batch_float BatchSqrt(batch_float a) { return _mm256_sqrt_ps(a); }
+// a * b + c (fused if the compiler targets FMA, MSVC always does with /arch:AVX2)
+#if defined(__FMA__) || defined(_MSC_VER)
+inline batch_float BatchMulAdd(batch_float a, batch_float b, batch_float c) { return _mm256_fmadd_ps(a, b, c); }
+#else
+inline batch_float BatchMulAdd(batch_float a, batch_float b, batch_float c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+inline batch_float BatchMin(batch_float a, batch_float b) { return _mm256_min_ps(a, b); }
+inline batch_float BatchMax(batch_float a, batch_float b) { return _mm256_max_ps(a, b); }
+inline batch_float BatchRound(batch_float a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+inline batch_float BatchFloor(batch_float a) { return _mm256_floor_ps(a); }
+// base[indices[i]] per lane
+inline batch_float BatchGather(const float* base, const int* indices) { return _mm256_i32gather_ps(base, _mm256_loadu_si256((const __m256i*)indices), 4); }
+// Per lane, a < b ? x : y
+inline batch_float BatchSelectLess(batch_float a, batch_float b, batch_float x, batch_float y) {
+	return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_LT_OQ));
+}
+// 2^n for integral n in [-126, 127]
+inline batch_float BatchPow2(batch_float n) {
+	return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n), _mm256_set1_epi32(127)), 23));
+}
+// Mantissa in [0.5, 1) and exponent of positive normalized floats (x = mantissa * 2^exponent)
+inline batch_float BatchFrexp(batch_float x, batch_float& exponent) {
+	__m256i bits = _mm256_castps_si256(x);
+	exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(126)));
+	return _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f000000)));
+}
+inline float BatchMinimum(batch_float a) {
+	__m128 m = _mm_min_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+	m = _mm_min_ps(m, _mm_movehl_ps(m, m));
+	m = _mm_min_ss(m, _mm_shuffle_ps(m, m, 1));
+	return _mm_cvtss_f32(m);
+}
+// Converts BATCH_WIDTH halves or signed bytes
+inline batch_float BatchLoadInt8(const signed char* p) { return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i*)p))); }
+// F16C comes with every AVX2 processor (MSVC always enables it with /arch:AVX2)
+#if defined(__F16C__) || defined(_MSC_VER)
+inline batch_float BatchLoadHalf(const unsigned short* p) { return _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)p)); }
+// Value of every lane stored as a half
+inline batch_float BatchRoundToHalf(batch_float a) { return _mm256_cvtph_ps(_mm256_cvtps_ph(a, _MM_FROUND_TO_NEAREST_INT)); }
+#else
+inline batch_float BatchLoadHalf(const unsigned short* p) {
+	alignas(32) float v[BATCH_WIDTH];
+	for (int i = 0; i < BATCH_WIDTH; i++)
+		v[i] = HalfToFloat(p[i]);
+	return _mm256_load_ps(v);
+}
+// Value of every lane stored as a half
+inline batch_float BatchRoundToHalf(batch_float a) {
+	alignas(32) float v[BATCH_WIDTH];
+	_mm256_store_ps(v, a);
+	for (int i = 0; i < BATCH_WIDTH; i++)
+		v[i] = RoundToHalf(v[i]);
+	return _mm256_load_ps(v);
+}
+#endif
+
+#else
+
+#define BATCH_WIDTH 8
+struct batch_float { float v[BATCH_WIDTH]; };
+
+inline batch_float BatchLoad(const float* p) { batch_float r; for (int i = 0; i < BATCH_WIDTH; i++) r.v[i] = p[i]; return r; }
+inline void BatchStore(float* p, batch_float a) { for (int i = 0; i < BATCH_WIDTH; i++) p[i] = a.v[i]; }
+inline batch_float BatchSet(float x) { batch_float r; for (int i = 0; i < BATCH_WIDTH; i++) r.v[i] = x; return r; }
+inline batch_float BatchAdd(batch_float a, batch_float b) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] += b.v[i]; return a; }
+inline batch_float BatchSub(batch_float a, batch_float b) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] -= b.v[i]; return a; }
+inline batch_float BatchMul(batch_float a, batch_float b) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] *= b.v[i]; return a; }
+inline batch_float BatchDiv(batch_float a, batch_float b) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] /= b.v[i]; return a; }
+inline batch_float BatchSqrt(batch_float a) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] = sqrtf(a.v[i]); return a; }
+// a * b + c
+inline batch_float BatchMulAdd(batch_float a, batch_float b, batch_float c) { for (int i = 0; i < BATCH_WIDTH; i++) c.v[i] += a.v[i] * b.v[i]; return c; }
+inline batch_float BatchMin(batch_float a, batch_float b) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] = a.v[i] < b.v[i] ? a.v[i] : b.v[i]; return a; }
+inline batch_float BatchMax(batch_float a, batch_float b) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] = a.v[i] > b.v[i] ? a.v[i] : b.v[i]; return a; }
+// Ties to even in the default rounding mode, as the SIMD versions
+inline batch_float BatchRound(batch_float a) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] = nearbyintf(a.v[i]); return a; }
+inline batch_float BatchFloor(batch_float a) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] = floorf(a.v[i]); return a; }
+// base[indices[i]] per lane
+inline batch_float BatchGather(const float* base, const int* indices) { batch_float r; for (int i = 0; i < BATCH_WIDTH; i++) r.v[i] = base[indices[i]]; return r; }
+// Per lane, a < b ? x : y
+inline batch_float BatchSelectLess(batch_float a, batch_float b, batch_float x, batch_float y) {
+	for (int i = 0; i < BATCH_WIDTH; i++)
+		if (a.v[i] < b.v[i])
+			y.v[i] = x.v[i];
+	return y;
+}
+// 2^n for integral n in [-126, 127]
+inline batch_float BatchPow2(batch_float n) {
+	for (int i = 0; i < BATCH_WIDTH; i++)
+	{
+		unsigned int bits = (unsigned int)((int)n.v[i] + 127) << 23;
+		memcpy(&n.v[i], &bits, 4);
+	}
+	return n;
+}
+// Mantissa in [0.5, 1) and exponent of positive normalized floats (x = mantissa * 2^exponent)
+inline batch_float BatchFrexp(batch_float x, batch_float& exponent) {
+	for (int i = 0; i < BATCH_WIDTH; i++)
+	{
+		unsigned int bits;
+		memcpy(&bits, &x.v[i], 4);
+		exponent.v[i] = (float)((int)(bits >> 23) - 126);
+		bits = (bits & 0x007fffff) | 0x3f000000;
+		memcpy(&x.v[i], &bits, 4);
+	}
+	return x;
+}
+inline float BatchMinimum(batch_float a) { float m = a.v[0]; for (int i = 1; i < BATCH_WIDTH; i++) m = m < a.v[i] ? m : a.v[i]; return m; }
+// Converts BATCH_WIDTH halves or signed bytes
+inline batch_float BatchLoadHalf(const unsigned short* p) { batch_float r; for (int i = 0; i < BATCH_WIDTH; i++) r.v[i] = HalfToFloat(p[i]); return r; }
+inline batch_float BatchLoadInt8(const signed char* p) { batch_float r; for (int i = 0; i < BATCH_WIDTH; i++) r.v[i] = p[i]; return r; }
+// Value of every lane stored as a half
+inline batch_float BatchRoundToHalf(batch_float a) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] = RoundToHalf(a.v[i]); return a; }
+
+#endif
+
+#pragma region Transcendental functions
+
+// Polynomial approximations of Cephes expf and logf, relative error below 2e-7 in the whole float range.
+
+// e^x. Inputs are clamped to [-87.3, 88.7] so the result is a normalized float.
+inline batch_float BatchExp(batch_float x) {
+	x = BatchMin(BatchSet(88.7f), BatchMax(BatchSet(-87.3f), x));
+	batch_float n = BatchRound(BatchMul(x, BatchSet(1.44269504088896341f)));
+	// r = x - n * ln2 in two parts to keep the precision
+	batch_float r = BatchSub(BatchSub(x, BatchMul(n, BatchSet(0.693359375f))), BatchMul(n, BatchSet(-2.12194440e-4f)));
+	batch_float p = BatchSet(1.9875691500e-4f);
+	p = BatchMulAdd(p, r, BatchSet(1.3981999507e-3f));
+	p = BatchMulAdd(p, r, BatchSet(8.3334519073e-3f));
+	p = BatchMulAdd(p, r, BatchSet(4.1665795894e-2f));
+	p = BatchMulAdd(p, r, BatchSet(1.6666665459e-1f));
+	p = BatchMulAdd(p, r, BatchSet(5.0000001201e-1f));
+	p = BatchAdd(BatchMulAdd(p, BatchMul(r, r), r), BatchSet(1));
+	return BatchMul(p, BatchPow2(n));
+}
+
+// Natural logarithm of positive normalized floats.
+inline batch_float BatchLog(batch_float x) {
+	batch_float e;
+	batch_float m = BatchFrexp(x, e);
+	// m in [sqrt(0.5), sqrt(2)) so the polynomial is evaluated close to 1
+	batch_float small = BatchSelectLess(m, BatchSet(0.707106781186547524f), BatchSet(1), BatchSet(0));
+	e = BatchSub(e, small);
+	m = BatchSub(BatchAdd(m, BatchMul(m, small)), BatchSet(1));
+
+	batch_float z = BatchMul(m, m);
+	batch_float p = BatchSet(7.0376836292e-2f);
+	p = BatchMulAdd(p, m, BatchSet(-1.1514610310e-1f));
+	p = BatchMulAdd(p, m, BatchSet(1.1676998740e-1f));
+	p = BatchMulAdd(p, m, BatchSet(-1.2420140846e-1f));
+	p = BatchMulAdd(p, m, BatchSet(1.4249322787e-1f));
+	p = BatchMulAdd(p, m, BatchSet(-1.6668057665e-1f));
+	p = BatchMulAdd(p, m, BatchSet(2.0000714765e-1f));
+	p = BatchMulAdd(p, m, BatchSet(-2.4999993993e-1f));
+	p = BatchMulAdd(p, m, BatchSet(3.3333331174e-1f));
+	p = BatchMul(BatchMul(p, m), z);
+	p = BatchMulAdd(e, BatchSet(-2.12194440e-4f), p);
+	p = BatchMulAdd(z, BatchSet(-0.5f), p);
+	return BatchMulAdd(e, BatchSet(0.693359375f), BatchAdd(m, p));
+}
+
+// log(1 + exp(x)) computed as max(x, 0) + log(1 + exp(-|x|)), so it doesn't overflow for large x
+// and keeps the relative precision for very negative x.
+inline batch_float BatchSoftplus(batch_float x) {
+	batch_float zero = BatchSet(0), one = BatchSet(1);
+	batch_float v = BatchExp(BatchMin(x, BatchSub(zero, x))); // in (0, 1]
+	batch_float w = BatchAdd(one, v);
+	batch_float d = BatchSub(w, one);
+	// log1p(v) = log(w) * v / (w - 1), exactly v when w rounds to 1
+	batch_float log1p = BatchSelectLess(zero, d, BatchMul(BatchLog(w), BatchDiv(v, BatchMax(d, BatchSet(1e-30f)))), v);
+	return BatchAdd(BatchMax(x, zero), log1p);
+}
+
+inline batch_float BatchSigmoid(batch_float x) {
+	return BatchDiv(BatchSet(1), BatchAdd(BatchSet(1), BatchExp(BatchSub(BatchSet(0), x))));
+}
+
+// tanh(x) for |x| < 0.625 as x + x^3 * p(x^2) (Cephes tanhf), relative error below 3e-7.
+// 2 * sigmoid(2x) - 1 cancels near 0 and loses all the relative precision below |x| ~ 1e-4.
+inline batch_float BatchTanhSmall(batch_float x) {
+	batch_float z = BatchMul(x, x);
+	batch_float p = BatchSet(-5.70498872745e-3f);
+	p = BatchMulAdd(p, z, BatchSet(2.06390887954e-2f));
+	p = BatchMulAdd(p, z, BatchSet(-5.37397155531e-2f));
+	p = BatchMulAdd(p, z, BatchSet(1.33314422036e-1f));
+	p = BatchMulAdd(p, z, BatchSet(-3.33332819422e-1f));
+	return BatchMulAdd(BatchMul(p, z), x, x);
+}
+
+inline batch_float BatchTanh(batch_float x) {
+	batch_float large = BatchSub(BatchMul(BatchSet(2), BatchSigmoid(BatchMul(BatchSet(2), x))), BatchSet(1));
+	batch_float magnitude = BatchMax(x, BatchSub(BatchSet(0), x));
+	return BatchSelectLess(magnitude, BatchSet(0.625f), BatchTanhSmall(x), large);
+}
+
+// Sine and cosine of |x| below 8192 (Cephes sinf and cosf), absolute error below 2e-7.
+inline void BatchSinCos(batch_float x, batch_float& sine, batch_float& cosine) {
+	// x = j * pi/2 + r with |r| <= pi/4, q = j mod 4 is the quadrant
+	batch_float j = BatchRound(BatchMul(x, BatchSet(0.636619772367581343f)));
+	batch_float r = BatchSub(x, BatchMul(j, BatchSet(1.5703125f)));
+	r = BatchSub(r, BatchMul(j, BatchSet(4.837512969970703125e-4f)));
+	r = BatchSub(r, BatchMul(j, BatchSet(7.54978995489188216e-8f)));
+	batch_float q = BatchSub(j, BatchMul(BatchSet(4), BatchRound(BatchMul(BatchSub(j, BatchSet(1.5f)), BatchSet(0.25f)))));
+	batch_float odd = BatchSub(q, BatchMul(BatchSet(2), BatchRound(BatchMul(BatchSub(q, BatchSet(0.5f)), BatchSet(0.5f)))));
+
+	batch_float z = BatchMul(r, r);
+	batch_float s = BatchSet(-1.9515295891e-4f);
+	s = BatchMulAdd(s, z, BatchSet(8.3321608736e-3f));
+	s = BatchMulAdd(s, z, BatchSet(-1.6666654611e-1f));
+	s = BatchMulAdd(BatchMul(s, z), r, r);
+	batch_float c = BatchSet(2.443315711809948e-5f);
+	c = BatchMulAdd(c, z, BatchSet(-1.388731625493765e-3f));
+	c = BatchMulAdd(c, z, BatchSet(4.166664568298827e-2f));
+	c = BatchAdd(BatchMulAdd(BatchMul(c, z), z, BatchMul(z, BatchSet(-0.5f))), BatchSet(1));
+
+	// odd quadrants swap sine and cosine, sine is negative in quadrants 2 and 3 and cosine in 1 and 2
+	batch_float one = BatchSet(1), minusOne = BatchSet(-1);
+	sine = BatchMulAdd(odd, BatchSub(c, s), s);
+	cosine = BatchMulAdd(odd, BatchSub(s, c), c);
+	sine = BatchMul(sine, BatchSelectLess(q, BatchSet(1.5f), one, minusOne));
+	batch_float d = BatchSub(q, BatchSet(1.5f));
+	cosine = BatchMul(cosine, BatchSelectLess(BatchMax(d, BatchSub(BatchSet(0), d)), one, minusOne, one));
+}
+
+#pragma endregion
+
+#pragma region Fast approximations
+
+// Shorter minimax polynomials with the same range reductions, for the activations of the networks.
+// Errors are measured against double precision (see MeasureBatchMath in MLP.h).
+
+// e^x with a degree 4 polynomial. Relative error below 8e-6, inputs are clamped as in BatchExp.
+inline batch_float BatchExpFast(batch_float x) {
+	x = BatchMin(BatchSet(88.7f), BatchMax(BatchSet(-87.3f), x));
+	batch_float n = BatchRound(BatchMul(x, BatchSet(1.44269504088896341f)));
+	batch_float r = BatchSub(BatchSub(x, BatchMul(n, BatchSet(0.693359375f))), BatchMul(n, BatchSet(-2.12194440e-4f)));
+	batch_float p = BatchSet(4.192116302e-2f);
+	p = BatchMulAdd(p, r, BatchSet(1.675388411e-1f));
+	p = BatchMulAdd(p, r, BatchSet(4.999895124e-1f));
+	p = BatchAdd(BatchMulAdd(p, BatchMul(r, r), r), BatchSet(1));
+	return BatchMul(p, BatchPow2(n));
+}
+
+// Natural logarithm of positive normalized floats with a degree 6 polynomial.
+// Absolute error below 8e-6, relative error below 2e-5.
+inline batch_float BatchLogFast(batch_float x) {
+	batch_float e;
+	batch_float m = BatchFrexp(x, e);
+	batch_float small = BatchSelectLess(m, BatchSet(0.707106781186547524f), BatchSet(1), BatchSet(0));
+	e = BatchSub(e, small);
+	m = BatchSub(BatchAdd(m, BatchMul(m, small)), BatchSet(1));
+
+	batch_float z = BatchMul(m, m);
+	batch_float p = BatchSet(-1.470244183e-1f);
+	p = BatchMulAdd(p, m, BatchSet(2.192439634e-1f));
+	p = BatchMulAdd(p, m, BatchSet(-2.525215399e-1f));
+	p = BatchMulAdd(p, m, BatchSet(3.327248667e-1f));
+	p = BatchMul(BatchMul(p, m), z);
+	p = BatchMulAdd(e, BatchSet(-2.12194440e-4f), p);
+	p = BatchMulAdd(z, BatchSet(-0.5f), p);
+	return BatchMulAdd(e, BatchSet(0.693359375f), BatchAdd(m, p));
+}
+
+// Softplus as max(x, 0) + log1p(t) with t = e^-|x| in (0, 1] and log1p(t) = t * p(t) (degree 6), no logarithm is evaluated.
+// Doesn't overflow. Absolute error below 8e-6, relative error below 2e-5 (t is kept above e^-80, avoids denormal products).
+inline batch_float BatchSoftplusFast(batch_float x) {
+	batch_float zero = BatchSet(0);
+	batch_float t = BatchExpFast(BatchMax(BatchSet(-80), BatchMin(x, BatchSub(zero, x))));
+	batch_float p = BatchSet(-2.386913661e-2f);
+	p = BatchMulAdd(p, t, BatchSet(1.012222665e-1f));
+	p = BatchMulAdd(p, t, BatchSet(-2.100486966e-1f));
+	p = BatchMulAdd(p, t, BatchSet(3.252066953e-1f));
+	p = BatchMulAdd(p, t, BatchSet(-4.993613699e-1f));
+	p = BatchMulAdd(p, t, BatchSet(9.999915986e-1f));
+	return BatchMulAdd(p, t, BatchMax(x, zero));
+}
+
+// Absolute error below 2e-6.
+inline batch_float BatchSigmoidFast(batch_float x) {
+	return BatchDiv(BatchSet(1), BatchAdd(BatchSet(1), BatchExpFast(BatchSub(BatchSet(0), x))));
+}
+
+// Relative error below 4e-6, the polynomial of BatchTanh near 0.
+inline batch_float BatchTanhFast(batch_float x) {
+	batch_float large = BatchSub(BatchMul(BatchSet(2), BatchSigmoidFast(BatchMul(BatchSet(2), x))), BatchSet(1));
+	batch_float magnitude = BatchMax(x, BatchSub(BatchSet(0), x));
+	return BatchSelectLess(magnitude, BatchSet(0.625f), BatchTanhSmall(x), large);
+}
+
+#pragma endregion
+
+#pragma region Unsigned integers
+
+// A batch_uint holds BATCH_WIDTH 32-bit unsigned integers with wrapping arithmetic (random number generators).
+#if defined(__AVX512F__)
+
+typedef __m512i batch_uint;
+
+inline batch_uint BatchUintLoad(const unsigned int* p) { return _mm512_loadu_si512(p); }
+inline void BatchUintStore(unsigned int* p, batch_uint a) { _mm512_storeu_si512(p, a); }
+inline batch_uint BatchUintSet(unsigned int x) { return _mm512_set1_epi32((int)x); }
+inline batch_uint BatchUintAdd(batch_uint a, batch_uint b) { return _mm512_add_epi32(a, b); }
+// Low 32 bits of the products
+inline batch_uint BatchUintMul(batch_uint a, batch_uint b) { return _mm512_mullo_epi32(a, b); }
+inline batch_uint BatchUintXor(batch_uint a, batch_uint b) { return _mm512_xor_si512(a, b); }
+inline batch_uint BatchUintShiftRight(batch_uint a, int bits) { return _mm512_srl_epi32(a, _mm_cvtsi32_si128(bits)); }
+// Top 24 bits as a float in [0, 1)
+inline batch_float BatchUintToUnit(batch_uint a) { return _mm512_mul_ps(_mm512_cvtepi32_ps(_mm512_srli_epi32(a, 8)), _mm512_set1_ps(1.0f / 16777216.0f)); }
+
+#elif defined(__AVX2__)
+
+typedef __m256i batch_uint;
+
+inline batch_uint BatchUintLoad(const unsigned int* p) { return _mm256_loadu_si256((const __m256i*)p); }
+inline void BatchUintStore(unsigned int* p, batch_uint a) { _mm256_storeu_si256((__m256i*)p, a); }
+inline batch_uint BatchUintSet(unsigned int x) { return _mm256_set1_epi32((int)x); }
+inline batch_uint BatchUintAdd(batch_uint a, batch_uint b) { return _mm256_add_epi32(a, b); }
+// Low 32 bits of the products
+inline batch_uint BatchUintMul(batch_uint a, batch_uint b) { return _mm256_mullo_epi32(a, b); }
+inline batch_uint BatchUintXor(batch_uint a, batch_uint b) { return _mm256_xor_si256(a, b); }
+inline batch_uint BatchUintShiftRight(batch_uint a, int bits) { return _mm256_srl_epi32(a, _mm_cvtsi32_si128(bits)); }
+// Top 24 bits as a float in [0, 1)
+inline batch_float BatchUintToUnit(batch_uint a) { return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(a, 8)), _mm256_set1_ps(1.0f / 16777216.0f)); }
+
+#else
+
+struct batch_uint { unsigned int v[BATCH_WIDTH]; };
+
+inline batch_uint BatchUintLoad(const unsigned int* p) { batch_uint r; for (int i = 0; i < BATCH_WIDTH; i++) r.v[i] = p[i]; return r; }
+inline void BatchUintStore(unsigned int* p, batch_uint a) { for (int i = 0; i < BATCH_WIDTH; i++) p[i] = a.v[i]; }
+inline batch_uint BatchUintSet(unsigned int x) { batch_uint r; for (int i = 0; i < BATCH_WIDTH; i++) r.v[i] = x; return r; }
+inline batch_uint BatchUintAdd(batch_uint a, batch_uint b) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] += b.v[i]; return a; }
+// Low 32 bits of the products
+inline batch_uint BatchUintMul(batch_uint a, batch_uint b) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] *= b.v[i]; return a; }
+inline batch_uint BatchUintXor(batch_uint a, batch_uint b) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] ^= b.v[i]; return a; }
+inline batch_uint BatchUintShiftRight(batch_uint a, int bits) { for (int i = 0; i < BATCH_WIDTH; i++) a.v[i] >>= bits; return a; }
+// Top 24 bits as a float in [0, 1)
+inline batch_float BatchUintToUnit(batch_uint a) { batch_float r; for (int i = 0; i < BATCH_WIDTH; i++) r.v[i] = (a.v[i] >> 8) * (1.0f / 16777216.0f); return r; }
+
+#endif
+
+#pragma endregion
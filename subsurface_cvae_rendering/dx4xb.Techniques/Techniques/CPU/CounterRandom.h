@@ -0,0 +1,423 @@
+#pragma once
+
+#include <math.h>
+#include "dx4xb_platform.h"
+#include "BatchFloat.h"
+#include "Stopwatch.h"
+
+// Dimensions of the streams of the rays. The counter-based streams only use MaxBounces.
+struct RandomStreamGrid {
+	unsigned int Width;
+	unsigned int Height;
+	unsigned int MaxBounces;
+};
+
+/// pcg4d of Jarzynski and Olano (Hash Functions for GPU Rendering), the hash of the counter-based streams in Tools/Randoms.h.
+inline void PCG4D(unsigned int v[4]) {
+	for (int i = 0; i < 4; i++)
+		v[i] = v[i] * 1664525u + 1013904223u;
+	v[0] += v[1] * v[3];
+	v[1] += v[2] * v[0];
+	v[2] += v[0] * v[1];
+	v[3] += v[1] * v[2];
+	for (int i = 0; i < 4; i++)
+		v[i] ^= v[i] >> 16;
+	v[0] += v[1] * v[3];
+	v[1] += v[2] * v[0];
+	v[2] += v[0] * v[1];
+	v[3] += v[1] * v[2];
+}
+
+/// Counter-based stream of random numbers of a ray, the same numbers than random() in Tools/Randoms.h.
+/// The n-th number of the stream of (x, y, bounce, frame) is the lane n % 4 of pcg4d(x, y, frame * MaxBounces + bounce, n / 4).
+struct CounterRandom {
+	// (x, y, frame * MaxBounces + bounce, index of the next number), as rng_state in the shaders
+	unsigned int State[4];
+	unsigned int Block[4];
+
+	void Start(const RandomStreamGrid& grid, unsigned int x, unsigned int y, unsigned int bounce, unsigned int frame) {
+		State[0] = x;
+		State[1] = y;
+		State[2] = frame * grid.MaxBounces + bounce;
+		State[3] = 0;
+	}
+
+	// Jumps over the next count numbers of the stream.
+	inline void Skip(unsigned int count) {
+		State[3] += count;
+		if ((State[3] & 3) != 0)
+			LoadBlock();
+	}
+
+	inline unsigned int NextBits() {
+		unsigned int lane = State[3] & 3;
+		if (lane == 0)
+			LoadBlock();
+		State[3]++;
+		return Block[lane];
+	}
+
+	// Uniform in [0, 1) with the top 24 bits.
+	inline float Next() {
+		return (NextBits() >> 8) * (1.0f / 16777216.0f);
+	}
+
+private:
+	inline void LoadBlock() {
+		Block[0] = State[0];
+		Block[1] = State[1];
+		Block[2] = State[2];
+		Block[3] = State[3] >> 2;
+		PCG4D(Block);
+	}
+};
+
+/// BATCH_WIDTH counter-based streams drawing their numbers together, lane l is the stream of (X[l], Y[l], bounce, frame)
+/// and gives the same numbers than CounterRandom. The hash is evaluated for the BATCH_WIDTH lanes at once with batch_uint.
+class CounterRandomBatch {
+	unsigned int x[BATCH_WIDTH];
+	unsigned int y[BATCH_WIDTH];
+	unsigned int z = 0;
+	unsigned int counter = 0;
+	batch_uint block[4];
+
+	void LoadBlock() {
+		batch_uint v[4] = { BatchUintLoad(x), BatchUintLoad(y), BatchUintSet(z), BatchUintSet(counter >> 2) };
+		batch_uint a = BatchUintSet(1664525u), c = BatchUintSet(1013904223u);
+		for (int i = 0; i < 4; i++)
+			v[i] = BatchUintAdd(BatchUintMul(v[i], a), c);
+		for (int round = 0; round < 2; round++)
+		{
+			v[0] = BatchUintAdd(v[0], BatchUintMul(v[1], v[3]));
+			v[1] = BatchUintAdd(v[1], BatchUintMul(v[2], v[0]));
+			v[2] = BatchUintAdd(v[2], BatchUintMul(v[0], v[1]));
+			v[3] = BatchUintAdd(v[3], BatchUintMul(v[1], v[2]));
+			if (round == 0)
+				for (int i = 0; i < 4; i++)
+					v[i] = BatchUintXor(v[i], BatchUintShiftRight(v[i], 16));
+		}
+		for (int i = 0; i < 4; i++)
+			block[i] = v[i];
+	}
+
+public:
+	// Streams of the pixels of X and Y (BATCH_WIDTH each).
+	void Start(const RandomStreamGrid& grid, const unsigned int* X, const unsigned int* Y, unsigned int bounce, unsigned int frame) {
+		for (int l = 0; l < BATCH_WIDTH; l++)
+		{
+			x[l] = X[l];
+			y[l] = Y[l];
+		}
+		z = frame * grid.MaxBounces + bounce;
+		counter = 0;
+	}
+
+	// Streams of BATCH_WIDTH consecutive pixels of a row starting at (firstX, y).
+	void StartRow(const RandomStreamGrid& grid, unsigned int firstX, unsigned int y, unsigned int bounce, unsigned int frame) {
+		unsigned int X[BATCH_WIDTH], Y[BATCH_WIDTH];
+		for (int l = 0; l < BATCH_WIDTH; l++)
+		{
+			X[l] = firstX + l;
+			Y[l] = y;
+		}
+		Start(grid, X, Y, bounce, frame);
+	}
+
+	// Jumps over the next count numbers of all streams.
+	inline void Skip(unsigned int count) {
+		counter += count;
+		if ((counter & 3) != 0)
+			LoadBlock();
+	}
+
+	inline batch_uint NextBits() {
+		unsigned int lane = counter & 3;
+		if (lane == 0)
+			LoadBlock();
+		counter++;
+		return block[lane];
+	}
+
+	// Uniforms in [0, 1) with the top 24 bits.
+	inline batch_float Next() {
+		return BatchUintToUnit(NextBits());
+	}
+};
+
+/// HybridTaus of Tools/Randoms.h (RANDOMS_HYBRID_TAUS) with its seeding: the four components start with the index of the ray
+/// and 23 + index % 13 numbers are discarded. Kept to compare with the counter-based streams.
+struct HybridTausRandom {
+	unsigned int State[4];
+
+	static inline unsigned int TausStep(unsigned int z, int S1, int S2, int S3, unsigned int M) {
+		unsigned int b = (((z << S1) ^ z) >> S2);
+		return ((z & M) << S3) ^ b;
+	}
+
+	void Start(const RandomStreamGrid& grid, unsigned int x, unsigned int y, unsigned int bounce, unsigned int frame) {
+		unsigned int index = x + grid.Width * (y + grid.Height * (bounce + grid.MaxBounces * frame));
+		State[0] = State[1] = State[2] = State[3] = index;
+		for (unsigned int i = 0; i < 23 + index % 13; i++)
+			NextBits();
+	}
+
+	inline void Skip(unsigned int count) {
+		for (unsigned int i = 0; i < count; i++)
+			NextBits();
+	}
+
+	inline unsigned int NextBits() {
+		State[0] = TausStep(State[0], 13, 19, 12, 4294967294u);
+		State[1] = TausStep(State[1], 2, 25, 4, 4294967288u);
+		State[2] = TausStep(State[2], 3, 11, 17, 4294967280u);
+		State[3] = 1664525u * State[3] + 1013904223u;
+		return State[0] ^ State[1] ^ State[2] ^ State[3];
+	}
+
+	inline float Next() {
+		return (NextBits() >> 8) * (1.0f / 16777216.0f);
+	}
+};
+
+/// P-values of statistical tests of the streams of the rays of a frame (in the manner of the TestU01 batteries, suspicious
+/// outside [0.001, 0.999]). Streams of a grid of pixels are checked alone and against the streams of the next pixel,
+/// the next bounce and the next frame, where a bad seeding shows first.
+struct RandomQualityReport {
+	long long Numbers;
+	// Chi-square of the top 8 bits of all numbers
+	double FrequencyP;
+	// Chi-square of the ones of every bit (32 degrees of freedom)
+	double BitsP;
+	// Chi-square of pairs of consecutive numbers of a stream (top 6 bits of each)
+	double SerialP;
+	// Chi-square of the top 3 bits of 4 consecutive numbers of a stream (the poker test)
+	double PokerP;
+	// Correlation of consecutive numbers of a stream
+	double LagCorrelationP;
+	// Chi-square of the pairs of the i-th numbers of the streams of two adjacent pixels, bounces and frames
+	double AdjacentPixelsP;
+	double AdjacentBouncesP;
+	double AdjacentFramesP;
+	// Tests with p-values outside [0.001, 0.999]
+	int Suspicious;
+};
+
+// Upper tail of the chi-square distribution (Wilson-Hilferty approximation, good for the degrees of freedom of the tests).
+inline double ChiSquareP(double chiSquare, int degrees) {
+	double k = degrees;
+	double z = (pow(chiSquare / k, 1.0 / 3) - (1 - 2 / (9 * k))) / sqrt(2 / (9 * k));
+	return 0.5 * erfc(z / sqrt(2.0));
+}
+
+inline double ChiSquare(const long long* counts, int bins, long long total) {
+	double expected = total / (double)bins;
+	double chiSquare = 0;
+	for (int i = 0; i < bins; i++)
+		chiSquare += (counts[i] - expected) * (counts[i] - expected) / expected;
+	return chiSquare;
+}
+
+/// Runs the tests on the streams of a width x height grid with numbers numbers per stream (at least 4).
+/// Generator has Start(grid, x, y, bounce, frame) and NextBits() as CounterRandom and HybridTausRandom.
+template<typename Generator>
+inline RandomQualityReport CheckRandomQuality(unsigned int width = 256, unsigned int height = 256, int numbers = 16,
+	unsigned int frame = 1) {
+	RandomStreamGrid grid = { width, height, 4 };
+	numbers = max(4, numbers / 4 * 4);
+	RandomQualityReport report = {};
+
+	long long* frequency = new long long[256]();
+	long long* serial = new long long[4096]();
+	long long* poker = new long long[4096]();
+	long long* pixels = new long long[4096]();
+	long long* bounces = new long long[4096]();
+	long long* frames = new long long[4096]();
+	long long bits[32] = {};
+	long long pairs = 0, serialPairs = 0, pokerHands = 0;
+	double sumX = 0, sumY = 0, sumXY = 0, sumXX = 0, sumYY = 0;
+	long long lagPairs = 0;
+
+	unsigned int* stream = new unsigned int[numbers];
+	unsigned int* previousRow = new unsigned int[(size_t)width * numbers];
+	unsigned int* other = new unsigned int[numbers];
+	Generator generator;
+	for (unsigned int y = 0; y < height; y++)
+		for (unsigned int x = 0; x < width; x++)
+		{
+			generator.Start(grid, x, y, 0, frame);
+			for (int i = 0; i < numbers; i++)
+				stream[i] = generator.NextBits();
+
+			for (int i = 0; i < numbers; i++)
+			{
+				unsigned int v = stream[i];
+				frequency[v >> 24]++;
+				for (int b = 0; b < 32; b++)
+					bits[b] += (v >> b) & 1;
+				if (i > 0)
+				{
+					double a = stream[i - 1] * (1.0 / 4294967296.0), c = v * (1.0 / 4294967296.0);
+					sumX += a; sumY += c; sumXY += a * c; sumXX += a * a; sumYY += c * c;
+					lagPairs++;
+				}
+			}
+			for (int i = 0; i + 1 < numbers; i += 2)
+			{
+				serial[((stream[i] >> 26) << 6) | (stream[i + 1] >> 26)]++;
+				serialPairs++;
+			}
+			for (int i = 0; i + 3 < numbers; i += 4)
+			{
+				poker[((stream[i] >> 29) << 9) | ((stream[i + 1] >> 29) << 6) | ((stream[i + 2] >> 29) << 3) | (stream[i + 3] >> 29)]++;
+				pokerHands++;
+			}
+
+			// previous pixel of the row (the streams of consecutive indices)
+			if (x > 0)
+				for (int i = 0; i < numbers; i++)
+					pixels[((previousRow[(x - 1) * numbers + i] >> 26) << 6) | (stream[i] >> 26)]++;
+			memcpy(previousRow + (size_t)x * numbers, stream, sizeof(unsigned int) * numbers);
+
+			generator.Start(grid, x, y, 1, frame);
+			for (int i = 0; i < numbers; i++)
+				other[i] = generator.NextBits();
+			for (int i = 0; i < numbers; i++)
+				bounces[((stream[i] >> 26) << 6) | (other[i] >> 26)]++;
+
+			generator.Start(grid, x, y, 0, frame + 1);
+			for (int i = 0; i < numbers; i++)
+				other[i] = generator.NextBits();
+			for (int i = 0; i < numbers; i++)
+				frames[((stream[i] >> 26) << 6) | (other[i] >> 26)]++;
+			pairs += numbers;
+		}
+
+	long long total = (long long)width * height * numbers;
+	report.Numbers = total;
+	report.FrequencyP = ChiSquareP(ChiSquare(frequency, 256, total), 255);
+	double bitsChiSquare = 0;
+	for (int b = 0; b < 32; b++)
+	{
+		double z = (bits[b] - total * 0.5) / sqrt(total * 0.25);
+		bitsChiSquare += z * z;
+	}
+	report.BitsP = ChiSquareP(bitsChiSquare, 32);
+	report.SerialP = ChiSquareP(ChiSquare(serial, 4096, serialPairs), 4095);
+	report.PokerP = ChiSquareP(ChiSquare(poker, 4096, pokerHands), 4095);
+	double n = (double)lagPairs;
+	double correlation = (sumXY - sumX * sumY / n) / sqrt((sumXX - sumX * sumX / n) * (sumYY - sumY * sumY / n));
+	report.LagCorrelationP = erfc(fabs(correlation) * sqrt(n) / sqrt(2.0));
+	report.AdjacentPixelsP = ChiSquareP(ChiSquare(pixels, 4096, pairs - (long long)height * numbers), 4095);
+	report.AdjacentBouncesP = ChiSquareP(ChiSquare(bounces, 4096, pairs), 4095);
+	report.AdjacentFramesP = ChiSquareP(ChiSquare(frames, 4096, pairs), 4095);
+
+	double p[] = { report.FrequencyP, report.BitsP, report.SerialP, report.PokerP, report.LagCorrelationP,
+		report.AdjacentPixelsP, report.AdjacentBouncesP, report.AdjacentFramesP };
+	for (int i = 0; i < 8; i++)
+		report.Suspicious += p[i] < 0.001 || p[i] > 0.999;
+
+	delete[] frequency;
+	delete[] serial;
+	delete[] poker;
+	delete[] pixels;
+	delete[] bounces;
+	delete[] frames;
+	delete[] stream;
+	delete[] previousRow;
+	delete[] other;
+	return report;
+}
+
+/// Single thread cost of starting the stream of a ray and drawing its numbers.
+struct RandomCostReport {
+	int NumbersPerRay;
+	// Nanoseconds per ray of HybridTaus with the warm-up, of CounterRandom and of CounterRandomBatch
+	float HybridTausNanoseconds;
+	float CounterNanoseconds;
+	float CounterBatchNanoseconds;
+	// Nanoseconds of starting a stream and jumping over 1000 numbers, discarding them with HybridTaus
+	float HybridTausSkipNanoseconds;
+	float CounterSkipNanoseconds;
+	// Lanes of the batch that differ from CounterRandom (must be 0)
+	int BatchMismatches;
+};
+
+inline RandomCostReport MeasureRandomCost(unsigned int width = 512, unsigned int height = 512, int numbersPerRay = 8) {
+	RandomStreamGrid grid = { width, height, 4 };
+	width = max(BATCH_WIDTH, width / BATCH_WIDTH * BATCH_WIDTH);
+	RandomCostReport report = {};
+	report.NumbersPerRay = numbersPerRay;
+	double rays = (double)width * height;
+	// sums of the numbers keep the draws from being removed
+	volatile unsigned int sink = 0;
+
+	auto measure = [&](auto& generator) {
+		unsigned int sum = 0;
+		Stopwatch stopwatch;
+		for (unsigned int y = 0; y < height; y++)
+			for (unsigned int x = 0; x < width; x++)
+			{
+				generator.Start(grid, x, y, 0, 1);
+				for (int i = 0; i < numbersPerRay; i++)
+					sum += generator.NextBits();
+			}
+		sink = sink + sum;
+		return (float)(stopwatch.Milliseconds() * 1000000.0 / rays);
+	};
+	HybridTausRandom hybridTaus;
+	CounterRandom counter;
+	report.HybridTausNanoseconds = measure(hybridTaus);
+	report.CounterNanoseconds = measure(counter);
+
+	unsigned int lanes[BATCH_WIDTH];
+	batch_uint sum = BatchUintSet(0);
+	CounterRandomBatch batch;
+	Stopwatch stopwatch;
+	for (unsigned int y = 0; y < height; y++)
+		for (unsigned int x = 0; x < width; x += BATCH_WIDTH)
+		{
+			batch.StartRow(grid, x, y, 0, 1);
+			for (int i = 0; i < numbersPerRay; i++)
+				sum = BatchUintAdd(sum, batch.NextBits());
+		}
+	report.CounterBatchNanoseconds = (float)(stopwatch.Milliseconds() * 1000000.0 / rays);
+	BatchUintStore(lanes, sum);
+	sink = sink + lanes[0];
+
+	// the batch against the scalar streams
+	for (unsigned int y = 0; y < min(height, 16u); y++)
+		for (unsigned int x = 0; x < width; x += BATCH_WIDTH)
+		{
+			batch.StartRow(grid, x, y, 1, 2);
+			batch.Skip(3);
+			for (int i = 0; i < numbersPerRay; i++)
+			{
+				BatchUintStore(lanes, batch.NextBits());
+				for (int l = 0; l < BATCH_WIDTH; l++)
+				{
+					counter.Start(grid, x + l, y, 1, 2);
+					counter.Skip(3 + i);
+					report.BatchMismatches += counter.NextBits() != lanes[l];
+				}
+			}
+		}
+
+	int skips = 10000;
+	stopwatch.Start();
+	for (int i = 0; i < skips / 100; i++)
+	{
+		hybridTaus.Start(grid, i, 0, 0, 1);
+		hybridTaus.Skip(1000);
+		sink = sink + hybridTaus.NextBits();
+	}
+	report.HybridTausSkipNanoseconds = stopwatch.Milliseconds() * 1000000.0f / (skips / 100);
+	stopwatch.Start();
+	for (int i = 0; i < skips; i++)
+	{
+		counter.Start(grid, i, 0, 0, 1);
+		counter.Skip(1000);
+		sink = sink + counter.NextBits();
+	}
+	report.CounterSkipNanoseconds = stopwatch.Milliseconds() * 1000000.0f / skips;
+	return report;
+}
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "dx4xb_math.h"
+
+using namespace dx4xb;
+
+// CPU version of Tools/Distances.h.
+// Functions are kept line by line equivalent to the HLSL ones, so fields built on the CPU match the GPU fields.
+
+/// Distance from point to point
+inline float distanceP2P(float3 a, float3 b)
+{
+	return length(a - b);
+}
+
+/// Distance from point to segment
+inline float distanceP2S(float3 p, float3 a, float3 b, float3& closest)
+{
+	float3 b_a = a - b;
+	float alpha = dot(p - b, b_a) / dot(b_a, b_a);
+	closest = lerp(b, a, float3(saturate(alpha)));
+	return distanceP2P(p, closest);
+}
+
+/// Distance from point to segment
+inline float distanceP2S(float3 p, float3 a, float3 b)
+{
+	float3 closest;
+	return distanceP2S(p, a, b, closest);
+}
+
+/// Distance from point to a plane (given by a position and normal)
+inline float distanceP2X(float3 p, float3 P, float3 N, float3& closest)
+{
+	closest = p - N * dot(p - P, N);
+	return fabsf(dot(p - closest, N));
+}
+
+/// Distance from point to a plane (given by a position and normal)
+inline float distanceP2X(float3 p, float3 P, float3 N)
+{
+	float3 closest;
+	return distanceP2X(p, P, N, closest);
+}
+
+/// Distance from point to a triangle (given by 3 points)
+inline float distanceP2T(float3 p, float3 a, float3 b, float3 c, float3& closest)
+{
+	float3 N = normalize(cross(c - a, b - a));
+	float3 P = a;
+
+	float distance = distanceP2X(p, P, N, closest);
+
+	// mul(N, transpose(M)) with M rows
+	float3 bary = float3(
+		dot(N, cross(b - c, closest - c)),
+		dot(N, cross(c - a, closest - a)),
+		dot(N, cross(a - b, closest - b))
+	);
+	bary = bary / (bary.x + bary.y + bary.z);
+
+	if (bary.x >= 0 && bary.y >= 0 && bary.z >= 0)
+		return distance;
+
+	if (bary.x < 0)
+		return distanceP2S(p, c, b, closest);
+	if (bary.y < 0)
+		return distanceP2S(p, c, a, closest);
+	return distanceP2S(p, b, a, closest);
+}
+
+/// Distance from point to a triangle (given by 3 points)
+inline float distanceP2T(float3 p, float3 a, float3 b, float3 c)
+{
+	float3 closest;
+	return distanceP2T(p, a, b, c, closest);
+}
+
+/// Distance between segments
+inline float distanceS2S(float3 a1, float3 b1, float3 a2, float3 b2, float3& closest1, float3& closest2)
+{
+	float3 u = b1 - a1;
+	float3 v = b2 - a2;
+	float3 w = a1 - a2;
+	float a = dot(u, u);         // always >= 0
+	float b = dot(u, v);
+	float c = dot(v, v);         // always >= 0
+	float d = dot(u, w);
+	float e = dot(v, w);
+	float D = a * c - b * b;        // always >= 0
+	float sc, sN, sD = D;       // sc = sN / sD, default sD = D >= 0
+	float tc, tN, tD = D;       // tc = tN / tD, default tD = D >= 0
+
+	// compute the line parameters of the two closest points
+	if (D < 0.00001)
+	{ // the lines are almost parallel
+		sN = 0.0f;         // force using point P0 on segment S1
+		sD = 1.0f;         // to prevent possible division by 0.0 later
+		tN = e;
+		tD = c;
+	}
+	else
+	{                 // get the closest points on the infinite lines
+		sN = (b * e - c * d);
+		tN = (a * e - b * d);
+		if (sN < 0.0)
+		{        // sc < 0 => the s=0 edge is visible
+			sN = 0.0f;
+			tN = e;
+			tD = c;
+		}
+		else if (sN > sD)
+		{  // sc > 1  => the s=1 edge is visible
+			sN = sD;
+			tN = e + b;
+			tD = c;
+		}
+	}
+
+	if (tN < 0.0)
+	{            // tc < 0 => the t=0 edge is visible
+		tN = 0.0f;
+		// recompute sc for this edge
+		if (-d < 0.0)
+			sN = 0.0f;
+		else if (-d > a)
+			sN = sD;
+		else
+		{
+			sN = -d;
+			sD = a;
+		}
+	}
+	else if (tN > tD)
+	{      // tc > 1  => the t=1 edge is visible
+		tN = tD;
+		// recompute sc for this edge
+		if ((-d + b) < 0.0)
+			sN = 0;
+		else if ((-d + b) > a)
+			sN = sD;
+		else
+		{
+			sN = (-d + b);
+			sD = a;
+		}
+	}
+	// finally do the division to get sc and tc
+	sc = (fabsf(sN) < 0.00001 ? 0.0f : sN / sD);
+	tc = (fabsf(tN) < 0.00001 ? 0.0f : tN / tD);
+
+	// get the two closest points
+	closest1 = a1 + (u * sc);
+	closest2 = a2 + (v * tc);
+
+	return distanceP2P(closest1, closest2);   // return the closest distance
+}
+
+/// Distance between segments
+inline float distanceS2S(float3 a1, float3 b1, float3 a2, float3 b2)
+{
+	float3 closest1;
+	float3 closest2;
+	return distanceS2S(a1, b1, a2, b2, closest1, closest2);
+}
+
+/// Distance segment (given by two points) to triangle (given by 3 points)
+inline float distanceS2T(float3 a, float3 b, float3 t1, float3 t2, float3 t3)
+{
+	// Assume is in an edge of the triangle
+	float distance = distanceP2P(a, t1);
+
+	distance = minf(distance, distanceS2S(a, b, t1, t2));
+	distance = minf(distance, distanceS2S(a, b, t2, t3));
+	distance = minf(distance, distanceS2S(a, b, t3, t1));
+
+	// Assume is an interior point
+	distance = minf(distance, distanceP2T(a, t1, t2, t3));
+	distance = minf(distance, distanceP2T(b, t1, t2, t3));
+
+	return distance;
+}
+
+/// Distance from a quad C, C+U, C+U+R, C+R to a triangle
+inline float distanceQ2T(float3 C, float3 U, float3 R, float3 N, float3 t1, float3 t2, float3 t3)
+{
+	float3 p00 = C;
+	float3 p01 = C + R;
+	float3 p10 = C + U;
+	float3 p11 = C + U + R;
+
+	float3 ed[4] = { p00, p01, p11, p10 };
+
+	float dist = 1000000;
+	for (int i = 0; i < 4; i++) // Assume, the closest point is in an edge.
+		dist = minf(dist, distanceS2T(ed[i], ed[(i + 1) % 4], t1, t2, t3));
+
+	float3 t[3] = { t1, t2, t3 };
+	for (int i = 0; i < 3; i++) // Assume the closest point is inside, i.e. a vertex of the triangle
+	{
+		// Project t[i] on plane C, N
+		float3 tp;
+		distanceP2X(t[i], C, N, tp);
+		float cx = dot(tp - C, R);
+		float cy = dot(tp - C, U);
+		if (cx >= 0 && cy >= 0 && cx <= 1 && cy <= 1) // inside side
+			dist = minf(dist, distanceP2T(tp, t1, t2, t3));
+	}
+
+	return dist;
+}
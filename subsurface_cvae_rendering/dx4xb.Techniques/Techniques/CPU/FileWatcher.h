@@ -0,0 +1,69 @@
+#pragma once
+
+#include "dx4xb_platform.h"
+#include <string.h>
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+/// Detects changes of a file by polling its last write time (cheap enough to be checked every frame).
+/// A change is reported until it is accepted. Readers accept a version even if it can not be read, so a bad file
+/// is not read every frame, a file caught while being written is reported again when the writer finishes.
+class FileWatcher {
+#ifdef _WIN32
+	typedef FILETIME WriteTime;
+#else
+	typedef struct timespec WriteTime;
+#endif
+	char fileName[MAX_PATH] = {};
+	WriteTime accepted = {};
+	// Time seen by the last Changed, accepted later if the file could be read
+	mutable WriteTime seen = {};
+	bool hasAccepted = false;
+
+	bool LastWriteTime(WriteTime& time) const {
+#ifdef _WIN32
+		WIN32_FILE_ATTRIBUTE_DATA data;
+		if (!GetFileAttributesExA(fileName, GetFileExInfoStandard, &data))
+			return false;
+		time = data.ftLastWriteTime;
+#else
+		struct stat status;
+		if (stat(fileName, &status) != 0)
+			return false;
+		time = status.st_mtim;
+#endif
+		return true;
+	}
+
+	static bool SameTime(const WriteTime& a, const WriteTime& b) {
+#ifdef _WIN32
+		return CompareFileTime(&a, &b) == 0;
+#else
+		return a.tv_sec == b.tv_sec && a.tv_nsec == b.tv_nsec;
+#endif
+	}
+
+public:
+	// Starts watching a file. The current file (if any) is reported as a change.
+	void Watch(const char* fileName) {
+		strcpy_s(this->fileName, fileName);
+		hasAccepted = false;
+	}
+
+	// Gets if the file exists and was written after the last accepted version.
+	bool Changed() const {
+		WriteTime time;
+		if (!LastWriteTime(time))
+			return false;
+		seen = time;
+		return !hasAccepted || !SameTime(time, accepted);
+	}
+
+	// Marks the version of the file reported by the last Changed as read.
+	// A newer write between both calls is reported again.
+	void Accept() {
+		accepted = seen;
+		hasAccepted = true;
+	}
+};
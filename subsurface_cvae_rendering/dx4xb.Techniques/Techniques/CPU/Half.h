@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string.h>
+
+// IEEE 754 half precision (binary16) conversions, same values than DXGI_FORMAT_R16_FLOAT and min16float on the GPU.
+
+// Rounds to the nearest half (ties to even). Values beyond 65504 become infinity, NaN is kept.
+inline unsigned short FloatToHalf(float value) {
+	unsigned int bits;
+	memcpy(&bits, &value, 4);
+	unsigned short sign = (unsigned short)((bits >> 16) & 0x8000);
+	bits &= 0x7FFFFFFF;
+
+	if (bits >= 0x7F800000) // infinity or NaN
+		return sign | 0x7C00 | (bits > 0x7F800000 ? 0x200 : 0);
+	if (bits >= 0x477FF000) // 65520 and above round to infinity
+		return sign | 0x7C00;
+	if (bits < 0x38800000) // below 2^-14, subnormal halves are multiples of 2^-24 (the ulp of 0.5)
+	{
+		float magnitude;
+		memcpy(&magnitude, &bits, 4);
+		magnitude += 0.5f;
+		memcpy(&bits, &magnitude, 4);
+		return sign | (unsigned short)(bits - 0x3F000000);
+	}
+	// rebias the exponent (127 - 15) and round the 13 discarded bits
+	bits += 0xC8000FFF + ((bits >> 13) & 1);
+	return sign | (unsigned short)(bits >> 13);
+}
+
+inline float HalfToFloat(unsigned short half) {
+	unsigned int sign = (unsigned int)(half & 0x8000) << 16;
+	unsigned int exponent = (half >> 10) & 0x1F;
+	unsigned int mantissa = half & 0x3FF;
+	unsigned int bits;
+	if (exponent == 0) // zero or subnormal
+	{
+		float magnitude = mantissa * (1.0f / 16777216.0f);
+		memcpy(&bits, &magnitude, 4);
+	}
+	else if (exponent == 31) // infinity or NaN
+		bits = 0x7F800000 | (mantissa << 13);
+	else
+		bits = ((exponent + 112) << 23) | (mantissa << 13);
+	bits |= sign;
+	float value;
+	memcpy(&value, &bits, 4);
+	return value;
+}
+
+// Value of x stored as a half.
+inline float RoundToHalf(float x) {
+	return HalfToFloat(FloatToHalf(x));
+}
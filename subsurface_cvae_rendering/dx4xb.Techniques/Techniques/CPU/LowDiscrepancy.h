@@ -0,0 +1,458 @@
+#pragma once
+
+#include <math.h>
+#include <string.h>
+#include <stdio.h>
+#include "CounterRandom.h"
+#include "AccumulationStatistics.h"
+#include "Stopwatch.h"
+
+// Dimensions of the Sobol points. Further dimensions are taken from other groups of 4 with shuffled indices (padding).
+#define SOBOL_DIMENSIONS 4
+// Side of the blue-noise tile (power of 2)
+#define BLUE_NOISE_TILE 64
+// Powers of 2 of samples per pixel measured by the convergence harness
+#define CONVERGENCE_LEVELS 12
+
+/// Direction numbers of the first 4 dimensions of the Sobol sequence (Joe and Kuo), bit k of dimension d at [d * 32 + k].
+/// The same table is in Tools/LowDiscrepancy.h.
+static const unsigned int SobolDirections[SOBOL_DIMENSIONS * 32] = {
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x08000000, 0x04000000, 0x02000000, 0x01000000,
+	0x00800000, 0x00400000, 0x00200000, 0x00100000, 0x00080000, 0x00040000, 0x00020000, 0x00010000,
+	0x00008000, 0x00004000, 0x00002000, 0x00001000, 0x00000800, 0x00000400, 0x00000200, 0x00000100,
+	0x00000080, 0x00000040, 0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001,
+
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0xcc000000, 0xaa000000, 0xff000000,
+	0x80800000, 0xc0c00000, 0xa0a00000, 0xf0f00000, 0x88880000, 0xcccc0000, 0xaaaa0000, 0xffff0000,
+	0x80008000, 0xc000c000, 0xa000a000, 0xf000f000, 0x88008800, 0xcc00cc00, 0xaa00aa00, 0xff00ff00,
+	0x80808080, 0xc0c0c0c0, 0xa0a0a0a0, 0xf0f0f0f0, 0x88888888, 0xcccccccc, 0xaaaaaaaa, 0xffffffff,
+
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xe8000000, 0x5c000000, 0x8e000000, 0xc5000000,
+	0x68800000, 0x9cc00000, 0xee600000, 0x55900000, 0x80680000, 0xc09c0000, 0x60ee0000, 0x90550000,
+	0xe8808000, 0x5cc0c000, 0x8e606000, 0xc5909000, 0x6868e800, 0x9c9c5c00, 0xeeee8e00, 0x5555c500,
+	0x8000e880, 0xc0005cc0, 0x60008e60, 0x9000c590, 0xe8006868, 0x5c009c9c, 0x8e00eeee, 0xc5005555,
+
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xf8000000, 0x74000000, 0xa2000000, 0x93000000,
+	0xd8800000, 0x25400000, 0x59e00000, 0xe6d00000, 0x78080000, 0xb40c0000, 0x82020000, 0xc3050000,
+	0x208f8000, 0x51474000, 0xfbea2000, 0x75d93000, 0xa0858800, 0x914e5400, 0xdbe79e00, 0x25db6d00,
+	0x58800080, 0xe54000c0, 0x79e00020, 0xb6d00050, 0x800800f8, 0xc00c0074, 0x200200a2, 0x50050093
+};
+
+inline unsigned int ReverseBits32(unsigned int x) {
+	x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+	x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+	x = ((x >> 4) & 0x0f0f0f0fu) | ((x & 0x0f0f0f0fu) << 4);
+	x = ((x >> 8) & 0x00ff00ffu) | ((x & 0x00ff00ffu) << 8);
+	return (x >> 16) | (x << 16);
+}
+
+// Hash of Laine and Karras where every bit only depends on the lower bits (a nested uniform scramble of the reversed bits).
+inline unsigned int LaineKarrasPermutation(unsigned int x, unsigned int seed) {
+	x += seed;
+	x ^= x * 0x6c50b47cu;
+	x ^= x * 0xb82f1e52u;
+	x ^= x * 0xc7afe638u;
+	x ^= x * 0x8d22f6e6u;
+	return x;
+}
+
+/// Owen scramble of base 2 (Burley, Practical Hash-based Owen Scrambling): flipping a bit depends on the seed and the higher bits.
+inline unsigned int NestedUniformScramble(unsigned int x, unsigned int seed) {
+	return ReverseBits32(LaineKarrasPermutation(ReverseBits32(x), seed));
+}
+
+inline unsigned int HashCombine(unsigned int seed, unsigned int v) {
+	return seed ^ (v + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+}
+
+// Bits of the coordinate dimension (< SOBOL_DIMENSIONS) of the index-th Sobol point.
+inline unsigned int SobolBits(unsigned int index, int dimension) {
+	const unsigned int* directions = SobolDirections + dimension * 32;
+	unsigned int x = 0;
+	for (int bit = 0; index != 0; bit++, index >>= 1)
+		x ^= (index & 1) * directions[bit];
+	return x;
+}
+
+/// Bits of any dimension of the index-th point of the Owen-scrambled Sobol sequence of a seed.
+/// Dimensions are taken in groups of 4 with an own seed and an own shuffle of the indices, so the first two dimensions of
+/// every group are a (0,2)-sequence and the groups are decorrelated (shuffled scrambled Sobol of Burley).
+inline unsigned int OwenSobolBits(unsigned int index, unsigned int dimension, unsigned int seed) {
+	unsigned int groupSeed = HashCombine(seed, dimension / SOBOL_DIMENSIONS);
+	unsigned int shuffled = NestedUniformScramble(index, groupSeed);
+	unsigned int x = SobolBits(shuffled, dimension % SOBOL_DIMENSIONS);
+	return NestedUniformScramble(x, HashCombine(groupSeed, 0x5bd1e995u + dimension % SOBOL_DIMENSIONS));
+}
+
+inline float OwenSobol(unsigned int index, unsigned int dimension, unsigned int seed) {
+	return (OwenSobolBits(index, dimension, seed) >> 8) * (1.0f / 16777216.0f);
+}
+
+/// Blue-noise tile of BLUE_NOISE_TILE x BLUE_NOISE_TILE values built with the void-and-cluster method (Ulichney).
+/// Values are the ranks of the pixels in (0, 1), every threshold of the tile is a blue-noise pattern.
+/// Uploaded as StructuredBuffer<float> BlueNoiseTile of Tools/LowDiscrepancy.h, or saved as raw floats.
+class BlueNoiseTile {
+	int size = 0;
+	float* values = nullptr;
+
+public:
+	BlueNoiseTile() {}
+	BlueNoiseTile(const BlueNoiseTile&) = delete;
+	BlueNoiseTile& operator = (const BlueNoiseTile&) = delete;
+
+	~BlueNoiseTile() {
+		delete[] values;
+	}
+
+	int Size() const { return size; }
+	const float* Values() const { return values; }
+	int Count() const { return size * size; }
+
+	// Value of the pixel (x, y) of the tile repeated over the plane.
+	inline float Value(unsigned int x, unsigned int y) const {
+		return values[(y & (size - 1)) * size + (x & (size - 1))];
+	}
+
+	// Builds the tile with a gaussian energy of deviation sigma. size is a power of 2.
+	void Build(int size = BLUE_NOISE_TILE, unsigned int seed = 1, float sigma = 1.5f) {
+		delete[] values;
+		this->size = size;
+		int n = size * size;
+		int mask = size - 1;
+		values = new float[n];
+
+		// energy of a point over the torus
+		float* kernel = new float[n];
+		for (int y = 0; y < size; y++)
+			for (int x = 0; x < size; x++)
+			{
+				int dx = min(x, size - x), dy = min(y, size - y);
+				kernel[y * size + x] = expf(-(dx * dx + dy * dy) / (2 * sigma * sigma));
+			}
+		float* energy = new float[n];
+		bool* pattern = new bool[n];
+		auto splat = [&](float* energy, int p, float sign) {
+			int px = p & mask, py = p / size;
+			for (int y = 0; y < size; y++)
+			{
+				const float* row = kernel + ((y - py) & mask) * size;
+				float* e = energy + y * size;
+				for (int x = 0; x < size; x++)
+					e[x] += sign * row[(x - px) & mask];
+			}
+		};
+		// tightest cluster (max energy) among the points with value state, or the largest void (min energy)
+		auto extreme = [&](const float* energy, bool state, bool largest) {
+			int best = -1;
+			for (int p = 0; p < n; p++)
+				if (pattern[p] == state && (best < 0 || (largest ? energy[p] > energy[best] : energy[p] < energy[best])))
+					best = p;
+			return best;
+		};
+
+		// initial binary pattern with a tenth of random points, relaxed moving tightest clusters to largest voids
+		memset(energy, 0, sizeof(float) * n);
+		memset(pattern, 0, sizeof(bool) * n);
+		unsigned int state = seed * 747796405u + 2891336453u;
+		int ones = max(1, n / 10);
+		for (int placed = 0; placed < ones; )
+		{
+			state ^= state << 13; state ^= state >> 17; state ^= state << 5;
+			int p = state % n;
+			if (!pattern[p])
+			{
+				pattern[p] = true;
+				splat(energy, p, 1);
+				placed++;
+			}
+		}
+		for (int iteration = 0; iteration < n; iteration++)
+		{
+			int cluster = extreme(energy, true, true);
+			pattern[cluster] = false;
+			splat(energy, cluster, -1);
+			int largestVoid = extreme(energy, false, false);
+			pattern[largestVoid] = true;
+			splat(energy, largestVoid, 1);
+			if (largestVoid == cluster)
+				break;
+		}
+
+		int* rank = new int[n];
+		bool* prototype = new bool[n];
+		float* prototypeEnergy = new float[n];
+		memcpy(prototype, pattern, sizeof(bool) * n);
+		memcpy(prototypeEnergy, energy, sizeof(float) * n);
+
+		// phase 1, ranks of the points of the pattern removing tightest clusters
+		for (int r = ones - 1; r >= 0; r--)
+		{
+			int cluster = extreme(energy, true, true);
+			pattern[cluster] = false;
+			splat(energy, cluster, -1);
+			rank[cluster] = r;
+		}
+
+		// phase 2, up to half of the pixels filling largest voids
+		memcpy(pattern, prototype, sizeof(bool) * n);
+		memcpy(energy, prototypeEnergy, sizeof(float) * n);
+		int r = ones;
+		for (; r < n / 2; r++)
+		{
+			int largestVoid = extreme(energy, false, false);
+			pattern[largestVoid] = true;
+			splat(energy, largestVoid, 1);
+			rank[largestVoid] = r;
+		}
+
+		// phase 3, the rest filling the tightest clusters of the empty pixels, now the minority
+		memset(energy, 0, sizeof(float) * n);
+		for (int p = 0; p < n; p++)
+			if (!pattern[p])
+				splat(energy, p, 1);
+		for (; r < n; r++)
+		{
+			int cluster = extreme(energy, false, true);
+			pattern[cluster] = true;
+			splat(energy, cluster, -1);
+			rank[cluster] = r;
+		}
+
+		for (int p = 0; p < n; p++)
+			values[p] = (rank[p] + 0.5f) / n;
+
+		delete[] kernel;
+		delete[] energy;
+		delete[] pattern;
+		delete[] rank;
+		delete[] prototype;
+		delete[] prototypeEnergy;
+	}
+
+	// Saves the values as size * size raw floats. Returns false if the file can not be written.
+	bool Save(const char* fileName) const {
+		FILE* file;
+		if (fopen_s(&file, fileName, "wb"))
+			return false;
+		bool written = fwrite(values, sizeof(float), Count(), file) == (size_t)Count();
+		fclose(file);
+		return written;
+	}
+
+	// Loads a tile saved with Save. Returns false if the file is missing or is not a square power of 2.
+	bool Load(const char* fileName) {
+		FILE* file;
+		if (fopen_s(&file, fileName, "rb"))
+			return false;
+		fseek(file, 0, SEEK_END);
+		long bytes = ftell(file);
+		fseek(file, 0, SEEK_SET);
+		int side = (int)(sqrt(bytes / 4.0) + 0.5);
+		bool loaded = false;
+		if (side > 0 && side * side * 4 == bytes && (side & (side - 1)) == 0)
+		{
+			float* read = new float[side * side];
+			loaded = fread(read, sizeof(float), side * side, file) == (size_t)(side * side);
+			if (loaded)
+			{
+				delete[] values;
+				values = read;
+				size = side;
+			}
+			else
+				delete[] read;
+		}
+		fclose(file);
+		return loaded;
+	}
+};
+
+// Sequences of the samples of a pixel.
+enum class SampleSequence {
+	// Counter-based random streams (CPU/CounterRandom.h) of the frame sampleIndex
+	Random,
+	// Owen-scrambled Sobol with a seed per pixel, errors of the pixels are uncorrelated
+	OwenSobol,
+	// Owen-scrambled Sobol with the same seed for all pixels rotated (Cranley-Patterson) per pixel and dimension with
+	// the blue-noise tile, errors of the pixels are blue noise at low sample counts (Georgiev and Fajardo)
+	BlueNoiseSobol
+};
+
+/// Numbers of the dimensions of a sample of a pixel, as ldrandom() in Tools/LowDiscrepancy.h.
+/// Any dimension can be read in constant time (Get), Next reads consecutive dimensions as random() does.
+struct LowDiscrepancySampler {
+	SampleSequence Sequence = SampleSequence::OwenSobol;
+	// Tile of the rotations of BlueNoiseSobol
+	const BlueNoiseTile* Tile = nullptr;
+	// Seed of the scrambles, e.g. of a bounce or a technique
+	unsigned int Seed = 0;
+
+	void Start(unsigned int x, unsigned int y, unsigned int sampleIndex) {
+		this->x = x;
+		this->y = y;
+		index = sampleIndex;
+		dimension = 0;
+		unsigned int v[4] = { x, y, Seed, 0x2c1b3c6du };
+		PCG4D(v);
+		pixelSeed = v[0];
+	}
+
+	inline unsigned int GetBits(unsigned int dimension) const {
+		switch (Sequence)
+		{
+		case SampleSequence::Random:
+		{
+			RandomStreamGrid grid = { 0, 0, 1 };
+			CounterRandom random;
+			random.Start(grid, x, y, Seed, index);
+			random.Skip(dimension);
+			return random.NextBits();
+		}
+		case SampleSequence::OwenSobol:
+			return OwenSobolBits(index, dimension, pixelSeed);
+		default:
+		{
+			unsigned int h = HashCombine(Seed, dimension);
+			h = LaineKarrasPermutation(h, 0x68e31da4u);
+			float rotation = Tile->Value(x + (h & 0xffff), y + (h >> 16));
+			return OwenSobolBits(index, dimension, Seed) + (unsigned int)(rotation * 4294967296.0);
+		}
+		}
+	}
+
+	// Uniform in [0, 1) of a dimension of the sample.
+	inline float Get(unsigned int dimension) const {
+		return (GetBits(dimension) >> 8) * (1.0f / 16777216.0f);
+	}
+
+	inline float Next() {
+		return Get(dimension++);
+	}
+
+	inline void Skip(unsigned int count) {
+		dimension += count;
+	}
+
+private:
+	unsigned int x = 0;
+	unsigned int y = 0;
+	unsigned int index = 0;
+	unsigned int dimension = 0;
+	unsigned int pixelSeed = 0;
+};
+
+/// Fills count samples of dimensions columns (e.g. TabularSampleBatch::Random) with the points firstIndex...firstIndex+count-1
+/// of the Owen-scrambled Sobol sequence of a seed, column d is the dimension firstDimension + d.
+inline void FillOwenSobol(float* const* columns, int dimensions, int count, unsigned int firstIndex, unsigned int seed,
+	unsigned int firstDimension = 0) {
+	for (int d = 0; d < dimensions; d++)
+	{
+		unsigned int dimension = firstDimension + d;
+		unsigned int groupSeed = HashCombine(seed, dimension / SOBOL_DIMENSIONS);
+		unsigned int scrambleSeed = HashCombine(groupSeed, 0x5bd1e995u + dimension % SOBOL_DIMENSIONS);
+		float* column = columns[d];
+		for (int i = 0; i < count; i++)
+		{
+			unsigned int x = SobolBits(NestedUniformScramble(firstIndex + i, groupSeed), dimension % SOBOL_DIMENSIONS);
+			column[i] = (NestedUniformScramble(x, scrambleSeed) >> 8) * (1.0f / 16777216.0f);
+		}
+	}
+}
+
+/// Error against the samples per pixel of the three sequences estimating a test integral per pixel, with the statistics
+/// the pathtracers accumulate (Accumulation and SqrAccumulation). The same measure of the comparison scenes rendered
+/// with and without RANDOMS_LOW_DISCREPANCY is MeasureSavedConvergence (CPU/AccumulationStatistics.h).
+struct SamplerConvergenceReport {
+	int Levels;
+	int Samples[CONVERGENCE_LEVELS];
+	// Errors of Random, OwenSobol and BlueNoiseSobol at every level
+	AccumulationError Errors[3][CONVERGENCE_LEVELS];
+	// Slope of log RMSE against log samples between the first and last levels (-0.5 for random sampling)
+	float Slope[3];
+	// Time of sampling and evaluating all levels
+	float Milliseconds[3];
+};
+
+/// Pixel of a test scene with the dimensions a pathtracer draws first: a jittered disk edge in the pixel (dimensions 0, 1),
+/// a square area light occluded by a ball (2, 3) and a smooth term on the next group (4, 5) through the padding.
+inline float ConvergenceTestPixel(unsigned int x, unsigned int y, unsigned int width, unsigned int height, LowDiscrepancySampler& sampler) {
+	float px = (x + sampler.Next()) / width - 0.5f;
+	float py = (y + sampler.Next()) / height - 0.5f;
+	float inside = px * px + py * py < 0.16f ? 1.0f : 0.25f;
+	float lx = sampler.Next() - 0.5f, ly = sampler.Next() - 0.5f;
+	// ball of radius 0.3 half way to the light, centered over the point (px, py)
+	float ox = (lx + px) * 0.5f - 0.1f, oy = (ly + py) * 0.5f;
+	float visible = ox * ox + oy * oy < 0.09f ? 0.0f : 1.0f;
+	float a = sampler.Next(), b = sampler.Next();
+	return inside * (0.25f + visible) + 0.5f * a * b;
+}
+
+/// Accumulates ConvergenceTestPixel on a width x height image up to 2^(levels-1) samples with each sequence. The reference is
+/// the mean of referenceSamples samples of OwenSobol with another seed.
+inline SamplerConvergenceReport MeasureSamplerConvergence(int width = 64, int height = 64, int levels = 9, int referenceSamples = 4096) {
+	SamplerConvergenceReport report = {};
+	report.Levels = levels = min(levels, CONVERGENCE_LEVELS);
+	int pixels = width * height;
+
+	BlueNoiseTile tile;
+	tile.Build();
+
+	float* reference = new float[pixels * 4]();
+	LowDiscrepancySampler sampler;
+	sampler.Sequence = SampleSequence::OwenSobol;
+	sampler.Seed = 0x9e3779b9u;
+	for (int y = 0; y < height; y++)
+		for (int x = 0; x < width; x++)
+		{
+			double sum = 0;
+			for (int s = 0; s < referenceSamples; s++)
+			{
+				sampler.Start(x, y, s);
+				sum += ConvergenceTestPixel(x, y, width, height, sampler);
+			}
+			float mean = (float)(sum / referenceSamples);
+			float* r = reference + (y * width + x) * 4;
+			r[0] = r[1] = r[2] = mean;
+		}
+
+	float* sum = new float[pixels * 4];
+	float* sqrSum = new float[pixels * 4];
+	SampleSequence sequences[] = { SampleSequence::Random, SampleSequence::OwenSobol, SampleSequence::BlueNoiseSobol };
+	for (int q = 0; q < 3; q++)
+	{
+		memset(sum, 0, sizeof(float) * pixels * 4);
+		memset(sqrSum, 0, sizeof(float) * pixels * 4);
+		sampler.Sequence = sequences[q];
+		sampler.Tile = &tile;
+		sampler.Seed = 1;
+		int frames = 0;
+		Stopwatch stopwatch;
+		for (int level = 0; level < levels; level++)
+		{
+			int target = 1 << level;
+			for (; frames < target; frames++)
+				for (int y = 0; y < height; y++)
+					for (int x = 0; x < width; x++)
+					{
+						sampler.Start(x, y, frames);
+						float value = ConvergenceTestPixel(x, y, width, height, sampler);
+						float* s = sum + (y * width + x) * 4;
+						float* s2 = sqrSum + (y * width + x) * 4;
+						for (int c = 0; c < 3; c++)
+						{
+							s[c] += value;
+							s2[c] += value * value;
+						}
+					}
+			report.Samples[level] = frames;
+			report.Errors[q][level] = MeasureAccumulation(sum, sqrSum, frames, reference, width, height);
+		}
+		report.Milliseconds[q] = (float)stopwatch.Milliseconds();
+		report.Slope[q] = levels > 1 ? (float)(log((double)report.Errors[q][levels - 1].RMSE / report.Errors[q][0].RMSE) / log((double)report.Samples[levels - 1])) : 0;
+	}
+
+	delete[] reference;
+	delete[] sum;
+	delete[] sqrSum;
+	return report;
+}
@@ -0,0 +1,774 @@
+#pragma once
+
+#include "dx4xb_math.h"
+#include <stdio.h>
+#include <string.h>
+#include "BatchFloat.h"
+#include "Stopwatch.h"
+
+using namespace dx4xb;
+
+#define MLP_MAX_LAYERS 16
+#define MLP_MAX_WIDTH 64
+// Samples evaluated together by EvaluateBatch, activations of a chunk stay in the L1 cache
+#define MLP_BATCH_CHUNK 64
+
+enum class MLPActivation : int {
+	None = 0,
+	Softplus = 1,
+	Sigmoid = 2,
+	Tanh = 3,
+	ReLU = 4
+};
+
+// Storage of the weights used by the evaluations of a model.
+enum class MLPPrecision : int {
+	Float32 = 0,
+	// Weights, bias and activations between layers rounded to halves, products accumulated in fp32
+	// (as min16float math on the GPU with fp32 accumulators).
+	Float16 = 1,
+	// Weights stored as bytes with a scale per output (symmetric per-channel quantization), fp32 bias and activations.
+	Int8 = 2
+};
+
+// Implementation of the activation functions.
+enum class MLPMathMode : int {
+	// C runtime per value, same as the baked shaders. Softplus log(1 + exp(x)) overflows to infinity for x > 88.
+	Reference = 0,
+	// Vectorized and stable (BatchSoftplus, BatchSigmoid, BatchTanh), relative error below 3e-7.
+	Accurate = 1,
+	// Vectorized and stable with shorter polynomials (BatchSoftplusFast, BatchSigmoidFast, BatchTanhFast),
+	// softplus absolute error below 8e-6.
+	Fast = 2
+};
+
+inline float ActivationFunction(MLPActivation activation, float x) {
+	switch (activation)
+	{
+	case MLPActivation::None: return x;
+	case MLPActivation::Softplus: return logf(1 + expf(x)); // same as softplusActivation in the baked shaders
+	case MLPActivation::Sigmoid: return 1 / (1 + expf(-x));
+	case MLPActivation::Tanh: return tanhf(x);
+	case MLPActivation::ReLU: return maxf(0.0f, x);
+	}
+	return x;
+}
+
+inline batch_float BatchActivationFunction(MLPActivation activation, batch_float x, MLPMathMode mode = MLPMathMode::Accurate) {
+	if (mode == MLPMathMode::Reference && activation != MLPActivation::None)
+	{
+		float lanes[BATCH_WIDTH];
+		BatchStore(lanes, x);
+		for (int k = 0; k < BATCH_WIDTH; k++)
+			lanes[k] = ActivationFunction(activation, lanes[k]);
+		return BatchLoad(lanes);
+	}
+	bool fast = mode == MLPMathMode::Fast;
+	switch (activation)
+	{
+	case MLPActivation::None: return x;
+	case MLPActivation::Softplus: return fast ? BatchSoftplusFast(x) : BatchSoftplus(x);
+	case MLPActivation::Sigmoid: return fast ? BatchSigmoidFast(x) : BatchSigmoid(x);
+	case MLPActivation::Tanh: return fast ? BatchTanhFast(x) : BatchTanh(x);
+	case MLPActivation::ReLU: return BatchMax(x, BatchSet(0));
+	}
+	return x;
+}
+
+// Applies an activation to count values of a single sample.
+inline void ActivateValues(MLPActivation activation, MLPMathMode mode, float* values, int count) {
+	if (activation == MLPActivation::None)
+		return;
+	if (mode == MLPMathMode::Reference)
+	{
+		for (int i = 0; i < count; i++)
+			values[i] = ActivationFunction(activation, values[i]);
+		return;
+	}
+	int i = 0;
+	for (; i + BATCH_WIDTH <= count; i += BATCH_WIDTH)
+		BatchStore(values + i, BatchActivationFunction(activation, BatchLoad(values + i), mode));
+	if (i < count)
+	{
+		float lanes[BATCH_WIDTH] = {};
+		for (int k = 0; i + k < count; k++)
+			lanes[k] = values[i + k];
+		BatchStore(lanes, BatchActivationFunction(activation, BatchLoad(lanes), mode));
+		for (int k = 0; i + k < count; k++)
+			values[i + k] = lanes[k];
+	}
+}
+
+/// Evaluates Tile outputs of a layer (starting at output o0) for a chunk of samples.
+/// Activations are stored by feature, i.e. values[feature * MLP_BATCH_CHUNK + sample].
+/// Every input is loaded once and accumulated in Tile registers, weights are broadcast.
+template<int Tile>
+inline void EvaluateBatchTile(const float* in, float* out, const float* W, const float* B,
+	int inputs, int outputs, int o0, MLPActivation activation, MLPMathMode mode, int samples) {
+	for (int s = 0; s < samples; s += BATCH_WIDTH)
+	{
+		batch_float acc[Tile];
+		for (int k = 0; k < Tile; k++)
+			acc[k] = BatchSet(B[o0 + k]);
+		for (int i = 0; i < inputs; i++)
+		{
+			batch_float x = BatchLoad(in + i * MLP_BATCH_CHUNK + s);
+			const float* w = W + i * outputs + o0;
+			for (int k = 0; k < Tile; k++)
+				acc[k] = BatchMulAdd(BatchSet(w[k]), x, acc[k]);
+		}
+		for (int k = 0; k < Tile; k++)
+			BatchStore(out + (o0 + k) * MLP_BATCH_CHUNK + s, BatchActivationFunction(activation, acc[k], mode));
+	}
+}
+
+#pragma region Model files
+
+// Model files are a header followed by an image of Words 32-bit values.
+// Images are flat so they can be uploaded as they are to a StructuredBuffer<float> (integers are read with asint).
+struct ModelFileHeader {
+	unsigned int Magic;
+	int Version;
+	int Words;
+};
+
+#define MODEL_FILE_VERSION 1
+// "MLPM", a single network
+#define MLP_FILE_MAGIC 0x4D504C4D
+
+inline float ImageInt(int value) {
+	float word;
+	memcpy(&word, &value, 4);
+	return word;
+}
+
+inline int ImageInt(float word) {
+	int value;
+	memcpy(&value, &word, 4);
+	return value;
+}
+
+// Reads the image of a model file. Returns null if the file is missing, is not a model file with the given magic,
+// has a newer version or is truncated. The image must be released with delete[].
+inline float* ReadModelFile(const char* fileName, unsigned int magic, int& words) {
+	FILE* file;
+	if (fopen_s(&file, fileName, "rb"))
+		return nullptr;
+
+	float* image = nullptr;
+	ModelFileHeader header;
+	if (fread(&header, sizeof(ModelFileHeader), 1, file) == 1 &&
+		header.Magic == magic && header.Version > 0 && header.Version <= MODEL_FILE_VERSION && header.Words > 0)
+	{
+		image = new float[header.Words];
+		if (fread(image, 4, header.Words, file) != (size_t)header.Words)
+		{
+			delete[] image;
+			image = nullptr;
+		}
+		words = header.Words;
+	}
+	fclose(file);
+	return image;
+}
+
+// Writes a model file. The file is written aside and then renamed, so readers never see a partial file.
+inline bool WriteModelFile(const char* fileName, unsigned int magic, const float* image, int words) {
+	char tempFileName[MAX_PATH];
+	sprintf_s(tempFileName, "%s.tmp", fileName);
+
+	FILE* file;
+	if (fopen_s(&file, tempFileName, "wb"))
+		return false;
+	ModelFileHeader header = { magic, MODEL_FILE_VERSION, words };
+	bool written = fwrite(&header, sizeof(ModelFileHeader), 1, file) == 1 && fwrite(image, 4, words, file) == (size_t)words;
+	fclose(file);
+
+	if (!written || !MoveFileExA(tempFileName, fileName, MOVEFILE_REPLACE_EXISTING))
+	{
+		remove(tempFileName);
+		return false;
+	}
+	return true;
+}
+
+#pragma endregion
+
+/// Dense layer of a multilayer perceptron.
+/// Weights are stored row-major as [Inputs][Outputs] (same as the float4xN blocks in the baked shaders),
+/// i.e. output o = Activation(Bias[o] + sum_i input[i] * Weights[i * Outputs + o]).
+struct MLPLayer {
+	int Inputs;
+	int Outputs;
+	MLPActivation Activation;
+	// Offsets of the weights and bias in the parameters of the model
+	int Weights;
+	int Bias;
+};
+
+/// Multilayer perceptron evaluated on the CPU.
+/// Inputs are normalized as input * InputScale + InputOffset before the first layer and outputs are
+/// output * OutputScale + OutputOffset after the last one (identity by default).
+/// The image of a model (see ModelFileHeader) is:
+/// [0] layers, [1] inputs, [2] outputs,
+/// for each layer { inputs, outputs, activation, weights, bias } (offsets from the start of the image),
+/// input scale, input offset, output scale, output offset, and the weights and bias of all layers.
+class MLPModel {
+	MLPLayer layers[MLP_MAX_LAYERS];
+	int layerCount = 0;
+	list<float> parameters;
+	float inputScale[MLP_MAX_WIDTH], inputOffset[MLP_MAX_WIDTH];
+	float outputScale[MLP_MAX_WIDTH], outputOffset[MLP_MAX_WIDTH];
+
+	MLPPrecision precision = MLPPrecision::Float32;
+	MLPMathMode mathMode = MLPMathMode::Accurate;
+	// Weights of the reduced precision modes, with the same offsets than the parameters
+	list<unsigned short> halfParameters;
+	list<signed char> int8Weights;
+	// Scale of the int8 weights of every output, with the same offsets than the bias
+	list<float> channelScales;
+
+	// Gets the weights and bias of a layer in the current precision.
+	void DequantizeLayer(int l, float* W, float* B) const {
+		const MLPLayer& layer = layers[l];
+		int weights = layer.Inputs * layer.Outputs;
+		if (precision == MLPPrecision::Float16)
+		{
+			const unsigned short* h = &halfParameters[layer.Weights];
+			int i = 0;
+			for (; i + BATCH_WIDTH <= weights; i += BATCH_WIDTH)
+				BatchStore(W + i, BatchLoadHalf(h + i));
+			for (; i < weights; i++)
+				W[i] = HalfToFloat(h[i]);
+			for (int o = 0; o < layer.Outputs; o++)
+				B[o] = HalfToFloat(halfParameters[layer.Bias + o]);
+		}
+		else
+		{
+			const float* scales = &channelScales[layer.Bias];
+			for (int i = 0; i < layer.Inputs; i++)
+			{
+				const signed char* q = &int8Weights[layer.Weights + i * layer.Outputs];
+				float* row = W + i * layer.Outputs;
+				int o = 0;
+				for (; o + BATCH_WIDTH <= layer.Outputs; o += BATCH_WIDTH)
+					BatchStore(row + o, BatchMul(BatchLoadInt8(q + o), BatchLoad(scales + o)));
+				for (; o < layer.Outputs; o++)
+					row[o] = q[o] * scales[o];
+			}
+			memcpy(B, &parameters[layer.Bias], sizeof(float) * layer.Outputs);
+		}
+	}
+
+public:
+	MLPModel() {
+		Clear();
+	}
+	MLPModel(const MLPModel&) = delete;
+	MLPModel& operator = (const MLPModel&) = delete;
+
+	void Clear() {
+		layerCount = 0;
+		parameters.reset();
+		precision = MLPPrecision::Float32;
+		for (int i = 0; i < MLP_MAX_WIDTH; i++)
+		{
+			inputScale[i] = outputScale[i] = 1;
+			inputOffset[i] = outputOffset[i] = 0;
+		}
+	}
+
+	inline int LayerCount() const { return layerCount; }
+
+	inline const MLPLayer& Layer(int index) const { return layers[index]; }
+
+	inline int Inputs() const { return layerCount == 0 ? 0 : layers[0].Inputs; }
+
+	inline int Outputs() const { return layerCount == 0 ? 0 : layers[layerCount - 1].Outputs; }
+
+	inline float* Weights(int layer) const { return &parameters[layers[layer].Weights]; }
+
+	inline float* Bias(int layer) const { return &parameters[layers[layer].Bias]; }
+
+	void SetInputNormalization(const float* scale, const float* offset) {
+		for (int i = 0; i < Inputs(); i++)
+		{
+			inputScale[i] = scale[i];
+			inputOffset[i] = offset[i];
+		}
+	}
+
+	void SetOutputNormalization(const float* scale, const float* offset) {
+		for (int o = 0; o < Outputs(); o++)
+		{
+			outputScale[o] = scale[o];
+			outputOffset[o] = offset[o];
+		}
+	}
+
+	inline MLPPrecision Precision() const { return precision; }
+
+	inline MLPMathMode MathMode() const { return mathMode; }
+
+	// Sets the implementation of the activations used by Evaluate and EvaluateBatch (Accurate by default, kept by Clear).
+	void SetMathMode(MLPMathMode mode) {
+		mathMode = mode;
+	}
+
+	// Sets the precision of the weights used by Evaluate and EvaluateBatch, computed from the current fp32 weights.
+	// The fp32 weights are kept, so the precision can be changed back. Weights changed later require setting the precision again.
+	// Reduced precision is meant to validate the networks for a GPU deployment, on the CPU it doesn't speed up
+	// the evaluation (weights are dequantized per layer and fit in the L1 cache anyway).
+	void SetPrecision(MLPPrecision precision) {
+		this->precision = precision;
+		if (precision == MLPPrecision::Float16)
+		{
+			halfParameters.reset();
+			for (int i = 0; i < parameters.size(); i++)
+				halfParameters.add(FloatToHalf(parameters[i]));
+		}
+		if (precision == MLPPrecision::Int8)
+		{
+			int8Weights.reset();
+			channelScales.reset();
+			for (int i = 0; i < parameters.size(); i++)
+			{
+				int8Weights.add(0);
+				channelScales.add(0);
+			}
+			for (int l = 0; l < layerCount; l++)
+			{
+				const MLPLayer& layer = layers[l];
+				for (int o = 0; o < layer.Outputs; o++)
+				{
+					float range = 0;
+					for (int i = 0; i < layer.Inputs; i++)
+						range = maxf(range, fabsf(parameters[layer.Weights + i * layer.Outputs + o]));
+					float scale = range / 127;
+					channelScales[layer.Bias + o] = scale;
+					for (int i = 0; i < layer.Inputs; i++)
+					{
+						int index = layer.Weights + i * layer.Outputs + o;
+						int q = scale == 0 ? 0 : (int)roundf(parameters[index] / scale);
+						int8Weights[index] = (signed char)max(-127, min(127, q));
+					}
+				}
+			}
+		}
+	}
+
+	// Appends a layer with all weights and bias in zero. Returns the index of the layer or -1 if the layer can not be added.
+	int AddLayer(int inputs, int outputs, MLPActivation activation) {
+		if (layerCount == MLP_MAX_LAYERS || inputs <= 0 || outputs <= 0 || inputs > MLP_MAX_WIDTH || outputs > MLP_MAX_WIDTH)
+			return -1;
+		if (layerCount > 0 && layers[layerCount - 1].Outputs != inputs)
+			return -1;
+
+		MLPLayer& layer = layers[layerCount];
+		layer.Inputs = inputs;
+		layer.Outputs = outputs;
+		layer.Activation = activation;
+		layer.Weights = parameters.size();
+		for (int i = 0; i < inputs * outputs; i++)
+			parameters.add(0);
+		layer.Bias = parameters.size();
+		for (int i = 0; i < outputs; i++)
+			parameters.add(0);
+		return layerCount++;
+	}
+
+	// Evaluates the network for a single input.
+	void Evaluate(const float* input, float* output) const {
+		float buffers[2][MLP_MAX_WIDTH];
+		float dequantized[MLP_MAX_WIDTH * MLP_MAX_WIDTH + MLP_MAX_WIDTH];
+		bool half = precision == MLPPrecision::Float16;
+		for (int i = 0; i < Inputs(); i++)
+		{
+			buffers[1][i] = input[i] * inputScale[i] + inputOffset[i];
+			if (half)
+				buffers[1][i] = RoundToHalf(buffers[1][i]);
+		}
+		const float* current = buffers[1];
+		for (int l = 0; l < layerCount; l++)
+		{
+			const MLPLayer& layer = layers[l];
+			float* next = l == layerCount - 1 ? output : buffers[l % 2];
+			const float* W = &parameters[layer.Weights];
+			const float* B = &parameters[layer.Bias];
+			if (precision != MLPPrecision::Float32)
+			{
+				DequantizeLayer(l, dequantized, dequantized + layer.Inputs * layer.Outputs);
+				W = dequantized;
+				B = dequantized + layer.Inputs * layer.Outputs;
+			}
+			for (int o = 0; o < layer.Outputs; o++)
+				next[o] = B[o];
+			for (int i = 0; i < layer.Inputs; i++)
+			{
+				float x = current[i];
+				const float* row = W + i * layer.Outputs;
+				for (int o = 0; o < layer.Outputs; o++)
+					next[o] += x * row[o];
+			}
+			ActivateValues(layer.Activation, mathMode, next, layer.Outputs);
+			if (half)
+				for (int o = 0; o < layer.Outputs; o++)
+					next[o] = RoundToHalf(next[o]);
+			current = next;
+		}
+		for (int o = 0; o < Outputs(); o++)
+			output[o] = output[o] * outputScale[o] + outputOffset[o];
+	}
+
+	// Evaluates the network for count samples at once.
+	// Inputs and outputs are stored by feature, i.e. input[i * count + sample] and output[o * count + sample].
+	// Activations are computed as in Evaluate (see MLPMathMode).
+	void EvaluateBatch(const float* input, float* output, int count) const {
+		alignas(64) float buffers[2][MLP_MAX_WIDTH * MLP_BATCH_CHUNK];
+		alignas(64) float dequantized[MLP_MAX_WIDTH * MLP_MAX_WIDTH + MLP_MAX_WIDTH];
+		int inputs = Inputs(), outputs = Outputs();
+		bool half = precision == MLPPrecision::Float16;
+
+		for (int start = 0; start < count; start += MLP_BATCH_CHUNK)
+		{
+			int samples = min(MLP_BATCH_CHUNK, count - start);
+			// padded to full lanes
+			int lanes = (samples + BATCH_WIDTH - 1) / BATCH_WIDTH * BATCH_WIDTH;
+
+			for (int i = 0; i < inputs; i++)
+			{
+				float* chunk = buffers[0] + i * MLP_BATCH_CHUNK;
+				for (int s = 0; s < samples; s++)
+					chunk[s] = input[i * count + start + s] * inputScale[i] + inputOffset[i];
+				for (int s = samples; s < lanes; s++)
+					chunk[s] = 0;
+				if (half)
+					for (int s = 0; s < lanes; s += BATCH_WIDTH)
+						BatchStore(chunk + s, BatchRoundToHalf(BatchLoad(chunk + s)));
+			}
+
+			for (int l = 0; l < layerCount; l++)
+			{
+				const MLPLayer& layer = layers[l];
+				const float* in = buffers[l % 2];
+				float* out = buffers[(l + 1) % 2];
+				const float* W = &parameters[layer.Weights];
+				const float* B = &parameters[layer.Bias];
+				if (precision != MLPPrecision::Float32)
+				{
+					DequantizeLayer(l, dequantized, dequantized + layer.Inputs * layer.Outputs);
+					W = dequantized;
+					B = dequantized + layer.Inputs * layer.Outputs;
+				}
+				int o = 0;
+				for (; o + 8 <= layer.Outputs; o += 8)
+					EvaluateBatchTile<8>(in, out, W, B, layer.Inputs, layer.Outputs, o, layer.Activation, mathMode, lanes);
+				for (; o + 4 <= layer.Outputs; o += 4)
+					EvaluateBatchTile<4>(in, out, W, B, layer.Inputs, layer.Outputs, o, layer.Activation, mathMode, lanes);
+				for (; o + 2 <= layer.Outputs; o += 2)
+					EvaluateBatchTile<2>(in, out, W, B, layer.Inputs, layer.Outputs, o, layer.Activation, mathMode, lanes);
+				for (; o < layer.Outputs; o++)
+					EvaluateBatchTile<1>(in, out, W, B, layer.Inputs, layer.Outputs, o, layer.Activation, mathMode, lanes);
+				if (half)
+					for (int o = 0; o < layer.Outputs; o++)
+						for (int s = 0; s < lanes; s += BATCH_WIDTH)
+							BatchStore(out + o * MLP_BATCH_CHUNK + s, BatchRoundToHalf(BatchLoad(out + o * MLP_BATCH_CHUNK + s)));
+			}
+
+			const float* result = buffers[layerCount % 2];
+			for (int o = 0; o < outputs; o++)
+				for (int s = 0; s < samples; s++)
+					output[o * count + start + s] = result[o * MLP_BATCH_CHUNK + s] * outputScale[o] + outputOffset[o];
+		}
+	}
+
+	// Number of 32-bit words of the image of the model.
+	int ImageSize() const {
+		return 3 + 5 * layerCount + 2 * Inputs() + 2 * Outputs() + parameters.size();
+	}
+
+	void WriteImage(float* image) const {
+		int parametersStart = ImageSize() - parameters.size();
+		image[0] = ImageInt(layerCount);
+		image[1] = ImageInt(Inputs());
+		image[2] = ImageInt(Outputs());
+		float* layer = image + 3;
+		for (int l = 0; l < layerCount; l++, layer += 5)
+		{
+			layer[0] = ImageInt(layers[l].Inputs);
+			layer[1] = ImageInt(layers[l].Outputs);
+			layer[2] = ImageInt((int)layers[l].Activation);
+			layer[3] = ImageInt(parametersStart + layers[l].Weights);
+			layer[4] = ImageInt(parametersStart + layers[l].Bias);
+		}
+		float* normalization = layer;
+		for (int i = 0; i < Inputs(); i++)
+		{
+			normalization[i] = inputScale[i];
+			normalization[Inputs() + i] = inputOffset[i];
+		}
+		normalization += 2 * Inputs();
+		for (int o = 0; o < Outputs(); o++)
+		{
+			normalization[o] = outputScale[o];
+			normalization[Outputs() + o] = outputOffset[o];
+		}
+		for (int i = 0; i < parameters.size(); i++)
+			image[parametersStart + i] = parameters[i];
+	}
+
+	// Reads a model from its image. Returns false (and leaves the model empty) if the image is not consistent.
+	bool ReadImage(const float* image, int words) {
+		Clear();
+		if (words < 3)
+			return false;
+		int count = ImageInt(image[0]), inputs = ImageInt(image[1]), outputs = ImageInt(image[2]);
+		if (count <= 0 || count > MLP_MAX_LAYERS || words < 3 + 5 * count)
+			return false;
+
+		const float* layer = image + 3;
+		for (int l = 0; l < count; l++, layer += 5)
+		{
+			int activation = ImageInt(layer[2]);
+			int weights = ImageInt(layer[3]), bias = ImageInt(layer[4]);
+			if (activation < 0 || activation > (int)MLPActivation::ReLU ||
+				AddLayer(ImageInt(layer[0]), ImageInt(layer[1]), (MLPActivation)activation) < 0 ||
+				weights < 0 || bias < 0 ||
+				weights + (long long)layers[l].Inputs * layers[l].Outputs > words || bias + layers[l].Outputs > words)
+			{
+				Clear();
+				return false;
+			}
+			memcpy(Weights(l), image + weights, sizeof(float) * layers[l].Inputs * layers[l].Outputs);
+			memcpy(Bias(l), image + bias, sizeof(float) * layers[l].Outputs);
+		}
+		if (inputs != Inputs() || outputs != Outputs() || ImageSize() > words)
+		{
+			Clear();
+			return false;
+		}
+
+		const float* normalization = layer;
+		SetInputNormalization(normalization, normalization + inputs);
+		normalization += 2 * inputs;
+		SetOutputNormalization(normalization, normalization + outputs);
+		return true;
+	}
+
+	// Loads the model from a model file. Returns false (and leaves the model empty) if the file is missing or malformed.
+	bool Load(const char* fileName) {
+		Clear();
+		int words;
+		float* image = ReadModelFile(fileName, MLP_FILE_MAGIC, words);
+		if (!image)
+			return false;
+		bool valid = ReadImage(image, words);
+		delete[] image;
+		return valid;
+	}
+
+	// Saves the model to a model file readable by Load.
+	bool Save(const char* fileName) const {
+		int words = ImageSize();
+		float* image = new float[words];
+		WriteImage(image);
+		bool saved = WriteModelFile(fileName, MLP_FILE_MAGIC, image, words);
+		delete[] image;
+		return saved;
+	}
+};
+
+struct MLPBatchBenchmark {
+	int Width;
+	int BatchSize;
+	// Single thread throughput
+	float ScalarSamplesPerSecond;
+	float BatchSamplesPerSecond;
+	float Speedup;
+	// Maximum relative error (|a - b| / max(1, |b|)) of the batched outputs against Evaluate
+	float MaxError;
+};
+
+/// Measures the throughput of a model evaluated sample by sample and in batches of batchSize samples.
+inline MLPBatchBenchmark BenchmarkMLPBatch(const MLPModel& model, int batchSize, int samples = 1 << 18, unsigned int seed = 0) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto uniform = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	int inputs = model.Inputs(), outputs = model.Outputs();
+	int batches = max(1, samples / batchSize);
+	samples = batches * batchSize;
+
+	// Sample by sample data is stored by sample, batched data by feature inside every batch
+	float* input = new float[samples * inputs];
+	float* scalarOutput = new float[samples * outputs];
+	float* batchInput = new float[samples * inputs];
+	float* batchOutput = new float[samples * outputs];
+	for (int s = 0; s < samples; s++)
+		for (int i = 0; i < inputs; i++)
+		{
+			float x = uniform() * 4 - 2;
+			input[s * inputs + i] = x;
+			batchInput[(s / batchSize) * batchSize * inputs + i * batchSize + s % batchSize] = x;
+		}
+
+	MLPBatchBenchmark result = {};
+	result.Width = BATCH_WIDTH;
+	result.BatchSize = batchSize;
+
+	Stopwatch stopwatch;
+	for (int s = 0; s < samples; s++)
+		model.Evaluate(input + s * inputs, scalarOutput + s * outputs);
+	result.ScalarSamplesPerSecond = samples * 1000.0f / stopwatch.Milliseconds();
+
+	stopwatch.Start();
+	for (int b = 0; b < batches; b++)
+		model.EvaluateBatch(batchInput + b * batchSize * inputs, batchOutput + b * batchSize * outputs, batchSize);
+	result.BatchSamplesPerSecond = samples * 1000.0f / stopwatch.Milliseconds();
+	result.Speedup = result.BatchSamplesPerSecond / result.ScalarSamplesPerSecond;
+
+	for (int s = 0; s < samples; s++)
+		for (int o = 0; o < outputs; o++)
+		{
+			float expected = scalarOutput[s * outputs + o];
+			float value = batchOutput[(s / batchSize) * batchSize * outputs + o * batchSize + s % batchSize];
+			result.MaxError = maxf(result.MaxError, fabsf(value - expected) / maxf(1.0f, fabsf(expected)));
+		}
+
+	delete[] input;
+	delete[] scalarOutput;
+	delete[] batchInput;
+	delete[] batchOutput;
+	return result;
+}
+
+struct BatchMathError {
+	// Against double precision over the finite results, relative where the exact value is above 1e-30
+	float MaxAbsoluteError;
+	float MaxRelativeError;
+	// Infinite or NaN results
+	int NonFinite;
+	// Single thread throughput
+	float ValuesPerSecond;
+};
+
+/// Errors of the implementations of the activations, indexed by MLPMathMode.
+struct BatchMathReport {
+	int Width;
+	// e^x with x in [-87, 88]
+	BatchMathError Exp[3];
+	// log(x) with x in [1e-30, 1e30] (uniform exponent)
+	BatchMathError Log[3];
+	// log(1 + e^x) with x in [-100, 100], wider than the pre-activations of the networks
+	BatchMathError Softplus[3];
+	// 1 / (1 + e^-x) with x in [-20, 20]
+	BatchMathError Sigmoid[3];
+	// tanh(x) with |x| in [1e-10, 10] (uniform exponent) and both signs, covers the cancellation near 0
+	BatchMathError Tanh[3];
+};
+
+/// Measures the error and speed of exp, log and the activations in every MLPMathMode.
+/// Reference uses the C runtime per value, Accurate BatchExp, BatchLog, BatchSoftplus, BatchSigmoid, BatchTanh and Fast the *Fast versions.
+inline BatchMathReport MeasureBatchMath(int count = 1 << 20, unsigned int seed = 0) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto uniform = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	count = max(BATCH_WIDTH, count / BATCH_WIDTH * BATCH_WIDTH);
+	float* input = new float[count];
+	float* output = new float[count];
+
+	// function: 0 exp, 1 log, 2 softplus, 3 sigmoid, 4 tanh
+	auto evaluate = [&](int function, MLPMathMode mode) {
+		if (mode == MLPMathMode::Reference)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				float x = input[i];
+				output[i] =
+					function == 0 ? expf(x) :
+					function == 1 ? logf(x) :
+					function == 2 ? ActivationFunction(MLPActivation::Softplus, x) :
+					function == 3 ? ActivationFunction(MLPActivation::Sigmoid, x) :
+					ActivationFunction(MLPActivation::Tanh, x);
+			}
+			return;
+		}
+		bool fast = mode == MLPMathMode::Fast;
+		for (int i = 0; i < count; i += BATCH_WIDTH)
+		{
+			batch_float x = BatchLoad(input + i);
+			switch (function)
+			{
+			case 0: x = fast ? BatchExpFast(x) : BatchExp(x); break;
+			case 1: x = fast ? BatchLogFast(x) : BatchLog(x); break;
+			case 2: x = BatchActivationFunction(MLPActivation::Softplus, x, mode); break;
+			case 3: x = BatchActivationFunction(MLPActivation::Sigmoid, x, mode); break;
+			default: x = BatchActivationFunction(MLPActivation::Tanh, x, mode); break;
+			}
+			BatchStore(output + i, x);
+		}
+	};
+
+	auto measure = [&](int function, BatchMathError* errors) {
+		for (int i = 0; i < count; i++)
+		{
+			float u = uniform();
+			input[i] =
+				function == 0 ? -87 + 175 * u :
+				function == 1 ? powf(10.0f, -30 + 60 * u) :
+				function == 2 ? -100 + 200 * u :
+				function == 3 ? -20 + 40 * u :
+				(i & 1 ? -1 : 1) * powf(10.0f, -10 + 11 * u);
+		}
+		for (int m = 0; m < 3; m++)
+		{
+			MLPMathMode mode = (MLPMathMode)m;
+			BatchMathError e = {};
+			Stopwatch stopwatch;
+			evaluate(function, mode);
+			e.ValuesPerSecond = count * 1000.0f / maxf(1e-6f, (float)stopwatch.Milliseconds());
+			for (int i = 0; i < count; i++)
+			{
+				double x = input[i];
+				double expected =
+					function == 0 ? exp(x) :
+					function == 1 ? log(x) :
+					function == 2 ? (x > 0 ? x + log1p(exp(-x)) : log1p(exp(x))) :
+					function == 3 ? 1 / (1 + exp(-x)) :
+					tanh(x);
+				float value = output[i];
+				if (!isfinite(value))
+				{
+					e.NonFinite++;
+					continue;
+				}
+				double error = fabs(value - expected);
+				e.MaxAbsoluteError = maxf(e.MaxAbsoluteError, (float)error);
+				if (fabs(expected) >= 1e-30) // e^x is clamped to normal floats
+					e.MaxRelativeError = maxf(e.MaxRelativeError, (float)(error / fabs(expected)));
+			}
+			errors[m] = e;
+		}
+	};
+
+	BatchMathReport report = {};
+	report.Width = BATCH_WIDTH;
+	measure(0, report.Exp);
+	measure(1, report.Log);
+	measure(2, report.Softplus);
+	measure(3, report.Sigmoid);
+	measure(4, report.Tanh);
+
+	delete[] input;
+	delete[] output;
+	return report;
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "dx4xb_platform.h"
+#ifdef _WIN32
+#include <Psapi.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+#endif
+
+/// Read-only view of a whole file mapped in memory.
+/// Pages are loaded lazily by the OS and shared between processes mapping the same file.
+class MappedFile {
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+	HANDLE mapping = nullptr;
+#endif
+	const byte* view = nullptr;
+	unsigned long long size = 0;
+
+public:
+	MappedFile() {}
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator = (const MappedFile&) = delete;
+
+	~MappedFile() {
+		Close();
+	}
+
+	// Maps the file. Returns false if the file doesn't exist or can not be mapped.
+	bool Open(const char* fileName) {
+		Close();
+
+#ifdef _WIN32
+		file = CreateFileA(fileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+			return false;
+
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+		{
+			Close();
+			return false;
+		}
+		size = fileSize.QuadPart;
+
+		mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!mapping)
+		{
+			Close();
+			return false;
+		}
+
+		view = (const byte*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (!view)
+		{
+			Close();
+			return false;
+		}
+#else
+		int descriptor = open(fileName, O_RDONLY);
+		if (descriptor < 0)
+			return false;
+
+		struct stat status;
+		if (fstat(descriptor, &status) != 0 || status.st_size == 0)
+		{
+			close(descriptor);
+			return false;
+		}
+
+		// the mapping keeps the file open
+		void* mapped = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_SHARED, descriptor, 0);
+		close(descriptor);
+		if (mapped == MAP_FAILED)
+			return false;
+		madvise(mapped, (size_t)status.st_size, MADV_RANDOM);
+		view = (const byte*)mapped;
+		size = (unsigned long long)status.st_size;
+#endif
+		return true;
+	}
+
+	void Close() {
+#ifdef _WIN32
+		if (view)
+			UnmapViewOfFile(view);
+		if (mapping)
+			CloseHandle(mapping);
+		if (file != INVALID_HANDLE_VALUE)
+			CloseHandle(file);
+		mapping = nullptr;
+		file = INVALID_HANDLE_VALUE;
+#else
+		if (view)
+			munmap((void*)view, (size_t)size);
+#endif
+		view = nullptr;
+		size = 0;
+	}
+
+	inline bool IsOpen() const { return view != nullptr; }
+
+	inline const byte* Data() const { return view; }
+
+	inline unsigned long long Size() const { return size; }
+
+	template<typename T>
+	inline const T* As(unsigned long long offset = 0) const {
+		return (const T*)(view + offset);
+	}
+};
+
+/// Memory used by the process (peaks since the process started).
+struct ProcessMemoryPeaks {
+	unsigned long long PeakWorkingSet;
+	unsigned long long PeakPrivateBytes;
+};
+
+inline ProcessMemoryPeaks MeasureProcessMemory() {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters = {};
+	GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters));
+	return { counters.PeakWorkingSetSize, counters.PeakPagefileUsage };
+#else
+	// Only the peak resident set is known (kilobytes on Linux), it is used for both
+	struct rusage usage = {};
+	getrusage(RUSAGE_SELF, &usage);
+	unsigned long long peak = (unsigned long long)usage.ru_maxrss * 1024;
+	return { peak, peak };
+#endif
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include "dx4xb_platform.h"
+
+/// Number of logical processors.
+inline int ProcessorCount() {
+	int count = (int)std::thread::hardware_concurrency();
+	return count > 0 ? count : 1;
+}
+
+/// Runs task(index, thread) for every index in [0, count) with threads threads (the logical processors by default),
+/// the calling thread is the thread 0. Indices are taken in increasing order by the next free thread, so results
+/// stored by index don't depend on the number of threads.
+template<typename Task>
+inline void ParallelFor(int count, Task task, int threads = 0) {
+	if (threads <= 0)
+		threads = ProcessorCount();
+	threads = max(1, min(threads, count));
+
+	std::atomic<int> next(0);
+	auto run = [&](int thread) {
+		int index;
+		while ((index = next.fetch_add(1)) < count)
+			task(index, thread);
+	};
+
+	std::vector<std::thread> workers;
+	workers.reserve(threads - 1);
+	for (int t = 1; t < threads; t++)
+		workers.emplace_back(run, t);
+
+	run(0);
+
+	for (std::thread& worker : workers)
+		worker.join();
+}
@@ -0,0 +1,357 @@
+#pragma once
+
+#include "dx4xb_math.h"
+#include "BatchFloat.h"
+#include "Stopwatch.h"
+
+using namespace dx4xb;
+
+// HG factors below are sampled as isotropic (ImportanceSamplePhase in Tools/HGPhaseFunction.h uses randomDirection)
+#define HG_ISOTROPIC_G 0.001f
+// Entries of the tabulated inverse cdf of a g
+#define HG_TABLE_SIZE 1024
+
+#pragma region Scalar
+
+/// Cosine of the HG phase function of factor g for the uniform xi, invertcdf of Tools/HGPhaseFunction.h and 1 - 2 xi if
+/// g is isotropic: cos theta = (1 + g^2 - t^2) / 2g with t = (1 - g^2) / (1 - g + 2g xi).
+inline float HGInvertCDF(float g, float xi) {
+	if (fabsf(g) < HG_ISOTROPIC_G)
+		return 1 - 2 * xi;
+	float t = (1 - g * g) / (1 - g + 2 * g * xi);
+	return (1 + g * g - t * t) * (0.5f / g);
+}
+
+/// Orthonormal b1, b2 completing the unit n without branches, cross products or normalizations
+/// (Duff et al., Building an Orthonormal Basis, Revisited). Continuous except at n.z = 0 where the sign flips.
+inline void TangentFrame(const float3& n, float3& b1, float3& b2) {
+	float sign = n.z < 0 ? -1.0f : 1.0f;
+	float a = -1 / (sign + n.z);
+	float b = n.x * n.y * a;
+	b1 = float3(1 + sign * n.x * n.x * a, sign * b, -sign * n.x);
+	b2 = float3(b, sign + n.y * n.y * a, -n.y);
+}
+
+/// Frame of CreateOrthonormalBasis in Tools/HGPhaseFunction.h (cross products), the reference of TangentFrame.
+inline void CrossTangentFrame(const float3& n, float3& b1, float3& b2) {
+	float3 other = fabsf(n.z) >= 0.999f ? float3(1, 0, 0) : float3(0, 0, 1);
+	b1 = normalize(cross(other, n));
+	b2 = normalize(cross(n, b1));
+}
+
+/// Direction scattered from w by the HG phase function of factor g, distributed as ImportanceSamplePhase with the numbers in
+/// the order random() draws them: uPhi for the azimuth and uCos for the cosine. The frame around w differs (TangentFrame).
+/// Isotropic g draws the same two numbers as randomDirection with the cosine 1 - 2 uCos instead of 2 uCos - 1.
+inline float3 SamplePhase(float g, const float3& w, float uPhi, float uCos) {
+	float cosTheta = HGInvertCDF(g, uCos);
+	float sinTheta = sqrtf(maxf(0.0f, 1 - cosTheta * cosTheta));
+	float phi = uPhi * 2 * 3.14159265f;
+	float3 b1, b2;
+	TangentFrame(w, b1, b2);
+	return b1 * (sinTheta * sinf(phi)) + b2 * (sinTheta * cosf(phi)) + w * cosTheta;
+}
+
+#pragma endregion
+
+#pragma region Batch
+
+/// HGInvertCDF of BATCH_WIDTH lanes with an own g each. Isotropic lanes are selected, not branched.
+inline batch_float BatchHGInvertCDF(batch_float g, batch_float xi) {
+	batch_float one = BatchSet(1), zero = BatchSet(0);
+	batch_float g2 = BatchMul(g, g);
+	batch_float t = BatchDiv(BatchSub(one, g2), BatchMulAdd(BatchAdd(g, g), xi, BatchSub(one, g)));
+	batch_float hg = BatchDiv(BatchSub(BatchAdd(one, g2), BatchMul(t, t)), BatchAdd(g, g));
+	batch_float isotropic = BatchSub(one, BatchAdd(xi, xi));
+	batch_float absG = BatchMax(g, BatchSub(zero, g));
+	return BatchSelectLess(absG, BatchSet(HG_ISOTROPIC_G), isotropic, hg);
+}
+
+/// TangentFrame of BATCH_WIDTH unit vectors.
+inline void BatchTangentFrame(batch_float nx, batch_float ny, batch_float nz,
+	batch_float& b1x, batch_float& b1y, batch_float& b1z, batch_float& b2x, batch_float& b2y, batch_float& b2z) {
+	batch_float one = BatchSet(1), zero = BatchSet(0);
+	batch_float sign = BatchSelectLess(nz, zero, BatchSet(-1), one);
+	batch_float a = BatchDiv(BatchSet(-1), BatchAdd(sign, nz));
+	batch_float b = BatchMul(BatchMul(nx, ny), a);
+	batch_float signX = BatchMul(sign, nx);
+	b1x = BatchMulAdd(BatchMul(signX, nx), a, one);
+	b1y = BatchMul(sign, b);
+	b1z = BatchSub(zero, signX);
+	b2x = b;
+	b2y = BatchMulAdd(BatchMul(ny, ny), a, sign);
+	b2z = BatchSub(zero, ny);
+}
+
+// Direction from the cosine with w and the azimuth uPhi, in the frame of BatchTangentFrame.
+inline void BatchScatter(batch_float cosTheta, batch_float uPhi, batch_float& wx, batch_float& wy, batch_float& wz) {
+	batch_float sinTheta = BatchSqrt(BatchMax(BatchSet(0), BatchSub(BatchSet(1), BatchMul(cosTheta, cosTheta))));
+	batch_float sinPhi, cosPhi;
+	BatchSinCos(BatchMul(uPhi, BatchSet(2 * 3.14159265f)), sinPhi, cosPhi);
+	batch_float b1x, b1y, b1z, b2x, b2y, b2z;
+	BatchTangentFrame(wx, wy, wz, b1x, b1y, b1z, b2x, b2y, b2z);
+	batch_float s1 = BatchMul(sinTheta, sinPhi), s2 = BatchMul(sinTheta, cosPhi);
+	wx = BatchMulAdd(s1, b1x, BatchMulAdd(s2, b2x, BatchMul(cosTheta, wx)));
+	wy = BatchMulAdd(s1, b1y, BatchMulAdd(s2, b2y, BatchMul(cosTheta, wy)));
+	wz = BatchMulAdd(s1, b1z, BatchMulAdd(s2, b2z, BatchMul(cosTheta, wz)));
+}
+
+/// SamplePhase of BATCH_WIDTH directions (wx, wy, wz) with an own g each, replaced by the scattered directions.
+inline void BatchSamplePhase(batch_float g, batch_float& wx, batch_float& wy, batch_float& wz, batch_float uPhi, batch_float uCos) {
+	BatchScatter(BatchHGInvertCDF(g, uCos), uPhi, wx, wy, wz);
+}
+
+#pragma endregion
+
+#pragma region Tabulated inverse cdf
+
+/// Inverse cdf of the cosine of the HG phase function of a fixed g at HG_TABLE_SIZE + 1 entries, sampled with a linear
+/// interpolation. For walks with a single g, e.g. the table builders, or phase functions without a closed inverse.
+/// Entries are uniform in u = sqrt(xi) (1 - sqrt(1 - xi) for negative g), denser where the cosine changes fast.
+class HGInverseCDFTable {
+	float g = 0;
+	int size = 0;
+	float* values = nullptr;
+
+	inline float Position(float xi) const {
+		return (g < 0 ? 1 - sqrtf(1 - xi) : sqrtf(xi)) * size;
+	}
+
+public:
+	HGInverseCDFTable() {}
+	HGInverseCDFTable(const HGInverseCDFTable&) = delete;
+	HGInverseCDFTable& operator = (const HGInverseCDFTable&) = delete;
+
+	~HGInverseCDFTable() {
+		delete[] values;
+	}
+
+	float G() const { return g; }
+	int Size() const { return size; }
+
+	void Build(float g, int size = HG_TABLE_SIZE) {
+		delete[] values;
+		this->g = g;
+		this->size = size;
+		values = new float[size + 2];
+		for (int i = 0; i <= size; i++)
+		{
+			double u = i / (double)size;
+			double xi = g < 0 ? 1 - (1 - u) * (1 - u) : u * u;
+			if (fabs(g) < HG_ISOTROPIC_G)
+				values[i] = (float)(1 - 2 * xi);
+			else
+			{
+				double t = (1 - (double)g * g) / (1 - g + 2 * (double)g * xi);
+				values[i] = (float)((1 + (double)g * g - t * t) / (2 * (double)g));
+			}
+		}
+		// a position rounded to size interpolates the last entry with this
+		values[size + 1] = values[size];
+	}
+
+	inline float Sample(float xi) const {
+		float position = Position(xi);
+		int i = (int)position;
+		float alpha = position - i;
+		return values[i] + (values[i + 1] - values[i]) * alpha;
+	}
+
+	inline batch_float SampleBatch(batch_float xi) const {
+		batch_float one = BatchSet(1), n = BatchSet((float)size);
+		batch_float position = g < 0 ? BatchMul(BatchSub(one, BatchSqrt(BatchSub(one, xi))), n) : BatchMul(BatchSqrt(xi), n);
+		batch_float first = BatchFloor(position);
+		float lanes[BATCH_WIDTH];
+		int indices[BATCH_WIDTH];
+		BatchStore(lanes, first);
+		for (int l = 0; l < BATCH_WIDTH; l++)
+			indices[l] = (int)lanes[l];
+		batch_float v0 = BatchGather(values, indices);
+		batch_float v1 = BatchGather(values + 1, indices);
+		return BatchMulAdd(BatchSub(v1, v0), BatchSub(position, first), v0);
+	}
+};
+
+#pragma endregion
+
+/// Accuracy and single thread throughput of the phase sampling against the scalar formula with the frame of cross products.
+struct PhaseSamplingReport {
+	float G;
+	int Samples;
+	// Nanoseconds per sampled direction
+	float ScalarNanoseconds;		// HGInvertCDF, CrossTangentFrame, sinf and cosf (as ImportanceSamplePhase)
+	float FastScalarNanoseconds;	// SamplePhase (TangentFrame)
+	float BatchNanoseconds;			// BatchSamplePhase
+	float TableNanoseconds;			// HGInverseCDFTable::SampleBatch and BatchScatter
+	// Max absolute errors of the cosine against the formula in double precision, at a grid of xi
+	float BatchCosError;
+	float TableCosError;
+	// Max deviation from an orthonormal basis of TangentFrame (dots and lengths) over random directions, poles included
+	float FrameError;
+	// Max deviation of the length of the sampled directions from 1
+	float LengthError;
+	// Mean cosine of the sampled directions with the incoming one (g for the HG phase function)
+	float ScalarMeanCosine;
+	float BatchMeanCosine;
+	float TableMeanCosine;
+	// Total variation distance of the histogram of 64 bins of the cosines to the exact HG probabilities of the bins
+	float BatchDistance;
+	float TableDistance;
+};
+
+inline PhaseSamplingReport BenchmarkPhaseSampling(float g = 0.875f, int samples = 1 << 20) {
+	samples = max(BATCH_WIDTH, samples / BATCH_WIDTH * BATCH_WIDTH);
+	PhaseSamplingReport report = {};
+	report.G = g;
+	report.Samples = samples;
+
+	// incoming directions and the two numbers of every sample
+	float* directions[3] = { new float[samples], new float[samples], new float[samples] };
+	float* uPhi = new float[samples];
+	float* uCos = new float[samples];
+	unsigned int state = 12345u * 747796405u + 2891336453u;
+	auto random = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+	for (int i = 0; i < samples; i++)
+	{
+		float z = 1 - 2 * random(), a = random() * 2 * 3.14159265f;
+		// a few directions at the poles where both frames switch
+		if (i % 64 == 0)
+			z = i % 128 == 0 ? -1.0f : 1.0f;
+		float s = sqrtf(maxf(0.0f, 1 - z * z));
+		directions[0][i] = s * cosf(a);
+		directions[1][i] = s * sinf(a);
+		directions[2][i] = z;
+		uPhi[i] = random();
+		uCos[i] = random();
+	}
+	float* out[3] = { new float[samples], new float[samples], new float[samples] };
+
+	// exact probabilities of the bins of the cosine, from the HG cdf P(cos < c) = (1 - g^2) / 2g (1 / sqrt(1 + g^2 - 2gc) - 1 / (1 + g))
+	const int bins = 64;
+	double expected[bins];
+	auto cdf = [g](double c) {
+		if (fabs(g) < HG_ISOTROPIC_G)
+			return (c + 1) * 0.5;
+		return (1 - (double)g * g) / (2 * g) * (1 / sqrt(1 + (double)g * g - 2 * g * c) - 1 / (1 + (double)g));
+	};
+	for (int b = 0; b < bins; b++)
+		expected[b] = cdf(-1 + 2.0 * (b + 1) / bins) - cdf(-1 + 2.0 * b / bins);
+	auto distribution = [&](float& meanCosine, float& distance) {
+		double histogram[bins] = {};
+		double sum = 0;
+		for (int i = 0; i < samples; i++)
+		{
+			float c = out[0][i] * directions[0][i] + out[1][i] * directions[1][i] + out[2][i] * directions[2][i];
+			sum += c;
+			histogram[min(bins - 1, max(0, (int)((c + 1) * 0.5f * bins)))] += 1;
+		}
+		meanCosine = (float)(sum / samples);
+		double tv = 0;
+		for (int b = 0; b < bins; b++)
+			tv += fabs(histogram[b] / samples - expected[b]);
+		distance = (float)(tv * 0.5);
+	};
+
+	volatile float sink = 0;
+	Stopwatch stopwatch;
+	for (int i = 0; i < samples; i++)
+	{
+		float3 w = float3(directions[0][i], directions[1][i], directions[2][i]);
+		float cosTheta = HGInvertCDF(g, uCos[i]);
+		float sinTheta = sqrtf(maxf(0.0f, 1 - cosTheta * cosTheta));
+		float phi = uPhi[i] * 2 * 3.14159265f;
+		float3 b1, b2;
+		CrossTangentFrame(w, b1, b2);
+		float3 d = b1 * (sinTheta * sinf(phi)) + b2 * (sinTheta * cosf(phi)) + w * cosTheta;
+		out[0][i] = d.x; out[1][i] = d.y; out[2][i] = d.z;
+	}
+	report.ScalarNanoseconds = (float)(stopwatch.Milliseconds() * 1000000.0 / samples);
+	float distance;
+	distribution(report.ScalarMeanCosine, distance);
+
+	stopwatch.Start();
+	for (int i = 0; i < samples; i++)
+	{
+		float3 d = SamplePhase(g, float3(directions[0][i], directions[1][i], directions[2][i]), uPhi[i], uCos[i]);
+		out[0][i] = d.x; out[1][i] = d.y; out[2][i] = d.z;
+	}
+	report.FastScalarNanoseconds = (float)(stopwatch.Milliseconds() * 1000000.0 / samples);
+	sink = sink + out[0][samples / 2];
+
+	batch_float gs = BatchSet(g);
+	stopwatch.Start();
+	for (int i = 0; i < samples; i += BATCH_WIDTH)
+	{
+		batch_float wx = BatchLoad(directions[0] + i), wy = BatchLoad(directions[1] + i), wz = BatchLoad(directions[2] + i);
+		BatchSamplePhase(gs, wx, wy, wz, BatchLoad(uPhi + i), BatchLoad(uCos + i));
+		BatchStore(out[0] + i, wx);
+		BatchStore(out[1] + i, wy);
+		BatchStore(out[2] + i, wz);
+	}
+	report.BatchNanoseconds = (float)(stopwatch.Milliseconds() * 1000000.0 / samples);
+	distribution(report.BatchMeanCosine, report.BatchDistance);
+	for (int i = 0; i < samples; i++)
+	{
+		float length = sqrtf(out[0][i] * out[0][i] + out[1][i] * out[1][i] + out[2][i] * out[2][i]);
+		report.LengthError = maxf(report.LengthError, fabsf(length - 1));
+	}
+
+	HGInverseCDFTable table;
+	table.Build(g);
+	stopwatch.Start();
+	for (int i = 0; i < samples; i += BATCH_WIDTH)
+	{
+		batch_float wx = BatchLoad(directions[0] + i), wy = BatchLoad(directions[1] + i), wz = BatchLoad(directions[2] + i);
+		BatchScatter(table.SampleBatch(BatchLoad(uCos + i)), BatchLoad(uPhi + i), wx, wy, wz);
+		BatchStore(out[0] + i, wx);
+		BatchStore(out[1] + i, wy);
+		BatchStore(out[2] + i, wz);
+	}
+	report.TableNanoseconds = (float)(stopwatch.Milliseconds() * 1000000.0 / samples);
+	distribution(report.TableMeanCosine, report.TableDistance);
+
+	// cosines against the formula in double precision
+	const int grid = 1 << 16;
+	float xi[BATCH_WIDTH], batchCos[BATCH_WIDTH], tableCos[BATCH_WIDTH];
+	for (int i = 0; i < grid; i += BATCH_WIDTH)
+	{
+		for (int l = 0; l < BATCH_WIDTH; l++)
+			xi[l] = (i + l) / (float)grid;
+		BatchStore(batchCos, BatchHGInvertCDF(gs, BatchLoad(xi)));
+		BatchStore(tableCos, table.SampleBatch(BatchLoad(xi)));
+		for (int l = 0; l < BATCH_WIDTH; l++)
+		{
+			double exact = 1 - 2.0 * xi[l];
+			if (fabs(g) >= HG_ISOTROPIC_G)
+			{
+				double t = (1 - (double)g * g) / (1 - g + 2 * (double)g * xi[l]);
+				exact = (1 + (double)g * g - t * t) / (2 * (double)g);
+			}
+			report.BatchCosError = maxf(report.BatchCosError, (float)fabs(batchCos[l] - exact));
+			report.TableCosError = maxf(report.TableCosError, (float)fabs(tableCos[l] - exact));
+		}
+	}
+
+	for (int i = 0; i < samples; i++)
+	{
+		float3 n = float3(directions[0][i], directions[1][i], directions[2][i]);
+		float3 b1, b2;
+		TangentFrame(n, b1, b2);
+		float errors[] = { dot(n, b1), dot(n, b2), dot(b1, b2), length(b1) - 1, length(b2) - 1 };
+		for (int e = 0; e < 5; e++)
+			report.FrameError = maxf(report.FrameError, fabsf(errors[e]));
+	}
+
+	for (int c = 0; c < 3; c++)
+	{
+		delete[] directions[c];
+		delete[] out[c];
+	}
+	delete[] uPhi;
+	delete[] uCos;
+	return report;
+}
@@ -0,0 +1,245 @@
+#pragma once
+
+#include <string.h>
+#include <math.h>
+
+// Frequencies of the symbols of a coded stream sum 1 << RANS_PROB_BITS.
+#define RANS_PROB_BITS 12
+// Between symbols the state of the coder stays in [RANS_STATE_LOW, RANS_STATE_LOW << 8).
+#define RANS_STATE_LOW (1u << 23)
+
+// Bytes of the stream stored as they are (coding doesn't make them smaller).
+#define RANS_MODE_STORED 0
+// Bytes of the stream coded with its frequency table.
+#define RANS_MODE_CODED 1
+
+/// Upper bound of the size of the stream coding size bytes.
+inline size_t RansBound(size_t size) {
+	// mode, symbol bitmap, frequencies, final state and at most RANS_PROB_BITS bits a byte
+	return 1 + 32 + 2 * 256 + 4 + size + size / 2 + 8;
+}
+
+/// Codes bytes with an order-0 rANS coder (the byte-wise renormalized variant of asymmetric numeral systems)
+/// and a frequency table counted over the bytes, so every stream is decoded on its own.
+/// A stream is a mode byte followed either by the bytes (RANS_MODE_STORED) or (RANS_MODE_CODED) by a bitmap of
+/// the present symbols (32 bytes), their frequencies (a byte below 128, else two bytes with the high bit set),
+/// the final state (4 bytes, little-endian) and the renormalization bytes in decoding order.
+/// Output must have RansBound(size) bytes. Returns the size of the stream.
+inline size_t RansEncode(const unsigned char* input, size_t size, unsigned char* output) {
+	const unsigned int total = 1u << RANS_PROB_BITS;
+	size_t counts[256] = {};
+	for (size_t i = 0; i < size; i++)
+		counts[input[i]]++;
+
+	// frequencies proportional to the counts, at least 1 for the present symbols
+	unsigned int frequencies[256] = {};
+	unsigned int sum = 0;
+	for (int s = 0; s < 256; s++)
+		if (counts[s] > 0)
+		{
+			unsigned long long f = counts[s] * (unsigned long long)total / size;
+			frequencies[s] = f > 0 ? (unsigned int)f : 1;
+			sum += frequencies[s];
+		}
+	// the largest frequency takes the rounding (it stays above 1 since at most 256 symbols share 4096)
+	while (size > 0 && sum != total)
+	{
+		int largest = 0;
+		for (int s = 1; s < 256; s++)
+			if (frequencies[s] > frequencies[largest])
+				largest = s;
+		if (sum > total)
+		{
+			frequencies[largest]--;
+			sum--;
+		}
+		else
+		{
+			frequencies[largest] += total - sum;
+			sum = total;
+		}
+	}
+	unsigned int starts[256];
+	unsigned int start = 0;
+	for (int s = 0; s < 256; s++)
+	{
+		starts[s] = start;
+		start += frequencies[s];
+	}
+
+	// the stream is coded backwards from the end of the output and moved after the table
+	unsigned char* end = output + RansBound(size);
+	unsigned char* stream = end;
+	unsigned int state = RANS_STATE_LOW;
+	for (size_t i = size; i-- > 0;)
+	{
+		unsigned int f = frequencies[input[i]];
+		unsigned int limit = ((RANS_STATE_LOW >> RANS_PROB_BITS) << 8) * f;
+		while (state >= limit)
+		{
+			*--stream = (unsigned char)(state & 0xFF);
+			state >>= 8;
+		}
+		state = ((state / f) << RANS_PROB_BITS) + state % f + starts[input[i]];
+	}
+	stream -= 4;
+	for (int b = 0; b < 4; b++)
+		stream[b] = (unsigned char)(state >> (8 * b));
+
+	unsigned char* table = output + 1;
+	memset(table, 0, 32);
+	table += 32;
+	for (int s = 0; s < 256; s++)
+		if (frequencies[s] > 0)
+		{
+			output[1 + s / 8] |= (unsigned char)(1 << (s % 8));
+			if (frequencies[s] < 128)
+				*table++ = (unsigned char)frequencies[s];
+			else
+			{
+				*table++ = (unsigned char)(0x80 | (frequencies[s] >> 8));
+				*table++ = (unsigned char)(frequencies[s] & 0xFF);
+			}
+		}
+
+	size_t coded = (table - output) + (end - stream);
+	if (size == 0 || coded >= 1 + size)
+	{
+		output[0] = RANS_MODE_STORED;
+		memcpy(output + 1, input, size);
+		return 1 + size;
+	}
+	output[0] = RANS_MODE_CODED;
+	memmove(table, stream, end - stream);
+	return coded;
+}
+
+/// Decodes a stream written by RansEncode to exactly size bytes.
+/// Returns false if the stream is not valid or doesn't decode to size bytes.
+inline bool RansDecode(const unsigned char* stream, size_t streamSize, unsigned char* output, size_t size) {
+	if (streamSize < 1)
+		return false;
+	const unsigned char* end = stream + streamSize;
+	if (stream[0] == RANS_MODE_STORED)
+	{
+		if (streamSize != 1 + size)
+			return false;
+		memcpy(output, stream + 1, size);
+		return true;
+	}
+	if (stream[0] != RANS_MODE_CODED || streamSize < 1 + 32)
+		return false;
+
+	const unsigned int total = 1u << RANS_PROB_BITS;
+	const unsigned char* bitmap = stream + 1;
+	const unsigned char* p = stream + 1 + 32;
+	unsigned int frequencies[256] = {};
+	unsigned int starts[256] = {};
+	unsigned char symbols[1 << RANS_PROB_BITS];
+	unsigned int sum = 0;
+	for (int s = 0; s < 256; s++)
+	{
+		if (!(bitmap[s / 8] & (1 << (s % 8))))
+			continue;
+		if (p >= end)
+			return false;
+		unsigned int f = *p++;
+		if (f & 0x80)
+		{
+			if (p >= end)
+				return false;
+			f = ((f & 0x7F) << 8) | *p++;
+		}
+		if (f == 0 || sum + f > total)
+			return false;
+		frequencies[s] = f;
+		starts[s] = sum;
+		memset(symbols + sum, s, f);
+		sum += f;
+	}
+	if (sum != total || end - p < 4)
+		return false;
+
+	unsigned int state = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+	p += 4;
+	for (size_t i = 0; i < size; i++)
+	{
+		unsigned int slot = state & (total - 1);
+		unsigned char s = symbols[slot];
+		output[i] = s;
+		state = frequencies[s] * (state >> RANS_PROB_BITS) + slot - starts[s];
+		while (state < RANS_STATE_LOW)
+		{
+			if (p >= end)
+				return false;
+			state = (state << 8) | *p++;
+		}
+	}
+	// the decoder ends in the initial state of the coder after reading the whole stream
+	return state == RANS_STATE_LOW && p == end;
+}
+
+/// Round trips of RansEncode and RansDecode over streams of some distributions of bytes.
+struct RansCoderCheck {
+	int Streams;
+	// Streams not decoded to their bytes, and streams missing their last byte decoded without an error
+	int Mismatches;
+	int AcceptedTruncations;
+	// Coded size of skewed bytes over their order-0 entropy, and of uniform bytes over their size
+	float SkewedRatio;
+	float UniformRatio;
+};
+
+inline RansCoderCheck CheckRansCoder(int size = 1 << 16, unsigned int seed = 0) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto next = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	};
+
+	RansCoderCheck check = {};
+	unsigned char* input = new unsigned char[size];
+	unsigned char* coded = new unsigned char[RansBound(size)];
+	unsigned char* decoded = new unsigned char[size];
+	// empty, a single symbol, uniform, geometric (as the high bytes of deltas) and two symbols 255:1
+	for (int kind = 0; kind < 5; kind++)
+	{
+		int length = kind == 0 ? 0 : size;
+		for (int i = 0; i < length; i++)
+		{
+			unsigned int r = next();
+			switch (kind) {
+			case 1: input[i] = 7; break;
+			case 2: input[i] = (unsigned char)(r >> 24); break;
+			case 3: { int zeros = 0; while (zeros < 31 && !(r & (1u << zeros))) zeros++; input[i] = (unsigned char)zeros; break; }
+			default: input[i] = (r >> 24) == 0 ? 200 : 3;
+			}
+		}
+		size_t codedSize = RansEncode(input, length, coded);
+		check.Streams++;
+		if (codedSize > RansBound(length) || !RansDecode(coded, codedSize, decoded, length) || memcmp(input, decoded, length) != 0)
+			check.Mismatches++;
+		if (codedSize > 1 && RansDecode(coded, codedSize - 1, decoded, length))
+			check.AcceptedTruncations++;
+
+		if (kind == 2)
+			check.UniformRatio = codedSize / (float)length;
+		if (kind == 3)
+		{
+			int counts[256] = {};
+			for (int i = 0; i < length; i++)
+				counts[input[i]]++;
+			double bits = 0;
+			for (int s = 0; s < 256; s++)
+				if (counts[s] > 0)
+					bits -= counts[s] * log2(counts[s] / (double)length);
+			check.SkewedRatio = (float)(codedSize * 8 / bits);
+		}
+	}
+	delete[] input;
+	delete[] coded;
+	delete[] decoded;
+	return check;
+}
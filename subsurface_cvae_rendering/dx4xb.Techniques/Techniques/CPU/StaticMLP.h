@@ -0,0 +1,232 @@
+#pragma once
+
+#include "MLP.h"
+
+/// Dense layer of a StaticMLP with Outputs outputs.
+template<int Outputs_, MLPActivation Activation_>
+struct StaticLayer {
+	static const int Outputs = Outputs_;
+	static const MLPActivation Activation = Activation_;
+};
+
+/// Layers of a StaticMLP evaluated recursively, every layer with its own fixed size arrays.
+/// Parameters of a layer are its weights [Inputs][Outputs] followed by its bias (same layout than MLPModel).
+template<int Inputs, typename... Layers>
+struct StaticLayers {
+	static const int Outputs = Inputs;
+	static const int ParameterCount = 0;
+
+	static inline void Evaluate(const float*, const float* in, float* out) {
+		for (int i = 0; i < Inputs; i++)
+			out[i] = in[i];
+	}
+
+	static inline void EvaluateLanes(const float*, const batch_float* in, batch_float* out) {
+		for (int i = 0; i < Inputs; i++)
+			out[i] = in[i];
+	}
+
+	static inline void AddLayers(MLPModel&) {}
+};
+
+template<int Inputs, typename Layer, typename... Rest>
+struct StaticLayers<Inputs, Layer, Rest...> {
+	typedef StaticLayers<Layer::Outputs, Rest...> Next;
+	static const int Outputs = Next::Outputs;
+	static const int LayerParameters = Inputs * Layer::Outputs + Layer::Outputs;
+	static const int ParameterCount = LayerParameters + Next::ParameterCount;
+
+	static inline void Evaluate(const float* p, const float* in, float* out) {
+		const float* B = p + Inputs * Layer::Outputs;
+		float next[Layer::Outputs];
+		for (int o = 0; o < Layer::Outputs; o++)
+			next[o] = B[o];
+		for (int i = 0; i < Inputs; i++)
+			for (int o = 0; o < Layer::Outputs; o++)
+				next[o] += in[i] * p[i * Layer::Outputs + o];
+		ActivateValues(Layer::Activation, MLPMathMode::Accurate, next, Layer::Outputs);
+		Next::Evaluate(p + LayerParameters, next, out);
+	}
+
+	static inline void EvaluateLanes(const float* p, const batch_float* in, batch_float* out) {
+		const float* B = p + Inputs * Layer::Outputs;
+		batch_float next[Layer::Outputs];
+		for (int o = 0; o < Layer::Outputs; o++)
+			next[o] = BatchSet(B[o]);
+		for (int i = 0; i < Inputs; i++)
+			for (int o = 0; o < Layer::Outputs; o++)
+				next[o] = BatchMulAdd(BatchSet(p[i * Layer::Outputs + o]), in[i], next[o]);
+		if (Layer::Activation != MLPActivation::None)
+			for (int o = 0; o < Layer::Outputs; o++)
+				next[o] = BatchActivationFunction(Layer::Activation, next[o]);
+		Next::EvaluateLanes(p + LayerParameters, next, out);
+	}
+
+	static inline void AddLayers(MLPModel& model) {
+		model.AddLayer(Inputs, Layer::Outputs, Layer::Activation);
+		Next::AddLayers(model);
+	}
+};
+
+/// Multilayer perceptron with the sizes and activations fixed at compile time and the weights in a constexpr array
+/// (as emitted by compiling2CPP.py or WriteStaticMLP), so every loop has constant bounds and the activations stay in registers.
+/// Same semantics than MLPModel without input and output normalization, e.g.
+/// typedef StaticMLP<lenModelParameters, 4, StaticLayer<8, MLPActivation::Softplus>, StaticLayer<8, MLPActivation::Softplus>, StaticLayer<2, MLPActivation::None>> lenModelStatic;
+template<const float* Parameters, int Inputs_, typename... Layers>
+struct StaticMLP {
+	typedef StaticLayers<Inputs_, Layers...> Network;
+	static const int Inputs = Inputs_;
+	static const int Outputs = Network::Outputs;
+	static const int ParameterCount = Network::ParameterCount;
+
+	// Evaluates the network for a single input.
+	static inline void Evaluate(const float* input, float* output) {
+		Network::Evaluate(Parameters, input, output);
+	}
+
+	// Evaluates the network for count samples, stored by feature as in MLPModel::EvaluateBatch.
+	static void EvaluateBatch(const float* input, float* output, int count) {
+		batch_float in[Inputs];
+		batch_float out[Outputs];
+		int s = 0;
+		for (; s + BATCH_WIDTH <= count; s += BATCH_WIDTH)
+		{
+			for (int i = 0; i < Inputs; i++)
+				in[i] = BatchLoad(input + i * count + s);
+			Network::EvaluateLanes(Parameters, in, out);
+			for (int o = 0; o < Outputs; o++)
+				BatchStore(output + o * count + s, out[o]);
+		}
+		if (s < count)
+		{
+			// last samples padded with zeros
+			float lanes[BATCH_WIDTH];
+			for (int i = 0; i < Inputs; i++)
+			{
+				for (int k = 0; k < BATCH_WIDTH; k++)
+					lanes[k] = s + k < count ? input[i * count + s + k] : 0;
+				in[i] = BatchLoad(lanes);
+			}
+			Network::EvaluateLanes(Parameters, in, out);
+			for (int o = 0; o < Outputs; o++)
+			{
+				BatchStore(lanes, out[o]);
+				for (int k = 0; s + k < count; k++)
+					output[o * count + s + k] = lanes[k];
+			}
+		}
+	}
+
+	// Gets the network as a runtime model.
+	static void ToModel(MLPModel& model) {
+		model.Clear();
+		Network::AddLayers(model);
+		memcpy(model.Weights(0), Parameters, sizeof(float) * ParameterCount);
+	}
+};
+
+/// Writes the source of a StaticMLP with the weights of model, named name##Parameters and name##Static.
+/// Normalization of the model is not written.
+inline void WriteStaticMLP(FILE* file, const MLPModel& model, const char* name) {
+	static const char* activations[] = { "None", "Softplus", "Sigmoid", "Tanh", "ReLU" };
+
+	int count = 0;
+	for (int l = 0; l < model.LayerCount(); l++)
+		count += model.Layer(l).Inputs * model.Layer(l).Outputs + model.Layer(l).Outputs;
+	const float* parameters = model.LayerCount() == 0 ? nullptr : model.Weights(0);
+
+	fprintf(file, "constexpr float %sParameters[] = {", name);
+	for (int i = 0; i < count; i++)
+		fprintf(file, "%s%#.9gf", i == 0 ? "\n\t" : i % 8 == 0 ? ",\n\t" : ", ", parameters[i]);
+	fprintf(file, " };\n");
+
+	fprintf(file, "typedef StaticMLP<%sParameters, %d", name, model.Inputs());
+	for (int l = 0; l < model.LayerCount(); l++)
+		fprintf(file, ",\n\tStaticLayer<%d, MLPActivation::%s>", model.Layer(l).Outputs, activations[(int)model.Layer(l).Activation]);
+	fprintf(file, "> %sStatic;\n\n", name);
+}
+
+struct StaticMLPBenchmark {
+	// Single thread throughput of the runtime model and of the static network
+	float GenericSamplesPerSecond;
+	float StaticSamplesPerSecond;
+	float GenericBatchSamplesPerSecond;
+	float StaticBatchSamplesPerSecond;
+	// Maximum relative error (|a - b| / max(1, |b|)) of the static network against MLPModel::Evaluate (finite outputs)
+	float MaxError;
+};
+
+/// Compares a static network with the same network evaluated by MLPModel, sample by sample and in batches of batchSize samples.
+template<typename Static>
+inline StaticMLPBenchmark BenchmarkStaticMLP(int batchSize = 1024, int samples = 1 << 18, unsigned int seed = 0) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto uniform = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	MLPModel model;
+	Static::ToModel(model);
+
+	const int inputs = Static::Inputs, outputs = Static::Outputs;
+	int batches = max(1, samples / batchSize);
+	samples = batches * batchSize;
+
+	// Sample by sample data is stored by sample, batched data by feature inside every batch
+	float* input = new float[samples * inputs];
+	float* batchInput = new float[samples * inputs];
+	float* genericOutput = new float[samples * outputs];
+	float* staticOutput = new float[samples * outputs];
+	float* batchOutput = new float[samples * outputs];
+	for (int s = 0; s < samples; s++)
+		for (int i = 0; i < inputs; i++)
+		{
+			float x = uniform() * 4 - 2;
+			input[s * inputs + i] = x;
+			batchInput[(s / batchSize) * batchSize * inputs + i * batchSize + s % batchSize] = x;
+		}
+
+	StaticMLPBenchmark result = {};
+
+	Stopwatch stopwatch;
+	for (int s = 0; s < samples; s++)
+		model.Evaluate(input + s * inputs, genericOutput + s * outputs);
+	result.GenericSamplesPerSecond = samples * 1000.0f / stopwatch.Milliseconds();
+
+	stopwatch.Start();
+	for (int s = 0; s < samples; s++)
+		Static::Evaluate(input + s * inputs, staticOutput + s * outputs);
+	result.StaticSamplesPerSecond = samples * 1000.0f / stopwatch.Milliseconds();
+
+	stopwatch.Start();
+	for (int b = 0; b < batches; b++)
+		model.EvaluateBatch(batchInput + b * batchSize * inputs, batchOutput + b * batchSize * outputs, batchSize);
+	result.GenericBatchSamplesPerSecond = samples * 1000.0f / stopwatch.Milliseconds();
+
+	stopwatch.Start();
+	for (int b = 0; b < batches; b++)
+		Static::EvaluateBatch(batchInput + b * batchSize * inputs, batchOutput + b * batchSize * outputs, batchSize);
+	result.StaticBatchSamplesPerSecond = samples * 1000.0f / stopwatch.Milliseconds();
+
+	auto error = [](float value, float expected) {
+		return fabsf(value - expected) / maxf(1.0f, fabsf(expected));
+	};
+	for (int s = 0; s < samples; s++)
+		for (int o = 0; o < outputs; o++)
+		{
+			float expected = genericOutput[s * outputs + o];
+			if (!isfinite(expected)) // softplus overflow, same in both
+				continue;
+			result.MaxError = maxf(result.MaxError, error(staticOutput[s * outputs + o], expected));
+			result.MaxError = maxf(result.MaxError, error(batchOutput[(s / batchSize) * batchSize * outputs + o * batchSize + s % batchSize], expected));
+		}
+
+	delete[] input;
+	delete[] batchInput;
+	delete[] genericOutput;
+	delete[] staticOutput;
+	delete[] batchOutput;
+	return result;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <chrono>
+
+/// High resolution timer for CPU measures.
+class Stopwatch {
+	std::chrono::steady_clock::time_point start;
+
+public:
+	Stopwatch() {
+		Start();
+	}
+
+	void Start() {
+		start = std::chrono::steady_clock::now();
+	}
+
+	// Time since the last start.
+	float Milliseconds() const {
+		return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+	}
+};
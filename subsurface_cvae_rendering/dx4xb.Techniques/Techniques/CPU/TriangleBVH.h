@@ -0,0 +1,332 @@
+#pragma once
+
+#include "dx4xb_math.h"
+
+using namespace dx4xb;
+
+// Bins of the surface area heuristic per axis when splitting a node.
+#define BVH_BINS 16
+// Max triangles in a leaf, larger nodes are split while the heuristic finds a split.
+#define BVH_LEAF_SIZE 4
+// Nodes larger than this are always split (at the middle if the heuristic finds nothing better).
+#define BVH_MAX_LEAF_SIZE 16
+#define BVH_MAX_DEPTH 64
+
+/// Closest intersection of a ray with a TriangleBVH. U and V are the weights of the second and third vertices,
+/// as the barycentrics of BuiltInTriangleIntersectionAttributes.
+struct TriangleHit {
+	// Index of the triangle when built, -1 if missed
+	int Triangle;
+	float T;
+	float U, V;
+};
+
+struct BVHNode {
+	float3 Minimum;
+	// Leaves: first triangle. Inner nodes: right child (the left child is the next node)
+	int First;
+	float3 Maximum;
+	// Triangles of a leaf, 0 for inner nodes
+	int Count;
+};
+
+/// Bounding volume hierarchy of triangles for closest hit queries on CPU, as TraceRay with RAY_FLAG_FORCE_OPAQUE.
+/// Built top-down with a binned surface area heuristic (Wald, On fast Construction of SAH-based Bounding Volume Hierarchies)
+/// and traversed depth first visiting the nearest child first. Intersections are Moller-Trumbore without culling.
+class TriangleBVH {
+	BVHNode* nodes = nullptr;
+	int nodeCount = 0;
+	// Vertex A and edges AB and AC of the triangles in the order of the leaves
+	float3* A = nullptr;
+	float3* AB = nullptr;
+	float3* AC = nullptr;
+	// Index when built of the triangles in the order of the leaves
+	int* order = nullptr;
+	int triangleCount = 0;
+	int depth = 0;
+
+	// Only used while building
+	float3* boxMinimum = nullptr;
+	float3* boxMaximum = nullptr;
+	float3* centroids = nullptr;
+
+	static inline float Component(const float3& v, int axis) {
+		return axis == 0 ? v.x : axis == 1 ? v.y : v.z;
+	}
+
+	static inline float HalfArea(const float3& minimum, const float3& maximum) {
+		float3 e = maximum - minimum;
+		return e.x * e.y + e.y * e.z + e.z * e.x;
+	}
+
+	int BuildNode(int start, int end, int level) {
+		int index = nodeCount++;
+		BVHNode& node = nodes[index];
+		depth = max(depth, level + 1);
+
+		float3 minimum = float3(1e30f, 1e30f, 1e30f), maximum = float3(-1e30f, -1e30f, -1e30f);
+		float3 cMinimum = minimum, cMaximum = maximum;
+		for (int i = start; i < end; i++)
+		{
+			minimum = minf(minimum, boxMinimum[order[i]]);
+			maximum = maxf(maximum, boxMaximum[order[i]]);
+			cMinimum = minf(cMinimum, centroids[order[i]]);
+			cMaximum = maxf(cMaximum, centroids[order[i]]);
+		}
+		node.Minimum = minimum;
+		node.Maximum = maximum;
+
+		int count = end - start;
+		if (count <= BVH_LEAF_SIZE || level + 1 >= BVH_MAX_DEPTH)
+		{
+			node.First = start;
+			node.Count = count;
+			return index;
+		}
+
+		// Binned SAH over the three axes, cost in units of a triangle test with a node visit as 1
+		int bestAxis = -1, bestBin = 0;
+		float bestCost = (float)count;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float low = Component(cMinimum, axis), extent = Component(cMaximum, axis) - low;
+			if (extent <= 0)
+				continue;
+			float scale = BVH_BINS / extent;
+
+			int binCount[BVH_BINS] = {};
+			float3 binMinimum[BVH_BINS], binMaximum[BVH_BINS];
+			for (int b = 0; b < BVH_BINS; b++)
+			{
+				binMinimum[b] = float3(1e30f, 1e30f, 1e30f);
+				binMaximum[b] = float3(-1e30f, -1e30f, -1e30f);
+			}
+			for (int i = start; i < end; i++)
+			{
+				int t = order[i];
+				int b = min(BVH_BINS - 1, (int)((Component(centroids[t], axis) - low) * scale));
+				binCount[b]++;
+				binMinimum[b] = minf(binMinimum[b], boxMinimum[t]);
+				binMaximum[b] = maxf(binMaximum[b], boxMaximum[t]);
+			}
+
+			// Costs of the right sides swept from the end, then the left sides from the start
+			float rightCost[BVH_BINS];
+			float3 sweepMinimum = float3(1e30f, 1e30f, 1e30f), sweepMaximum = float3(-1e30f, -1e30f, -1e30f);
+			int sweepCount = 0;
+			for (int b = BVH_BINS - 1; b > 0; b--)
+			{
+				sweepCount += binCount[b];
+				sweepMinimum = minf(sweepMinimum, binMinimum[b]);
+				sweepMaximum = maxf(sweepMaximum, binMaximum[b]);
+				rightCost[b] = sweepCount == 0 ? 0 : sweepCount * HalfArea(sweepMinimum, sweepMaximum);
+			}
+			sweepMinimum = float3(1e30f, 1e30f, 1e30f);
+			sweepMaximum = float3(-1e30f, -1e30f, -1e30f);
+			sweepCount = 0;
+			float invArea = 1 / maxf(1e-30f, HalfArea(minimum, maximum));
+			for (int b = 0; b < BVH_BINS - 1; b++)
+			{
+				sweepCount += binCount[b];
+				sweepMinimum = minf(sweepMinimum, binMinimum[b]);
+				sweepMaximum = maxf(sweepMaximum, binMaximum[b]);
+				if (sweepCount == 0 || sweepCount == count)
+					continue;
+				float cost = 1 + (sweepCount * HalfArea(sweepMinimum, sweepMaximum) + rightCost[b + 1]) * invArea;
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestBin = b;
+				}
+			}
+		}
+
+		int middle;
+		if (bestAxis >= 0)
+		{
+			float low = Component(cMinimum, bestAxis);
+			float scale = BVH_BINS / (Component(cMaximum, bestAxis) - low);
+			int i = start, j = end - 1;
+			while (i <= j)
+			{
+				if (min(BVH_BINS - 1, (int)((Component(centroids[order[i]], bestAxis) - low) * scale)) <= bestBin)
+					i++;
+				else
+				{
+					int swap = order[i];
+					order[i] = order[j];
+					order[j--] = swap;
+				}
+			}
+			middle = i;
+		}
+		else if (count <= BVH_MAX_LEAF_SIZE)
+		{
+			node.First = start;
+			node.Count = count;
+			return index;
+		}
+		else // no split is better or centroids are coincident, halves in the current order
+			middle = (start + end) / 2;
+
+		node.Count = 0;
+		BuildNode(start, middle, level + 1);
+		int right = BuildNode(middle, end, level + 1);
+		node.First = right;
+		return index;
+	}
+
+	static inline bool IntersectBox(const BVHNode& node, const float3& O, const float3& invD, float tMax, float& tEnter) {
+		float tx0 = (node.Minimum.x - O.x) * invD.x, tx1 = (node.Maximum.x - O.x) * invD.x;
+		float ty0 = (node.Minimum.y - O.y) * invD.y, ty1 = (node.Maximum.y - O.y) * invD.y;
+		float tz0 = (node.Minimum.z - O.z) * invD.z, tz1 = (node.Maximum.z - O.z) * invD.z;
+		float t0 = maxf(maxf(minf(tx0, tx1), minf(ty0, ty1)), maxf(minf(tz0, tz1), 0.0f));
+		float t1 = minf(minf(maxf(tx0, tx1), maxf(ty0, ty1)), minf(maxf(tz0, tz1), tMax));
+		tEnter = t0;
+		return t0 <= t1;
+	}
+
+public:
+	TriangleBVH() {}
+	TriangleBVH(const TriangleBVH&) = delete;
+	TriangleBVH& operator=(const TriangleBVH&) = delete;
+
+	~TriangleBVH() {
+		Clear();
+	}
+
+	void Clear() {
+		delete[] nodes;
+		delete[] A;
+		delete[] AB;
+		delete[] AC;
+		delete[] order;
+		nodes = nullptr;
+		A = AB = AC = nullptr;
+		order = nullptr;
+		nodeCount = triangleCount = depth = 0;
+	}
+
+	// Builds the hierarchy of count triangles given by three positions each.
+	void Build(const float3* positions, int count) {
+		Clear();
+		triangleCount = count;
+		if (count == 0)
+			return;
+
+		order = new int[count];
+		boxMinimum = new float3[count];
+		boxMaximum = new float3[count];
+		centroids = new float3[count];
+		for (int t = 0; t < count; t++)
+		{
+			const float3& a = positions[t * 3 + 0];
+			const float3& b = positions[t * 3 + 1];
+			const float3& c = positions[t * 3 + 2];
+			order[t] = t;
+			boxMinimum[t] = minf(a, minf(b, c));
+			boxMaximum[t] = maxf(a, maxf(b, c));
+			centroids[t] = (boxMinimum[t] + boxMaximum[t]) * 0.5f;
+		}
+
+		nodes = new BVHNode[count * 2];
+		BuildNode(0, count, 0);
+
+		delete[] boxMinimum;
+		delete[] boxMaximum;
+		delete[] centroids;
+		boxMinimum = boxMaximum = centroids = nullptr;
+
+		A = new float3[count];
+		AB = new float3[count];
+		AC = new float3[count];
+		for (int i = 0; i < count; i++)
+		{
+			const float3* p = positions + order[i] * 3;
+			A[i] = p[0];
+			AB[i] = p[1] - p[0];
+			AC[i] = p[2] - p[0];
+		}
+	}
+
+	int TriangleCount() const { return triangleCount; }
+	int NodeCount() const { return nodeCount; }
+	int Depth() const { return depth; }
+
+	// Closest intersection with t in (0, tMax]. Returns false if missed (hit.Triangle = -1).
+	bool Intersect(const float3& O, const float3& D, float tMax, TriangleHit& hit) const {
+		hit.Triangle = -1;
+		hit.T = tMax;
+		hit.U = hit.V = 0;
+		if (nodeCount == 0)
+			return false;
+
+		float3 invD = float3(
+			D.x == 0 ? 1e30f : 1 / D.x,
+			D.y == 0 ? 1e30f : 1 / D.y,
+			D.z == 0 ? 1e30f : 1 / D.z);
+
+		int stack[BVH_MAX_DEPTH * 2];
+		int top = 0;
+		float tEnter;
+		if (!IntersectBox(nodes[0], O, invD, tMax, tEnter))
+			return false;
+		stack[top++] = 0;
+		while (top > 0)
+		{
+			const BVHNode& node = nodes[stack[--top]];
+			if (node.Count > 0)
+			{
+				for (int i = node.First; i < node.First + node.Count; i++)
+				{
+					float3 p = cross(D, AC[i]);
+					float det = dot(AB[i], p);
+					if (det == 0)
+						continue;
+					float invDet = 1 / det;
+					float3 s = O - A[i];
+					float u = dot(s, p) * invDet;
+					if (u < 0 || u > 1)
+						continue;
+					float3 q = cross(s, AB[i]);
+					float v = dot(D, q) * invDet;
+					if (v < 0 || u + v > 1)
+						continue;
+					float t = dot(AC[i], q) * invDet;
+					if (t > 0 && t <= hit.T)
+					{
+						hit.Triangle = order[i];
+						hit.T = t;
+						hit.U = u;
+						hit.V = v;
+					}
+				}
+				continue;
+			}
+			// Pushes the farthest child first, children behind the closest hit are skipped
+			int left = (int)(&node - nodes) + 1, right = node.First;
+			float tLeft, tRight;
+			bool hitLeft = IntersectBox(nodes[left], O, invD, hit.T, tLeft);
+			bool hitRight = IntersectBox(nodes[right], O, invD, hit.T, tRight);
+			if (hitLeft && hitRight)
+			{
+				if (tLeft <= tRight)
+				{
+					stack[top++] = right;
+					stack[top++] = left;
+				}
+				else
+				{
+					stack[top++] = left;
+					stack[top++] = right;
+				}
+			}
+			else if (hitLeft)
+				stack[top++] = left;
+			else if (hitRight)
+				stack[top++] = right;
+		}
+		return hit.Triangle >= 0;
+	}
+};
@@ -0,0 +1,396 @@
+#pragma once
+
+#include "dx4xb_math.h"
+#include "BatchFloat.h"
+#include "Distances.h"
+#include "Stopwatch.h"
+
+using namespace dx4xb;
+
+#pragma region Batch lanes
+
+// A batch evaluates one point against TRIANGLE_BATCH_WIDTH triangles at once.
+#define TRIANGLE_BATCH_WIDTH BATCH_WIDTH
+
+// Per lane, inside if v >= 0, w >= 0, v + w <= 1 and invDenom > 0, outside otherwise.
+#if defined(__AVX512F__)
+inline batch_float BatchSelectInside(batch_float v, batch_float w, batch_float invDenom, batch_float inside, batch_float outside) {
+	__m512 zero = _mm512_setzero_ps();
+	__mmask16 mask =
+		_mm512_cmp_ps_mask(v, zero, _CMP_GE_OQ) &
+		_mm512_cmp_ps_mask(w, zero, _CMP_GE_OQ) &
+		_mm512_cmp_ps_mask(_mm512_add_ps(v, w), _mm512_set1_ps(1), _CMP_LE_OQ) &
+		_mm512_cmp_ps_mask(invDenom, zero, _CMP_GT_OQ);
+	return _mm512_mask_blend_ps(mask, outside, inside);
+}
+#elif defined(__AVX2__)
+inline batch_float BatchSelectInside(batch_float v, batch_float w, batch_float invDenom, batch_float inside, batch_float outside) {
+	__m256 zero = _mm256_setzero_ps();
+	__m256 mask = _mm256_and_ps(
+		_mm256_and_ps(_mm256_cmp_ps(v, zero, _CMP_GE_OQ), _mm256_cmp_ps(w, zero, _CMP_GE_OQ)),
+		_mm256_and_ps(_mm256_cmp_ps(_mm256_add_ps(v, w), _mm256_set1_ps(1), _CMP_LE_OQ), _mm256_cmp_ps(invDenom, zero, _CMP_GT_OQ)));
+	return _mm256_blendv_ps(outside, inside, mask);
+}
+#else
+inline batch_float BatchSelectInside(batch_float v, batch_float w, batch_float invDenom, batch_float inside, batch_float outside) {
+	for (int i = 0; i < TRIANGLE_BATCH_WIDTH; i++)
+		if (v.v[i] >= 0 && w.v[i] >= 0 && v.v[i] + w.v[i] <= 1 && invDenom.v[i] > 0)
+			outside.v[i] = inside.v[i];
+	return outside;
+}
+#endif
+
+#pragma endregion
+
+/// Triangles prepared to compute distances from a point to all of them at once (structure of arrays).
+/// Everything that only depends on the triangle (edges, normal, barycentric system and edge lengths) is
+/// computed once when the triangle is set, so a query is only products, sums and min/max.
+/// The distance is the distance to the plane if the projection is inside the triangle and the minimum distance
+/// to the three edges otherwise. Unused lanes hold a triangle far away.
+class TriangleBatch {
+public:
+	static const int Width = TRIANGLE_BATCH_WIDTH;
+
+	// Vertex A
+	alignas(64) float Ax[Width], Ay[Width], Az[Width];
+	// Edges AB, AC and BC
+	alignas(64) float ABx[Width], ABy[Width], ABz[Width];
+	alignas(64) float ACx[Width], ACy[Width], ACz[Width];
+	alignas(64) float BCx[Width], BCy[Width], BCz[Width];
+	// Unit normal
+	alignas(64) float Nx[Width], Ny[Width], Nz[Width];
+	// Barycentric system of the projection (dot products of AB and AC and the inverse of its determinant, 0 if degenerated)
+	alignas(64) float D00[Width], D01[Width], D11[Width], InvDenom[Width];
+	// Inverse of the squared length of the edges (0 if degenerated)
+	alignas(64) float InvAB2[Width], InvAC2[Width], InvBC2[Width];
+	// Number of lanes set
+	int Count;
+
+	TriangleBatch() {
+		Clear();
+	}
+
+	// Fills all lanes with a triangle far away.
+	void Clear() {
+		for (int lane = 0; lane < Width; lane++)
+			Set(lane, float3(1e15f, 1e15f, 1e15f), float3(1e15f, 1e15f, 1e15f), float3(1e15f, 1e15f, 1e15f));
+		Count = 0;
+	}
+
+	void Set(int lane, float3 a, float3 b, float3 c) {
+		float3 ab = b - a, ac = c - a, bc = c - b;
+		float3 abxac = cross(ab, ac);
+		float3 n = normalize(abxac);
+		float d00 = dot(ab, ab), d01 = dot(ab, ac), d11 = dot(ac, ac);
+		// d00 * d11 - d01 * d01 without the cancellation for thin triangles
+		float denom = dot(abxac, abxac);
+
+		Ax[lane] = a.x; Ay[lane] = a.y; Az[lane] = a.z;
+		ABx[lane] = ab.x; ABy[lane] = ab.y; ABz[lane] = ab.z;
+		ACx[lane] = ac.x; ACy[lane] = ac.y; ACz[lane] = ac.z;
+		BCx[lane] = bc.x; BCy[lane] = bc.y; BCz[lane] = bc.z;
+		Nx[lane] = n.x; Ny[lane] = n.y; Nz[lane] = n.z;
+		D00[lane] = d00; D01[lane] = d01; D11[lane] = d11;
+		InvDenom[lane] = denom > 1e-12f * d00 * d11 ? 1 / denom : 0;
+		InvAB2[lane] = d00 > 0 ? 1 / d00 : 0;
+		InvAC2[lane] = d11 > 0 ? 1 / d11 : 0;
+		float dbc = dot(bc, bc);
+		InvBC2[lane] = dbc > 0 ? 1 / dbc : 0;
+	}
+
+	// Adds a triangle in the next free lane. Returns false if the batch is full.
+	bool Add(float3 a, float3 b, float3 c) {
+		if (Count == Width)
+			return false;
+		Set(Count++, a, b, c);
+		return true;
+	}
+
+	// Squared distances from p to every lane.
+	inline batch_float SquaredDistances(float3 p) const {
+		batch_float zero = BatchSet(0), one = BatchSet(1);
+
+		// AP
+		batch_float apx = BatchSub(BatchSet(p.x), BatchLoad(Ax));
+		batch_float apy = BatchSub(BatchSet(p.y), BatchLoad(Ay));
+		batch_float apz = BatchSub(BatchSet(p.z), BatchLoad(Az));
+
+		batch_float abx = BatchLoad(ABx), aby = BatchLoad(ABy), abz = BatchLoad(ABz);
+		batch_float acx = BatchLoad(ACx), acy = BatchLoad(ACy), acz = BatchLoad(ACz);
+
+		// Projection on the plane in barycentric coordinates
+		batch_float d20 = BatchAdd(BatchAdd(BatchMul(apx, abx), BatchMul(apy, aby)), BatchMul(apz, abz));
+		batch_float d21 = BatchAdd(BatchAdd(BatchMul(apx, acx), BatchMul(apy, acy)), BatchMul(apz, acz));
+		batch_float d00 = BatchLoad(D00), d01 = BatchLoad(D01), d11 = BatchLoad(D11), invDenom = BatchLoad(InvDenom);
+		batch_float v = BatchMul(BatchSub(BatchMul(d11, d20), BatchMul(d01, d21)), invDenom);
+		batch_float w = BatchMul(BatchSub(BatchMul(d00, d21), BatchMul(d01, d20)), invDenom);
+
+		batch_float plane = BatchAdd(BatchAdd(
+			BatchMul(apx, BatchLoad(Nx)), BatchMul(apy, BatchLoad(Ny))), BatchMul(apz, BatchLoad(Nz)));
+		batch_float planeSq = BatchMul(plane, plane);
+
+		// Edge AB
+		batch_float t = BatchMin(one, BatchMax(zero, BatchMul(d20, BatchLoad(InvAB2))));
+		batch_float ex = BatchSub(apx, BatchMul(t, abx));
+		batch_float ey = BatchSub(apy, BatchMul(t, aby));
+		batch_float ez = BatchSub(apz, BatchMul(t, abz));
+		batch_float edgeSq = BatchAdd(BatchAdd(BatchMul(ex, ex), BatchMul(ey, ey)), BatchMul(ez, ez));
+
+		// Edge AC
+		t = BatchMin(one, BatchMax(zero, BatchMul(d21, BatchLoad(InvAC2))));
+		ex = BatchSub(apx, BatchMul(t, acx));
+		ey = BatchSub(apy, BatchMul(t, acy));
+		ez = BatchSub(apz, BatchMul(t, acz));
+		edgeSq = BatchMin(edgeSq, BatchAdd(BatchAdd(BatchMul(ex, ex), BatchMul(ey, ey)), BatchMul(ez, ez)));
+
+		// Edge BC
+		batch_float bpx = BatchSub(apx, abx), bpy = BatchSub(apy, aby), bpz = BatchSub(apz, abz);
+		batch_float bcx = BatchLoad(BCx), bcy = BatchLoad(BCy), bcz = BatchLoad(BCz);
+		batch_float d = BatchAdd(BatchAdd(BatchMul(bpx, bcx), BatchMul(bpy, bcy)), BatchMul(bpz, bcz));
+		t = BatchMin(one, BatchMax(zero, BatchMul(d, BatchLoad(InvBC2))));
+		ex = BatchSub(bpx, BatchMul(t, bcx));
+		ey = BatchSub(bpy, BatchMul(t, bcy));
+		ez = BatchSub(bpz, BatchMul(t, bcz));
+		edgeSq = BatchMin(edgeSq, BatchAdd(BatchAdd(BatchMul(ex, ex), BatchMul(ey, ey)), BatchMul(ez, ez)));
+
+		return BatchSelectInside(v, w, invDenom, planeSq, edgeSq);
+	}
+
+	// Distances from p to every lane (Width values).
+	void Distances(float3 p, float* distances) const {
+		alignas(64) float squared[Width];
+		BatchStore(squared, SquaredDistances(p));
+		for (int lane = 0; lane < Width; lane++)
+			distances[lane] = sqrtf(squared[lane]);
+	}
+
+	// Distance from p to the closest triangle of the batch.
+	float MinDistance(float3 p) const {
+		return sqrtf(BatchMinimum(SquaredDistances(p)));
+	}
+};
+
+/// Exact distance from a point to a triangle in double precision, the reference of CheckTriangleBatch.
+/// The closest point is the projection on the plane when it falls inside the triangle, otherwise it is on
+/// the border, so the distance is the minimum of the plane (if inside) and the three segments (vertices included).
+inline double ExactTriangleDistance(float3 p, float3 a, float3 b, float3 c) {
+	double P[3] = { p.x, p.y, p.z };
+	double V[3][3] = { { a.x, a.y, a.z }, { b.x, b.y, b.z }, { c.x, c.y, c.z } };
+	auto sub = [](const double* x, const double* y, double* r) { r[0] = x[0] - y[0]; r[1] = x[1] - y[1]; r[2] = x[2] - y[2]; };
+	auto dot3 = [](const double* x, const double* y) { return x[0] * y[0] + x[1] * y[1] + x[2] * y[2]; };
+	auto cross3 = [](const double* x, const double* y, double* r) {
+		r[0] = x[1] * y[2] - x[2] * y[1];
+		r[1] = x[2] * y[0] - x[0] * y[2];
+		r[2] = x[0] * y[1] - x[1] * y[0];
+	};
+
+	double best = 1e300;
+	for (int e = 0; e < 3; e++)
+	{
+		const double* s0 = V[e];
+		const double* s1 = V[(e + 1) % 3];
+		double d[3], ps[3];
+		sub(s1, s0, d);
+		sub(P, s0, ps);
+		double dd = dot3(d, d);
+		double t = dd > 0 ? fmin(1.0, fmax(0.0, dot3(ps, d) / dd)) : 0;
+		double r[3] = { ps[0] - t * d[0], ps[1] - t * d[1], ps[2] - t * d[2] };
+		best = fmin(best, dot3(r, r));
+	}
+
+	double ab[3], ac[3], ap[3], n[3];
+	sub(V[1], V[0], ab);
+	sub(V[2], V[0], ac);
+	sub(P, V[0], ap);
+	cross3(ab, ac, n);
+	double nn = dot3(n, n);
+	if (nn > 0)
+	{
+		// barycentric coordinates of the projection, signed areas against the normal
+		double bp[3], cp[3], bc[3], ca[3];
+		sub(P, V[1], bp);
+		sub(P, V[2], cp);
+		sub(V[2], V[1], bc);
+		sub(V[0], V[2], ca);
+		double u[3], v[3], w[3];
+		cross3(bc, bp, u);
+		cross3(ca, cp, v);
+		cross3(ab, ap, w);
+		if (dot3(u, n) >= 0 && dot3(v, n) >= 0 && dot3(w, n) >= 0)
+		{
+			double plane = dot3(ap, n);
+			best = fmin(best, plane * plane / nn);
+		}
+	}
+	return sqrt(best);
+}
+
+// Comparison of the batch against an exact double precision reference.
+struct TriangleBatchCheck {
+	int Tests;
+	// Largest difference with the exact distance over all the cases.
+	float MaxError;
+	// Cases where the batch is larger than the exact distance by more than the tolerance (must be 0).
+	int Larger;
+	// Cases where the batch is smaller than the exact distance by more than the tolerance (must be 0),
+	// too small distances make a distance field non-conservative.
+	int Smaller;
+	// Report only: cases where distanceP2T (the HLSL equivalent routine) differs from the exact distance.
+	// It chooses the edge with the first negative barycentric coordinate, which is not always the closest one
+	// for obtuse triangles.
+	int ReferenceMismatches;
+	float ReferenceMaxError;
+};
+
+/// Checks the batch with random triangles (including thin and degenerated ones) and points close to their
+/// vertices, edges and faces or far from them.
+/// tolerance is relative to the size of the triangles (unit).
+inline TriangleBatchCheck CheckTriangleBatch(int tests = 100000, float tolerance = 1e-4f, unsigned int seed = 0) {
+	// xorshift32 (<random> can not be used with Windows min/max macros)
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto uniform = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+	auto randomPoint = [&uniform](float scale) {
+		return float3(uniform() - 0.5f, uniform() - 0.5f, uniform() - 0.5f) * scale;
+	};
+
+	TriangleBatchCheck check = { 0, 0, 0, 0, 0, 0 };
+	TriangleBatch batch;
+	float3 t[TRIANGLE_BATCH_WIDTH][3];
+	float distances[TRIANGLE_BATCH_WIDTH];
+
+	while (check.Tests < tests)
+	{
+		batch.Clear();
+		for (int lane = 0; lane < TRIANGLE_BATCH_WIDTH; lane++)
+		{
+			t[lane][0] = randomPoint(1);
+			t[lane][1] = randomPoint(1);
+			switch (lane % 4) {
+			case 0: // degenerated (collinear)
+				t[lane][2] = lerp(t[lane][0], t[lane][1], float3(uniform()));
+				break;
+			case 1: // thin
+				t[lane][2] = lerp(t[lane][0], t[lane][1], float3(uniform())) + randomPoint(0.01f);
+				break;
+			default:
+				t[lane][2] = randomPoint(1);
+			}
+			batch.Add(t[lane][0], t[lane][1], t[lane][2]);
+		}
+
+		for (int i = 0; i < 16; i++)
+		{
+			// far, then close to a vertex, an edge and the face of one of the triangles
+			int target = (int)(uniform() * TRIANGLE_BATCH_WIDTH) % TRIANGLE_BATCH_WIDTH;
+			const float3* v = t[target];
+			float3 p;
+			switch (i % 4) {
+			case 0:
+				p = randomPoint(3);
+				break;
+			case 1:
+				p = v[i / 4 % 3] + randomPoint(0.05f);
+				break;
+			case 2:
+				p = lerp(v[i / 4 % 3], v[(i / 4 + 1) % 3], float3(uniform())) + randomPoint(0.05f);
+				break;
+			default:
+			{
+				float u = uniform(), w = uniform();
+				if (u + w > 1) { u = 1 - u; w = 1 - w; }
+				p = v[0] + (v[1] - v[0]) * u + (v[2] - v[0]) * w + randomPoint(0.05f);
+			}
+			}
+			batch.Distances(p, distances);
+			for (int lane = 0; lane < TRIANGLE_BATCH_WIDTH; lane++)
+			{
+				double exact = ExactTriangleDistance(p, t[lane][0], t[lane][1], t[lane][2]);
+				float difference = (float)(distances[lane] - exact);
+				if (difference > tolerance)
+					check.Larger++;
+				else if (difference < -tolerance)
+					check.Smaller++;
+				check.MaxError = maxf(check.MaxError, fabsf(difference));
+
+				// distanceP2T accepts the plane of a degenerated triangle (rounding gives it a normal),
+				// those are compared with the distance to the segments instead.
+				float reference = lane % 4 == 0 ?
+					minf(distanceP2S(p, t[lane][0], t[lane][1]), minf(distanceP2S(p, t[lane][1], t[lane][2]), distanceP2S(p, t[lane][2], t[lane][0]))) :
+					distanceP2T(p, t[lane][0], t[lane][1], t[lane][2]);
+				float referenceError = (float)fabs(reference - exact);
+				if (referenceError > tolerance)
+					check.ReferenceMismatches++;
+				check.ReferenceMaxError = maxf(check.ReferenceMaxError, referenceError);
+				check.Tests++;
+			}
+		}
+	}
+	return check;
+}
+
+// Result of the batch benchmark.
+struct TriangleBatchBenchmark {
+	int Width;
+	// Nanoseconds per point-triangle distance.
+	float ScalarNanoseconds;
+	float BatchNanoseconds;
+	float Speedup;
+};
+
+/// Measures the minimum distance from points to a set of triangles with distanceP2T and with batches.
+inline TriangleBatchBenchmark BenchmarkTriangleBatch(int triangles = 4096, int points = 1024, unsigned int seed = 0) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto uniform = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	int batchCount = (triangles + TRIANGLE_BATCH_WIDTH - 1) / TRIANGLE_BATCH_WIDTH;
+	float3* vertices = new float3[triangles * 3];
+	float3* queries = new float3[points];
+	TriangleBatch* batches = new TriangleBatch[batchCount];
+
+	for (int i = 0; i < triangles * 3; i++)
+		vertices[i] = float3(uniform(), uniform(), uniform());
+	for (int i = 0; i < points; i++)
+		queries[i] = float3(uniform(), uniform(), uniform());
+	for (int i = 0; i < triangles; i++)
+		batches[i / TRIANGLE_BATCH_WIDTH].Add(vertices[i * 3 + 0], vertices[i * 3 + 1], vertices[i * 3 + 2]);
+
+	TriangleBatchBenchmark result = {};
+	result.Width = TRIANGLE_BATCH_WIDTH;
+	volatile float sink = 0;
+
+	Stopwatch stopwatch;
+	for (int p = 0; p < points; p++)
+	{
+		float m = 1e30f;
+		for (int i = 0; i < triangles; i++)
+			m = minf(m, distanceP2T(queries[p], vertices[i * 3 + 0], vertices[i * 3 + 1], vertices[i * 3 + 2]));
+		sink = sink + m;
+	}
+	result.ScalarNanoseconds = stopwatch.Milliseconds() * 1e6f / ((float)points * triangles);
+
+	stopwatch.Start();
+	for (int p = 0; p < points; p++)
+	{
+		batch_float m = BatchSet(1e30f);
+		for (int b = 0; b < batchCount; b++)
+			m = BatchMin(m, batches[b].SquaredDistances(queries[p]));
+		sink = sink + sqrtf(BatchMinimum(m));
+	}
+	result.BatchNanoseconds = stopwatch.Milliseconds() * 1e6f / ((float)points * triangles);
+	result.Speedup = result.ScalarNanoseconds / result.BatchNanoseconds;
+
+	delete[] vertices;
+	delete[] queries;
+	delete[] batches;
+	return result;
+}
@@ -0,0 +1,593 @@
+#pragma once
+
+#include "CVAESampling.h"
+
+/// Batched CPU version of GenerateVariablesWithModel and GenerateFullVariablesWithModel (see CVAESampling.h).
+/// Inputs, random numbers and outputs of the samples are stored by feature and processed BATCH_WIDTH samples at once,
+/// the networks are evaluated with MLPModel::EvaluateBatch. Only the samples that are not absorbed go through the path
+/// and scattering networks.
+/// Usage: Resize, write G, Phi, Density and Win of every sample, GenerateLatents (or SetLatents) and sample.
+class CVAESampleBatch {
+	float* data = nullptr;
+	int capacity = 0;
+	int count = 0;
+	int stride = 0;
+
+	// Inputs and outputs of the networks by feature (count samples) and the compacted samples that are not absorbed
+	float* lenInputs = nullptr;
+	float* lenOutputs = nullptr;
+	float* pathInputs = nullptr;
+	float* pathOutputs = nullptr;
+	float* scatInputs = nullptr;
+	float* scatOutputs = nullptr;
+	int* exits = nullptr;
+	int exitCount = 0;
+
+	// Columns of the compacted samples
+	float* cWin[3];
+	float* cR0[3];
+	float* cR1[3];
+	float* cPathSample[3];
+	float* cRotation;
+	float* cN;
+	float* cPhi;
+
+	CVAESampleBatch(const CVAESampleBatch&) = delete;
+	CVAESampleBatch& operator=(const CVAESampleBatch&) = delete;
+
+public:
+	// Inputs
+	float* G;
+	float* Phi;
+	float* Density;
+	float* Win[3];
+
+	// Random numbers, CVAELatents by feature
+	float* Rotation;
+	float* Len[2];
+	float* LenSample;
+	float* Absorption;
+	float* Path[5];
+	float* PathSample[3];
+	float* Scat[5];
+	float* ScatSample[6];
+
+	// Outputs. Scattered is 1 if the path is not absorbed (then x and w are the exit), N, LogN, CosTheta, Wt and Wb are
+	// the variables of the path (CVAEPathVariables) and X, W and Factor the sampled scattering of the full version.
+	float* Scattered;
+	float* N;
+	float* LogN;
+	float* CosTheta;
+	float* Wt;
+	float* Wb;
+	float* x[3];
+	float* w[3];
+	float* X[3];
+	float* W[3];
+	float* Factor;
+
+	CVAESampleBatch() {}
+
+	~CVAESampleBatch() {
+		delete[] data;
+		delete[] exits;
+	}
+
+	inline int Count() const { return count; }
+
+	// Number of samples that are not absorbed in the last sampling.
+	inline int ExitCount() const { return exitCount; }
+
+	// Index of the i-th sample that is not absorbed.
+	inline int Exit(int i) const { return exits[i]; }
+
+	// Sets the number of samples. Columns are padded to BATCH_WIDTH and their content is lost if the batch grows.
+	void Resize(int count) {
+		this->count = count;
+		if (count <= capacity)
+			return;
+
+		delete[] data;
+		delete[] exits;
+		capacity = count;
+		stride = (count + BATCH_WIDTH - 1) / BATCH_WIDTH * BATCH_WIDTH;
+
+		// 49 columns of the samples, 15 of the compacted samples and the networks (4 + 2 + 8 + 6 + 12 + 12 features),
+		// one extra batch for the tails of the network outputs
+		int columns = 49 + 15 + 44;
+		data = new float[columns * stride + BATCH_WIDTH];
+		memset(data, 0, sizeof(float) * (columns * stride + BATCH_WIDTH));
+		exits = new int[stride];
+
+		float* next = data;
+		auto column = [&next, this]() {
+			float* c = next;
+			next += stride;
+			return c;
+		};
+		auto columnsOf = [&column](float** c, int n) {
+			for (int i = 0; i < n; i++)
+				c[i] = column();
+		};
+
+		G = column(); Phi = column(); Density = column(); columnsOf(Win, 3);
+		Rotation = column(); columnsOf(Len, 2); LenSample = column(); Absorption = column();
+		columnsOf(Path, 5); columnsOf(PathSample, 3); columnsOf(Scat, 5); columnsOf(ScatSample, 6);
+		Scattered = column(); N = column(); LogN = column(); CosTheta = column(); Wt = column(); Wb = column();
+		columnsOf(x, 3); columnsOf(w, 3); columnsOf(X, 3); columnsOf(W, 3); Factor = column();
+		columnsOf(cWin, 3); columnsOf(cR0, 3); columnsOf(cR1, 3); columnsOf(cPathSample, 3); cRotation = column(); cN = column(); cPhi = column();
+		lenInputs = next; next += 4 * stride;
+		lenOutputs = next; next += 2 * stride;
+		pathInputs = next; next += 8 * stride;
+		pathOutputs = next; next += 6 * stride;
+		scatInputs = next; next += 12 * stride;
+		scatOutputs = next;
+	}
+
+	// Random numbers of a sample.
+	void SetLatents(int s, const CVAELatents& latents) {
+		Rotation[s] = latents.Rotation;
+		Len[0][s] = latents.Len[0]; Len[1][s] = latents.Len[1];
+		LenSample[s] = latents.LenSample;
+		Absorption[s] = latents.Absorption;
+		for (int i = 0; i < 5; i++) Path[i][s] = latents.Path[i];
+		for (int i = 0; i < 3; i++) PathSample[i][s] = latents.PathSample[i];
+		for (int i = 0; i < 5; i++) Scat[i][s] = latents.Scat[i];
+		for (int i = 0; i < 6; i++) ScatSample[i][s] = latents.ScatSample[i];
+	}
+
+	CVAELatents GetLatents(int s) const {
+		CVAELatents latents;
+		latents.Rotation = Rotation[s];
+		latents.Len[0] = Len[0][s]; latents.Len[1] = Len[1][s];
+		latents.LenSample = LenSample[s];
+		latents.Absorption = Absorption[s];
+		for (int i = 0; i < 5; i++) latents.Path[i] = Path[i][s];
+		for (int i = 0; i < 3; i++) latents.PathSample[i] = PathSample[i][s];
+		for (int i = 0; i < 5; i++) latents.Scat[i] = Scat[i][s];
+		for (int i = 0; i < 6; i++) latents.ScatSample[i] = ScatSample[i][s];
+		return latents;
+	}
+
+	// Generates the random numbers of all samples, uniforms with xorshift32 and the standard normals in pairs
+	// with a vectorized Box-Muller transform. The same seed gives the same numbers for any BATCH_WIDTH.
+	void GenerateLatents(unsigned int seed) {
+		unsigned int state = seed * 747796405u + 2891336453u;
+		auto random = [&state]() {
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			return (state >> 8) * (1.0f / 16777216.0f);
+		};
+
+		for (int s = 0; s < count; s++)
+		{
+			Rotation[s] = random();
+			Absorption[s] = random();
+		}
+
+		float* normals[22] = { Len[0], Len[1], LenSample, Path[0], Path[1], Path[2], Path[3], Path[4],
+			PathSample[0], PathSample[1], PathSample[2], Scat[0], Scat[1], Scat[2], Scat[3], Scat[4],
+			ScatSample[0], ScatSample[1], ScatSample[2], ScatSample[3], ScatSample[4], ScatSample[5] };
+		for (int p = 0; p < 22; p += 2)
+		{
+			// u1 in (0, 1] written in the first column and u2 in the second one, replaced by the normals
+			float* a = normals[p];
+			float* b = normals[p + 1];
+			for (int s = 0; s < count; s++)
+			{
+				a[s] = 1 - random();
+				b[s] = random();
+			}
+			for (int s = 0; s < count; s += BATCH_WIDTH)
+			{
+				batch_float radius = BatchSqrt(BatchMul(BatchSet(-2), BatchLog(BatchLoad(a + s))));
+				batch_float sine, cosine;
+				BatchSinCos(BatchMul(BatchLoad(b + s), BatchSet(2 * 3.14159265f)), sine, cosine);
+				BatchStore(a + s, BatchMul(radius, cosine));
+				BatchStore(b + s, BatchMul(radius, sine));
+			}
+		}
+	}
+
+	// Samples the paths as GenerateVariablesWithModel for every sample. Returns the number of paths that are not absorbed.
+	int GenerateVariablesWithModel(const CVAEModels& models) {
+		SampleLength(models);
+		SamplePath(models);
+		return exitCount;
+	}
+
+	// Samples the paths and the scattering inside the sphere as GenerateFullVariablesWithModel for every sample.
+	// The networks must have a scattering model. Returns the number of paths that are not absorbed.
+	int GenerateFullVariablesWithModel(const CVAEModels& models) {
+		SampleLength(models);
+		SamplePath(models);
+		SampleScattering(models);
+		return exitCount;
+	}
+
+private:
+	static inline batch_float SampleNormal(batch_float mu, batch_float logVar, batch_float z) {
+		logVar = BatchMin(BatchSet(16), BatchMax(BatchSet(-16), logVar));
+		return BatchMulAdd(z, BatchExp(BatchMul(logVar, BatchSet(0.5f))), mu);
+	}
+
+	// x^y for x in [0, 1]
+	static inline batch_float PowUnit(batch_float x, batch_float y) {
+		batch_float p = BatchExp(BatchMul(y, BatchLog(BatchMax(x, BatchSet(1e-30f)))));
+		return BatchSelectLess(x, BatchSet(1e-30f), BatchSet(0), p);
+	}
+
+	static inline batch_float Dot(const batch_float a[3], const batch_float b[3]) {
+		return BatchMulAdd(a[0], b[0], BatchMulAdd(a[1], b[1], BatchMul(a[2], b[2])));
+	}
+
+	static inline void Normalize(batch_float v[3]) {
+		batch_float invLength = BatchDiv(BatchSet(1), BatchSqrt(BatchMax(Dot(v, v), BatchSet(1e-30f))));
+		for (int i = 0; i < 3; i++)
+			v[i] = BatchMul(v[i], invLength);
+	}
+
+	// mul(v, R) with the rows of the compacted frames at s
+	inline void ToRadial(int s, const batch_float v[3], batch_float r[3]) const {
+		for (int i = 0; i < 3; i++)
+			r[i] = BatchMulAdd(BatchLoad(cR0[i] + s), v[0], BatchMulAdd(BatchLoad(cR1[i] + s), v[1], BatchMul(BatchLoad(cWin[i] + s), v[2])));
+	}
+
+	// lenModel and the absorption test, compacts the samples that are not absorbed
+	void SampleLength(const CVAEModels& models) {
+		float* inputs[4] = { Density, G, Len[0], Len[1] };
+		for (int i = 0; i < 4; i++)
+			memcpy(lenInputs + i * count, inputs[i], sizeof(float) * count);
+		models.lenModelBatch(lenInputs, lenOutputs, count);
+
+		for (int s = 0; s < count; s += BATCH_WIDTH)
+		{
+			batch_float logN = BatchMax(BatchSet(0), SampleNormal(BatchLoad(lenOutputs + s), BatchLoad(lenOutputs + count + s), BatchLoad(LenSample + s)));
+			// roundf(e^logN + 0.49), ties away from zero
+			batch_float e = BatchAdd(BatchExp(logN), BatchSet(0.49f));
+			batch_float n = BatchRound(e);
+			n = BatchSelectLess(BatchSub(e, n), BatchSet(0.5f), n, BatchAdd(n, BatchSet(1)));
+			BatchStore(N + s, n);
+			BatchStore(LogN + s, BatchLog(n));
+			// absorbed if Absorption >= Phi^n
+			BatchStore(Scattered + s, BatchSelectLess(BatchLoad(Absorption + s), PowUnit(BatchLoad(Phi + s), n), BatchSet(1), BatchSet(0)));
+		}
+
+		exitCount = 0;
+		for (int s = 0; s < count; s++)
+		{
+			if (Scattered[s] != 0)
+				exits[exitCount++] = s;
+			else
+			{
+				CosTheta[s] = Wt[s] = Wb[s] = 0;
+				for (int i = 0; i < 3; i++)
+				{
+					x[i][s] = 0;
+					w[i][s] = Win[i][s];
+				}
+			}
+			// scattering is not sampled for absorbed paths or paths with a single event
+			for (int i = 0; i < 3; i++)
+			{
+				X[i][s] = 0;
+				W[i][s] = Win[i][s];
+			}
+			Factor[s] = 1;
+		}
+	}
+
+	// pathModel, exits and radial frames of the compacted samples
+	void SamplePath(const CVAEModels& models) {
+		int m = exitCount;
+		if (m == 0)
+			return;
+
+		for (int k = 0; k < m; k++)
+		{
+			int s = exits[k];
+			float input[8] = { Density[s], G[s], LogN[s], Path[0][s], Path[1][s], Path[2][s], Path[3][s], Path[4][s] };
+			for (int i = 0; i < 8; i++)
+				pathInputs[i * m + k] = input[i];
+			for (int i = 0; i < 3; i++)
+			{
+				cWin[i][k] = Win[i][s];
+				cPathSample[i][k] = PathSample[i][s];
+			}
+			cRotation[k] = Rotation[s];
+			cN[k] = N[s];
+		}
+		models.pathModelBatch(pathInputs, pathOutputs, m);
+
+		batch_float one = BatchSet(1), zero = BatchSet(0);
+		for (int k = 0; k < m; k += BATCH_WIDTH)
+		{
+			batch_float win[3] = { BatchLoad(cWin[0] + k), BatchLoad(cWin[1] + k), BatchLoad(cWin[2] + k) };
+			batch_float n = BatchLoad(cN + k);
+
+			batch_float pathOut[3];
+			for (int i = 0; i < 3; i++)
+				pathOut[i] = BatchMin(BatchSet(0.9999f), BatchMax(BatchSet(-0.9999f),
+					SampleNormal(BatchLoad(pathOutputs + i * m + k), BatchLoad(pathOutputs + (3 + i) * m + k), BatchLoad(cPathSample[i] + k))));
+			batch_float costheta = pathOut[0];
+			batch_float wt = BatchSelectLess(one, n, pathOut[1], zero); // only if n > 1
+			batch_float wb = BatchSelectLess(BatchSet(2), n, pathOut[2], zero); // only if n > 2
+
+			// frame of win rotated by rAlpha, temp is (0, 0, 1) if |win.x| >= 0.9999 otherwise (1, 0, 0)
+			batch_float sinAlpha, cosAlpha;
+			BatchSinCos(BatchMul(BatchLoad(cRotation + k), BatchSet(2 * 3.14159265f)), sinAlpha, cosAlpha);
+			batch_float absX = BatchMax(win[0], BatchSub(zero, win[0]));
+			batch_float winY[3] = {
+				BatchSelectLess(absX, BatchSet(0.9999f), zero, BatchSub(zero, win[1])),
+				BatchSelectLess(absX, BatchSet(0.9999f), BatchSub(zero, win[2]), win[0]),
+				BatchSelectLess(absX, BatchSet(0.9999f), win[1], zero) };
+			Normalize(winY);
+			batch_float winX[3] = {
+				BatchSub(BatchMul(win[1], winY[2]), BatchMul(win[2], winY[1])),
+				BatchSub(BatchMul(win[2], winY[0]), BatchMul(win[0], winY[2])),
+				BatchSub(BatchMul(win[0], winY[1]), BatchMul(win[1], winY[0])) };
+			for (int i = 0; i < 3; i++)
+			{
+				BatchStore(cR0[i] + k, BatchSub(BatchMul(winX[i], cosAlpha), BatchMul(winY[i], sinAlpha)));
+				BatchStore(cR1[i] + k, BatchMulAdd(winX[i], sinAlpha, BatchMul(winY[i], cosAlpha)));
+			}
+
+			// x = (0, sin, cos), N = x, B = (1, 0, 0), T = cross(x, B) = (0, cos, -sin)
+			batch_float sinTheta = BatchSqrt(BatchSub(one, BatchMul(costheta, costheta)));
+			batch_float normal = BatchSqrt(BatchMax(zero, BatchSub(BatchSub(one, BatchMul(wt, wt)), BatchMul(wb, wb))));
+			batch_float localX[3] = { zero, sinTheta, costheta };
+			batch_float localW[3] = { wb,
+				BatchMulAdd(sinTheta, normal, BatchMul(costheta, wt)),
+				BatchSub(BatchMul(costheta, normal), BatchMul(sinTheta, wt)) };
+			Normalize(localW);
+
+			batch_float radialX[3], radialW[3];
+			ToRadial(k, localX, radialX);
+			ToRadial(k, localW, radialW);
+
+			// path variables and exits are written back to the samples
+			float values[9][BATCH_WIDTH];
+			BatchStore(values[0], costheta);
+			BatchStore(values[1], wt);
+			BatchStore(values[2], wb);
+			for (int i = 0; i < 3; i++)
+			{
+				BatchStore(values[3 + i], radialX[i]);
+				BatchStore(values[6 + i], radialW[i]);
+			}
+			for (int l = 0; l < BATCH_WIDTH && k + l < m; l++)
+			{
+				int s = exits[k + l];
+				CosTheta[s] = values[0][l];
+				Wt[s] = values[1][l];
+				Wb[s] = values[2][l];
+				for (int i = 0; i < 3; i++)
+				{
+					x[i][s] = values[3 + i][l];
+					w[i][s] = values[6 + i][l];
+				}
+			}
+		}
+	}
+
+	// scatModel of the compacted samples, uses the frames of SamplePath
+	void SampleScattering(const CVAEModels& models) {
+		int m = exitCount;
+		if (m == 0)
+			return;
+
+		for (int k = 0; k < m; k++)
+		{
+			int s = exits[k];
+			cPhi[k] = Phi[s];
+			float input[12] = { Density[s], G[s], 0, LogN[s], CosTheta[s], Wt[s], Wb[s], Scat[0][s], Scat[1][s], Scat[2][s], Scat[3][s], Scat[4][s] };
+			for (int i = 0; i < 12; i++)
+				scatInputs[i * m + k] = input[i];
+		}
+		// (1 - Phi)^(1/6)
+		for (int k = 0; k < m; k += BATCH_WIDTH)
+		{
+			float values[BATCH_WIDTH];
+			BatchStore(values, PowUnit(BatchSub(BatchSet(1), BatchLoad(cPhi + k)), BatchSet(1.0f / 6.0f)));
+			for (int l = 0; l < BATCH_WIDTH && k + l < m; l++)
+				scatInputs[2 * m + k + l] = values[l];
+		}
+		models.scatModelBatch(scatInputs, scatOutputs, m);
+
+		batch_float one = BatchSet(1);
+		for (int k = 0; k < m; k += BATCH_WIDTH)
+		{
+			// random numbers of the compacted samples
+			float z[6][BATCH_WIDTH];
+			for (int l = 0; l < BATCH_WIDTH; l++)
+			{
+				int s = exits[min(k + l, m - 1)];
+				for (int i = 0; i < 6; i++)
+					z[i][l] = ScatSample[i][s];
+			}
+			batch_float sampled[6];
+			for (int i = 0; i < 6; i++)
+				sampled[i] = SampleNormal(BatchLoad(scatOutputs + i * m + k), BatchLoad(scatOutputs + (6 + i) * m + k), BatchLoad(z[i]));
+
+			batch_float scatX[3] = { sampled[0], sampled[1], sampled[2] };
+			batch_float scatW[3] = { sampled[3], sampled[4], sampled[5] };
+			batch_float invLength = BatchDiv(one, BatchMax(one, BatchSqrt(Dot(scatX, scatX))));
+			for (int i = 0; i < 3; i++)
+				scatX[i] = BatchMul(scatX[i], invLength);
+			Normalize(scatW);
+
+			batch_float radialX[3], radialW[3];
+			ToRadial(k, scatX, radialX);
+			ToRadial(k, scatW, radialW);
+
+			// accum = Phi * (1 - Phi^N) / (1 - Phi) or N if Phi >= 0.99999, factor = accum / Phi^N
+			batch_float phi = BatchLoad(cPhi + k);
+			batch_float n = BatchLoad(cN + k);
+			batch_float phiN = PowUnit(phi, n);
+			batch_float accum = BatchSelectLess(phi, BatchSet(0.99999f),
+				BatchDiv(BatchMul(phi, BatchSub(one, phiN)), BatchMax(BatchSub(one, phi), BatchSet(1e-30f))), n);
+			batch_float factor = BatchDiv(accum, phiN);
+
+			float values[7][BATCH_WIDTH];
+			for (int i = 0; i < 3; i++)
+			{
+				BatchStore(values[i], radialX[i]);
+				BatchStore(values[3 + i], radialW[i]);
+			}
+			BatchStore(values[6], factor);
+			for (int l = 0; l < BATCH_WIDTH && k + l < m; l++)
+			{
+				int s = exits[k + l];
+				if (N[s] < 2)
+					continue;
+				for (int i = 0; i < 3; i++)
+				{
+					X[i][s] = values[i][l];
+					W[i][s] = values[3 + i][l];
+				}
+				Factor[s] = values[6][l];
+			}
+		}
+	}
+};
+
+struct CVAEBatchSamplingBenchmark {
+	int BatchSize;
+	// Fraction of the samples that are not absorbed
+	float ExitRatio;
+	// Single thread throughput in samples that are not absorbed per second, sampling sample by sample with
+	// GenerateVariablesWithModel (or GenerateFullVariablesWithModel) and with CVAESampleBatch
+	float ScalarExitsPerSecond;
+	float BatchExitsPerSecond;
+	// Random numbers of the samples generated per second, scalar Box-Muller and CVAESampleBatch::GenerateLatents
+	float ScalarLatentsPerSecond;
+	float BatchLatentsPerSecond;
+	// Samples where only one of the versions is absorbed
+	int Mismatches;
+	// Maximum distance between the exits (and scattering positions and directions) of both versions
+	float MaxExitError;
+	float MaxScatteringError;
+};
+
+/// Compares CVAESampleBatch with the sample by sample version for random inputs and latents.
+/// Albedos are in [0.975, 1] as in the scenes of the paper, densities in [0, 400].
+inline CVAEBatchSamplingBenchmark BenchmarkCVAEBatchSampling(const CVAEModels& models, bool full,
+	int batchSize = 512, int samples = 1 << 18, unsigned int seed = 1) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto random = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+	auto randomStdNormal = [&random]() {
+		float u1 = 1 - random();
+		float u2 = random();
+		return sqrtf(-2 * logf(u1)) * cosf(2 * 3.14159265f * u2);
+	};
+
+	full &= models.HasScattering();
+	int batches = max(1, samples / batchSize);
+	samples = batches * batchSize;
+
+	CVAEBatchSamplingBenchmark result = {};
+	result.BatchSize = batchSize;
+
+	CVAESampleBatch batch;
+	batch.Resize(batchSize);
+	CVAELatents* latents = new CVAELatents[batchSize];
+	float3* scalarOutputs = new float3[batchSize * 4];
+	bool* scalarScattered = new bool[batchSize];
+	float scalarLatentsTime = 0, batchLatentsTime = 0, scalarTime = 0, batchTime = 0;
+	int scalarExits = 0, batchExits = 0;
+
+	for (int b = 0; b < batches; b++)
+	{
+		for (int s = 0; s < batchSize; s++)
+		{
+			batch.G[s] = random() * 2 - 1;
+			batch.Phi[s] = 1 - 0.025f * random();
+			batch.Density[s] = random() * 400;
+			float3 win = normalize(float3(randomStdNormal(), randomStdNormal(), randomStdNormal()));
+			batch.Win[0][s] = win.x;
+			batch.Win[1][s] = win.y;
+			batch.Win[2][s] = win.z;
+		}
+
+		// The scalar latents are only timed, both versions sample with the latents of the batch
+		Stopwatch stopwatch;
+		for (int s = 0; s < batchSize; s++)
+		{
+			CVAELatents& l = latents[s];
+			l.Rotation = random();
+			l.Absorption = random();
+			l.Len[0] = randomStdNormal(); l.Len[1] = randomStdNormal(); l.LenSample = randomStdNormal();
+			for (int i = 0; i < 5; i++) l.Path[i] = randomStdNormal();
+			for (int i = 0; i < 3; i++) l.PathSample[i] = randomStdNormal();
+			for (int i = 0; i < 5; i++) l.Scat[i] = randomStdNormal();
+			for (int i = 0; i < 6; i++) l.ScatSample[i] = randomStdNormal();
+		}
+		scalarLatentsTime += stopwatch.Milliseconds();
+
+		stopwatch.Start();
+		batch.GenerateLatents(seed * 7919 + b);
+		batchLatentsTime += stopwatch.Milliseconds();
+
+		for (int s = 0; s < batchSize; s++)
+			latents[s] = batch.GetLatents(s);
+
+		stopwatch.Start();
+		for (int s = 0; s < batchSize; s++)
+		{
+			float3 win = float3(batch.Win[0][s], batch.Win[1][s], batch.Win[2][s]);
+			float3* o = scalarOutputs + s * 4;
+			if (full)
+			{
+				float factor;
+				scalarScattered[s] = GenerateFullVariablesWithModel(models, batch.G[s], batch.Phi[s], win, batch.Density[s], latents[s], o[0], o[1], o[2], o[3], factor);
+			}
+			else
+			{
+				CVAEPathVariables path;
+				scalarScattered[s] = GenerateVariablesWithModel(models, batch.G[s], batch.Phi[s], win, batch.Density[s], latents[s], o[0], o[1], path);
+			}
+			scalarExits += scalarScattered[s];
+		}
+		scalarTime += stopwatch.Milliseconds();
+
+		stopwatch.Start();
+		batchExits += full ? batch.GenerateFullVariablesWithModel(models) : batch.GenerateVariablesWithModel(models);
+		batchTime += stopwatch.Milliseconds();
+
+		for (int s = 0; s < batchSize; s++)
+		{
+			if (scalarScattered[s] != (batch.Scattered[s] != 0))
+			{
+				result.Mismatches++;
+				continue;
+			}
+			const float3* o = scalarOutputs + s * 4;
+			float3 x = float3(batch.x[0][s], batch.x[1][s], batch.x[2][s]);
+			float3 w = float3(batch.w[0][s], batch.w[1][s], batch.w[2][s]);
+			result.MaxExitError = maxf(result.MaxExitError, maxf(length(x - o[0]), length(w - o[1])));
+			if (full)
+			{
+				float3 X = float3(batch.X[0][s], batch.X[1][s], batch.X[2][s]);
+				float3 W = float3(batch.W[0][s], batch.W[1][s], batch.W[2][s]);
+				result.MaxScatteringError = maxf(result.MaxScatteringError, maxf(length(X - o[2]), length(W - o[3])));
+			}
+		}
+	}
+
+	result.ExitRatio = batchExits / (float)samples;
+	result.ScalarLatentsPerSecond = samples * 1000.0f / scalarLatentsTime;
+	result.BatchLatentsPerSecond = samples * 1000.0f / batchLatentsTime;
+	result.ScalarExitsPerSecond = scalarExits * 1000.0f / scalarTime;
+	result.BatchExitsPerSecond = batchExits * 1000.0f / batchTime;
+
+	delete[] latents;
+	delete[] scalarOutputs;
+	delete[] scalarScattered;
+	return result;
+}
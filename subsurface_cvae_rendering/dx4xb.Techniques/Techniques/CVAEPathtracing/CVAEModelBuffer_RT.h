@@ -0,0 +1,98 @@
+// lenModel, pathModel and scatModel evaluated from the image of a CVAE model file (see CVAEModels.h)
+// instead of the baked networks. Models can be replaced while running without recompiling the shaders.
+// Activations are kept in local arrays, slower than the baked functions.
+
+// Image of the networks (integers stored as float bits)
+StructuredBuffer<float> CVAEModelImage : register(t0, space2);
+
+// Widest layer supported
+#define CVAE_BUFFER_MAX_WIDTH 32
+
+int ImageInt(uint address) {
+	return asint(CVAEModelImage[address]);
+}
+
+float MLPActivationFunction(int activation, float x) {
+	switch (activation)
+	{
+	case 1: return log(1 + exp(x)); // softplus
+	case 2: return 1 / (1 + exp(-x)); // sigmoid
+	case 3: return tanh(x);
+	case 4: return max(0, x); // relu
+	}
+	return x;
+}
+
+// Evaluates the network with the image starting at model.
+void EvaluateMLP(uint model, float input[CVAE_BUFFER_MAX_WIDTH], out float output[CVAE_BUFFER_MAX_WIDTH])
+{
+	int layers = ImageInt(model);
+	int inputs = ImageInt(model + 1);
+	int outputs = ImageInt(model + 2);
+	uint normalization = model + 3 + 5 * layers;
+
+	float current[CVAE_BUFFER_MAX_WIDTH];
+	float next[CVAE_BUFFER_MAX_WIDTH];
+	[loop]
+	for (int i = 0; i < inputs; i++)
+		current[i] = input[i] * CVAEModelImage[normalization + i] + CVAEModelImage[normalization + inputs + i];
+
+	[loop]
+	for (int l = 0; l < layers; l++)
+	{
+		uint layer = model + 3 + 5 * l;
+		int layerInputs = ImageInt(layer);
+		int layerOutputs = ImageInt(layer + 1);
+		int activation = ImageInt(layer + 2);
+		uint weights = model + ImageInt(layer + 3);
+		uint bias = model + ImageInt(layer + 4);
+
+		[loop]
+		for (int o = 0; o < layerOutputs; o++)
+		{
+			float sum = CVAEModelImage[bias + o];
+			[loop]
+			for (int i = 0; i < layerInputs; i++)
+				sum += current[i] * CVAEModelImage[weights + i * layerOutputs + o];
+			next[o] = MLPActivationFunction(activation, sum);
+		}
+		[loop]
+		for (int o = 0; o < layerOutputs; o++)
+			current[o] = next[o];
+	}
+
+	normalization += 2 * inputs;
+	[loop]
+	for (int o = 0; o < CVAE_BUFFER_MAX_WIDTH; o++)
+		output[o] = o < outputs ? current[o] * CVAEModelImage[normalization + o] + CVAEModelImage[normalization + outputs + o] : 0;
+}
+
+void lenModel(float _input[4], out float _output[2]) {
+	float input[CVAE_BUFFER_MAX_WIDTH];
+	float output[CVAE_BUFFER_MAX_WIDTH];
+	for (int i = 0; i < 4; i++)
+		input[i] = _input[i];
+	EvaluateMLP(ImageInt(1), input, output);
+	for (int o = 0; o < 2; o++)
+		_output[o] = output[o];
+}
+
+void pathModel(float _input[8], out float _output[6]) {
+	float input[CVAE_BUFFER_MAX_WIDTH];
+	float output[CVAE_BUFFER_MAX_WIDTH];
+	for (int i = 0; i < 8; i++)
+		input[i] = _input[i];
+	EvaluateMLP(ImageInt(2), input, output);
+	for (int o = 0; o < 6; o++)
+		_output[o] = output[o];
+}
+
+void scatModel(float _input[12], out float _output[12]) {
+	float input[CVAE_BUFFER_MAX_WIDTH];
+	float output[CVAE_BUFFER_MAX_WIDTH];
+	for (int i = 0; i < 12; i++)
+		input[i] = _input[i];
+	EvaluateMLP(ImageInt(3), input, output);
+	for (int o = 0; o < 12; o++)
+		_output[o] = output[o];
+}
@@ -0,0 +1,368 @@
+#pragma once
+
+#include "dx4xb_math.h"
+#include "../CPU/MLP.h"
+#include "../CPU/FileWatcher.h"
+#include <string.h>
+
+using namespace dx4xb;
+
+/// Reads the weights of a network baked by compiling2HLSL.py (e.g. lenModel in CVAEScatteringModel.h) into model.
+/// Only used to check the model files written by compiling2Binary.py against the baked shaders, the runtime loads
+/// those files (CVAEModels::Load), since scanning the generated code depends on the formatting of the generator.
+/// The baked functions evaluate every layer n_l by 4-wide blocks n_l_j = activation(sum_k mul(n_(l-1)_k, floatRxC(...)) + floatC(...)).
+/// Returns false if the function is not found or the layers are not consistent.
+inline bool ImportMLPFromHLSL(MLPModel& model, const char* source, const char* functionName) {
+	model.Clear();
+
+	char signature[256];
+	sprintf_s(signature, "void %s(", functionName);
+	const char* begin = strstr(source, signature);
+	if (!begin)
+		return false;
+	const char* end = strstr(begin, "\n}");
+	if (!end)
+		return false;
+
+	// Width and offset of every block of every layer (layer 0 is the input)
+	int widths[MLP_MAX_LAYERS + 1][MLP_MAX_WIDTH];
+	int offsets[MLP_MAX_LAYERS + 1][MLP_MAX_WIDTH];
+	int blocks[MLP_MAX_LAYERS + 1] = { 0 };
+	bool softplus[MLP_MAX_LAYERS + 1] = { false };
+	int layers = 0;
+
+	// First pass gets the topology, second pass fills the weights
+	for (int pass = 0; pass < 2; pass++)
+	{
+		const char* statement = strchr(begin, '{') + 1;
+		while (statement < end)
+		{
+			const char* next = strchr(statement, ';');
+			if (!next || next > end)
+				break;
+
+			while (*statement == ' ' || *statement == '\t' || *statement == '\r' || *statement == '\n')
+				statement++;
+
+			int width, l, j;
+			if (sscanf_s(statement, "float%d n_%d_%d =", &width, &l, &j) == 3)
+			{
+				if (l < 0 || l > MLP_MAX_LAYERS || j < 0 || j >= MLP_MAX_WIDTH || width < 1 || width > 4)
+					return false;
+
+				if (pass == 0)
+				{
+					widths[l][j] = width;
+					blocks[l] = max(blocks[l], j + 1);
+					layers = max(layers, l);
+					const char* activation = strstr(statement, "softplusActivation(");
+					softplus[l] = activation && activation < next;
+				}
+				else if (l > 0)
+				{
+					float* W = model.Weights(l - 1);
+					float* B = model.Bias(l - 1);
+					int outputs = model.Layer(l - 1).Outputs;
+
+					const char* c = statement;
+					int k, rows, columns, previousLayer;
+					while ((c = strstr(c, "mul(n_")) != nullptr && c < next)
+					{
+						if (sscanf_s(c, "mul(n_%d_%d, float%dx%d(", &previousLayer, &k, &rows, &columns) != 4 ||
+							previousLayer != l - 1 || k >= blocks[l - 1] || rows != widths[l - 1][k] || columns != width)
+							return false;
+						c = strchr(c, '(') + 1;
+						c = strchr(c, '(') + 1; // values of the matrix
+						for (int r = 0; r < rows; r++)
+							for (int col = 0; col < columns; col++)
+							{
+								char* last;
+								W[(offsets[l - 1][k] + r) * outputs + offsets[l][j] + col] = strtof(c, &last);
+								c = last;
+								while (*c == ',' || *c == ' ' || *c == 'f')
+									c++;
+							}
+					}
+
+					// bias is the last floatC(...) of the statement
+					const char* bias = nullptr;
+					char biasStart[16];
+					sprintf_s(biasStart, "+ float%d(", width);
+					for (const char* b = strstr(statement, biasStart); b && b < next; b = strstr(b + 1, biasStart))
+						bias = b;
+					if (!bias)
+						return false;
+					c = strchr(bias, '(') + 1;
+					for (int col = 0; col < width; col++)
+					{
+						char* last;
+						B[offsets[l][j] + col] = strtof(c, &last);
+						c = last;
+						while (*c == ',' || *c == ' ' || *c == 'f')
+							c++;
+					}
+				}
+			}
+			statement = next + 1;
+		}
+
+		if (pass == 0)
+		{
+			if (layers == 0)
+				return false;
+			int sizes[MLP_MAX_LAYERS + 1];
+			for (int l = 0; l <= layers; l++)
+			{
+				sizes[l] = 0;
+				for (int j = 0; j < blocks[l]; j++)
+				{
+					offsets[l][j] = sizes[l];
+					sizes[l] += widths[l][j];
+				}
+				if (sizes[l] == 0)
+					return false;
+			}
+			for (int l = 1; l <= layers; l++)
+				if (model.AddLayer(sizes[l - 1], sizes[l], softplus[l] ? MLPActivation::Softplus : MLPActivation::None) < 0)
+				{
+					model.Clear();
+					return false;
+				}
+		}
+	}
+	return true;
+}
+
+// "CVAE", the networks of a CVAE scattering model
+#define CVAE_FILE_MAGIC 0x45415643
+
+// Widest layer evaluated from the buffer of the networks (same as CVAE_BUFFER_MAX_WIDTH in CVAEModelBuffer_RT.h)
+#define CVAE_BUFFER_MAX_WIDTH 32
+
+/// Scattering networks used by the CVAE pathtracers evaluated on the CPU.
+/// Entry points have the same signature and semantics than the baked shader functions.
+class CVAEModels {
+	bool ValidSizes() const {
+		return Len.Inputs() == 4 && Len.Outputs() == 2 &&
+			Path.Inputs() == 8 && Path.Outputs() == 6 &&
+			(Scat.LayerCount() == 0 || (Scat.Inputs() == 12 && Scat.Outputs() == 12));
+	}
+
+public:
+	MLPModel Len;
+	MLPModel Path;
+	// Empty if the networks have no scattering model
+	MLPModel Scat;
+
+	inline bool HasScattering() const { return Scat.LayerCount() > 0; }
+
+	// Sets the precision of the three networks (see MLPModel::SetPrecision). Loading new networks resets it to fp32.
+	void SetPrecision(MLPPrecision precision) {
+		Len.SetPrecision(precision);
+		Path.SetPrecision(precision);
+		Scat.SetPrecision(precision);
+	}
+
+	// Sets the implementation of the activations of the three networks (see MLPModel::SetMathMode).
+	void SetMathMode(MLPMathMode mode) {
+		Len.SetMathMode(mode);
+		Path.SetMathMode(mode);
+		Scat.SetMathMode(mode);
+	}
+
+	// Gets if the networks can be evaluated from their image by CVAEModelBuffer_RT.h: the three networks are present
+	// (the shaders evaluate scatModel from offset [3]) and no layer is wider than CVAE_BUFFER_MAX_WIDTH.
+	bool FitsModelBuffer() const {
+		if (!HasScattering())
+			return false;
+		const MLPModel* models[3] = { &Len, &Path, &Scat };
+		for (const MLPModel* model : models)
+			for (int l = 0; l < model->LayerCount(); l++)
+				if (model->Layer(l).Inputs > CVAE_BUFFER_MAX_WIDTH || model->Layer(l).Outputs > CVAE_BUFFER_MAX_WIDTH)
+					return false;
+		return true;
+	}
+
+	// Number of 32-bit words of the image of the networks.
+	int ImageSize() const {
+		return 4 + Len.ImageSize() + Path.ImageSize() + (HasScattering() ? Scat.ImageSize() : 0);
+	}
+
+	// Image of the networks (see ModelFileHeader) is:
+	// [0] number of networks (2 or 3), [1..3] offsets of the len, path and scat models (0 if missing), and the image of each model.
+	// This is the content of the buffer used by CVAEModelBuffer_RT.h.
+	void WriteImage(float* image) const {
+		int lenOffset = 4;
+		int pathOffset = lenOffset + Len.ImageSize();
+		int scatOffset = HasScattering() ? pathOffset + Path.ImageSize() : 0;
+		image[0] = ImageInt(HasScattering() ? 3 : 2);
+		image[1] = ImageInt(lenOffset);
+		image[2] = ImageInt(pathOffset);
+		image[3] = ImageInt(scatOffset);
+		Len.WriteImage(image + lenOffset);
+		Path.WriteImage(image + pathOffset);
+		if (HasScattering())
+			Scat.WriteImage(image + scatOffset);
+	}
+
+	bool ReadImage(const float* image, int words) {
+		Len.Clear();
+		Path.Clear();
+		Scat.Clear();
+		if (words < 4)
+			return false;
+		int count = ImageInt(image[0]);
+		int offsets[3] = { ImageInt(image[1]), ImageInt(image[2]), ImageInt(image[3]) };
+		MLPModel* models[3] = { &Len, &Path, &Scat };
+		bool valid = count == 2 || count == 3;
+		for (int m = 0; valid && m < count; m++)
+			valid = offsets[m] >= 4 && offsets[m] < words && models[m]->ReadImage(image + offsets[m], words - offsets[m]);
+		if (!valid || !ValidSizes())
+		{
+			Len.Clear();
+			Path.Clear();
+			Scat.Clear();
+			return false;
+		}
+		return true;
+	}
+
+	// Loads the networks from a model file. Returns false (and leaves the networks empty) if the file is missing or malformed.
+	bool Load(const char* fileName) {
+		int words;
+		float* image = ReadModelFile(fileName, CVAE_FILE_MAGIC, words);
+		if (!image)
+		{
+			ReadImage(nullptr, 0);
+			return false;
+		}
+		bool valid = ReadImage(image, words);
+		delete[] image;
+		return valid;
+	}
+
+	// Saves the networks to a model file readable by Load.
+	bool Save(const char* fileName) const {
+		int words = ImageSize();
+		float* image = new float[words];
+		WriteImage(image);
+		bool saved = WriteModelFile(fileName, CVAE_FILE_MAGIC, image, words);
+		delete[] image;
+		return saved;
+	}
+
+	// Gets the networks from a shader with the baked models (e.g. CVAEScatteringModelX.h), see ImportMLPFromHLSL.
+	bool ImportFromHLSL(const char* shaderFile) {
+		FILE* file;
+		if (fopen_s(&file, shaderFile, "rb"))
+			return false;
+		fseek(file, 0, SEEK_END);
+		long size = ftell(file);
+		fseek(file, 0, SEEK_SET);
+		char* source = new char[size + 1];
+		source[fread(source, 1, size, file)] = 0;
+		fclose(file);
+
+		bool valid = ImportMLPFromHLSL(Len, source, "lenModel") && ImportMLPFromHLSL(Path, source, "pathModel");
+		if (valid && !ImportMLPFromHLSL(Scat, source, "scatModel"))
+			Scat.Clear();
+		delete[] source;
+
+		if (!valid || !ValidSizes())
+		{
+			Len.Clear();
+			Path.Clear();
+			Scat.Clear();
+			return false;
+		}
+		return true;
+	}
+
+	inline void lenModel(const float _input[4], float _output[2]) const {
+		Len.Evaluate(_input, _output);
+	}
+
+	inline void pathModel(const float _input[8], float _output[6]) const {
+		Path.Evaluate(_input, _output);
+	}
+
+	inline void scatModel(const float _input[12], float _output[12]) const {
+		Scat.Evaluate(_input, _output);
+	}
+
+	// Batched versions, inputs and outputs are stored by feature (see MLPModel::EvaluateBatch).
+
+	inline void lenModelBatch(const float* inputs, float* outputs, int count) const {
+		Len.EvaluateBatch(inputs, outputs, count);
+	}
+
+	inline void pathModelBatch(const float* inputs, float* outputs, int count) const {
+		Path.EvaluateBatch(inputs, outputs, count);
+	}
+
+	inline void scatModelBatch(const float* inputs, float* outputs, int count) const {
+		Scat.EvaluateBatch(inputs, outputs, count);
+	}
+};
+
+/// Networks shared by several threads that are replaced when their model file changes.
+/// Readers evaluate between Acquire and Release, a new model is loaded aside and swapped when no reader is using the current one.
+class HotCVAEModels {
+	SRWLOCK lock = SRWLOCK_INIT;
+	CVAEModels* current = nullptr;
+	FileWatcher watcher;
+	char fileName[MAX_PATH] = {};
+	int version = 0;
+
+public:
+	HotCVAEModels() {}
+	HotCVAEModels(const HotCVAEModels&) = delete;
+	HotCVAEModels& operator = (const HotCVAEModels&) = delete;
+
+	~HotCVAEModels() {
+		delete current;
+	}
+
+	// Loads the networks from a model file and watches it. Returns false if the file can not be loaded.
+	bool Open(const char* fileName) {
+		strcpy_s(this->fileName, fileName);
+		watcher.Watch(fileName);
+		return Update();
+	}
+
+	// Reloads the networks if the file was written since the last read. Returns true if the networks were replaced.
+	// A file that can not be loaded (e.g. a newer version) is ignored until it is written again and the current networks are kept.
+	bool Update() {
+		if (!watcher.Changed())
+			return false;
+		watcher.Accept();
+		CVAEModels* loaded = new CVAEModels();
+		if (!loaded->Load(fileName))
+		{
+			delete loaded;
+			return false;
+		}
+
+		AcquireSRWLockExclusive(&lock);
+		CVAEModels* previous = current;
+		current = loaded;
+		version++;
+		ReleaseSRWLockExclusive(&lock);
+
+		delete previous;
+		return true;
+	}
+
+	// Networks to use until Release. Null if no model was loaded.
+	const CVAEModels* Acquire() {
+		AcquireSRWLockShared(&lock);
+		return current;
+	}
+
+	void Release() {
+		ReleaseSRWLockShared(&lock);
+	}
+
+	// Number of models loaded so far.
+	inline int Version() const { return version; }
+};
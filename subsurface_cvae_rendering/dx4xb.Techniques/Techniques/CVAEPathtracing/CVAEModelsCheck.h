@@ -0,0 +1,376 @@
+#pragma once
+
+#include "CVAEModels.h"
+#include "CVAESampling.h"
+
+// Baked shader functions compiled as C++ for the conformance check.
+// mul of a vector and a matrix is a row matrix in dx4xb, the baked code needs a vector.
+namespace BakedCVAEModels {
+	inline float4 BakedMul(const float4& v, const float4x4& m) {
+		return float4(
+			dot(v, float4(m._m00, m._m10, m._m20, m._m30)),
+			dot(v, float4(m._m01, m._m11, m._m21, m._m31)),
+			dot(v, float4(m._m02, m._m12, m._m22, m._m32)),
+			dot(v, float4(m._m03, m._m13, m._m23, m._m33)));
+	}
+
+	inline float2 BakedMul(const float4& v, const float4x2& m) {
+		return float2(
+			dot(v, float4(m._m00, m._m10, m._m20, m._m30)),
+			dot(v, float4(m._m01, m._m11, m._m21, m._m31)));
+	}
+
+#define out
+#define mul BakedMul
+	namespace Base {
+#include "CVAEScatteringModel.h"
+	}
+	namespace Extended {
+#include "CVAEScatteringModelX.h"
+	}
+#undef mul
+#undef out
+}
+
+/// Maximum relative errors (|a - b| / max(1, |b|)) of the CPU networks against the baked shader functions.
+/// The baked softplus overflows for large inputs (e.g. high densities) and gives NaN, those outputs are not compared.
+struct CVAEModelsConformance {
+	int Samples;
+	// Evaluations where the baked function is not finite
+	int NonFinite;
+	float LenError;
+	float PathError;
+	float ScatError;
+};
+
+/// Compares the networks with the baked functions of CVAEScatteringModel.h (or CVAEScatteringModelX.h if extended)
+/// for random inputs in the range used by the pathtracers.
+inline CVAEModelsConformance CheckCVAEModels(const CVAEModels& models, bool extended, int samples = 100000, unsigned int seed = 1) {
+	CVAEModelsConformance result = { samples, 0, 0, 0, 0 };
+
+	// xorshift32
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto random = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+	auto randomStdNormal = [&random]() {
+		float u1 = maxf(random(), 1e-7f);
+		float u2 = random();
+		return sqrtf(-2 * logf(u1)) * cosf(2 * 3.14159265f * u2);
+	};
+	auto error = [&result](const float* a, const float* b, int count) {
+		float e = 0;
+		for (int i = 0; i < count; i++)
+			if (!isfinite(b[i]))
+			{
+				result.NonFinite++;
+				return 0.0f;
+			}
+		for (int i = 0; i < count; i++)
+			e = maxf(e, fabsf(a[i] - b[i]) / maxf(1.0f, fabsf(b[i])));
+		return e;
+	};
+
+	for (int s = 0; s < samples; s++)
+	{
+		float density = random() * 400;
+		float G = random() * 2 - 1;
+		float logN = random() * 8;
+
+		float lenInput[4] = { density, G, randomStdNormal(), randomStdNormal() };
+		float lenOutput[2], lenExpected[2];
+		models.lenModel(lenInput, lenOutput);
+		if (extended)
+			BakedCVAEModels::Extended::lenModel(lenInput, lenExpected);
+		else
+			BakedCVAEModels::Base::lenModel(lenInput, lenExpected);
+		result.LenError = maxf(result.LenError, error(lenOutput, lenExpected, 2));
+
+		float pathInput[8] = { density, G, logN };
+		for (int i = 3; i < 8; i++)
+			pathInput[i] = randomStdNormal();
+		float pathOutput[6], pathExpected[6];
+		models.pathModel(pathInput, pathOutput);
+		if (extended)
+			BakedCVAEModels::Extended::pathModel(pathInput, pathExpected);
+		else
+			BakedCVAEModels::Base::pathModel(pathInput, pathExpected);
+		result.PathError = maxf(result.PathError, error(pathOutput, pathExpected, 6));
+
+		if (!models.HasScattering())
+			continue;
+
+		float scatInput[12] = { density, G, random(), logN, random() * 2 - 1, random() * 2 - 1, random() * 2 - 1 };
+		for (int i = 7; i < 12; i++)
+			scatInput[i] = randomStdNormal();
+		float scatOutput[12], scatExpected[12];
+		models.scatModel(scatInput, scatOutput);
+		if (extended)
+			BakedCVAEModels::Extended::scatModel(scatInput, scatExpected);
+		else
+			BakedCVAEModels::Base::scatModel(scatInput, scatExpected);
+		result.ScatError = maxf(result.ScatError, error(scatOutput, scatExpected, 12));
+	}
+	return result;
+}
+
+struct CVAEPrecisionError {
+	float Mean;
+	float Max;
+};
+
+/// Configuration of the evaluation of the networks.
+struct CVAEEvaluation {
+	MLPPrecision Precision;
+	MLPMathMode Math;
+};
+
+/// Accuracy and throughput of the networks evaluated with a configuration against a reference one.
+struct CVAEPrecisionReport {
+	CVAEEvaluation Reference;
+	CVAEEvaluation Evaluation;
+	int Samples;
+	// Samples skipped because the reference networks are not finite (e.g. softplus overflow of MLPMathMode::Reference)
+	int NonFinite;
+	// Samples skipped because only the evaluated networks are not finite
+	int Overflows;
+	// Absolute errors of the output distributions for the same inputs
+	CVAEPrecisionError LenMu, LenLogVar;
+	CVAEPrecisionError PathMu, PathLogVar;
+	CVAEPrecisionError ScatMu, ScatLogVar;
+	// Fraction of the samples with the same latents where the absorption changes
+	float AbsorptionMismatch;
+	// Relative error of the number of scattering events of the paths that are not absorbed in both evaluations
+	CVAEPrecisionError Events;
+	// Distances between the exits (and the sampled scattering) of the paths that are not absorbed in both evaluations
+	CVAEPrecisionError ExitPosition, ExitDirection;
+	CVAEPrecisionError ScatPosition, ScatDirection;
+	// Single thread throughput of the three networks evaluated in batches
+	float ReferenceSamplesPerSecond;
+	float SamplesPerSecond;
+};
+
+/// Compares the networks evaluated with a configuration against a reference one on a fixed set of inputs and latents
+/// (the same for a seed). The networks are left in fp32 with the accurate activations.
+inline CVAEPrecisionReport CompareCVAEEvaluation(CVAEModels& models, CVAEEvaluation reference, CVAEEvaluation evaluation,
+	int samples = 100000, unsigned int seed = 1) {
+	CVAEPrecisionReport result = {};
+	result.Reference = reference;
+	result.Evaluation = evaluation;
+	result.Samples = samples;
+
+	auto configure = [&models](CVAEEvaluation e) {
+		models.SetPrecision(e.Precision);
+		models.SetMathMode(e.Math);
+	};
+
+	// xorshift32
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto random = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+	auto randomStdNormal = [&random]() {
+		float u1 = 1 - random();
+		float u2 = random();
+		return sqrtf(-2 * logf(u1)) * cosf(2 * 3.14159265f * u2);
+	};
+
+	struct Case {
+		float Density, G, Phi;
+		float3 Win;
+		CVAELatents Latents;
+	};
+	struct Outcome {
+		float Len[2], Path[6], Scat[12];
+		bool Scattered;
+		float N;
+		float3 x, w, X, W;
+	};
+
+	// Inputs of the networks stored by feature (as used by the batched evaluation).
+	// Path and scat inputs are sampled independently to cover their whole range.
+	float* lenInputs = new float[4 * samples];
+	float* pathInputs = new float[8 * samples];
+	float* scatInputs = new float[12 * samples];
+	float* outputs = new float[12 * samples];
+	Case* cases = new Case[samples];
+	Outcome* referenceOutcomes = new Outcome[samples];
+	Outcome* outcomes = new Outcome[samples];
+
+	for (int s = 0; s < samples; s++)
+	{
+		Case& c = cases[s];
+		c.Density = random() * 400;
+		c.G = random() * 2 - 1;
+		c.Phi = random();
+		c.Win = normalize(float3(randomStdNormal(), randomStdNormal(), randomStdNormal()));
+		c.Latents.Rotation = random();
+		c.Latents.Absorption = random();
+		c.Latents.LenSample = randomStdNormal();
+		for (int i = 0; i < 2; i++) c.Latents.Len[i] = randomStdNormal();
+		for (int i = 0; i < 5; i++) c.Latents.Path[i] = randomStdNormal();
+		for (int i = 0; i < 3; i++) c.Latents.PathSample[i] = randomStdNormal();
+		for (int i = 0; i < 5; i++) c.Latents.Scat[i] = randomStdNormal();
+		for (int i = 0; i < 6; i++) c.Latents.ScatSample[i] = randomStdNormal();
+
+		float logN = random() * 8;
+		float lenInput[4] = { c.Density, c.G, c.Latents.Len[0], c.Latents.Len[1] };
+		float pathInput[8] = { c.Density, c.G, logN, c.Latents.Path[0], c.Latents.Path[1], c.Latents.Path[2], c.Latents.Path[3], c.Latents.Path[4] };
+		float scatInput[12] = { c.Density, c.G, powf(1 - c.Phi, 1.0f / 6.0f), logN, random() * 2 - 1, random() * 2 - 1, random() * 2 - 1,
+			c.Latents.Scat[0], c.Latents.Scat[1], c.Latents.Scat[2], c.Latents.Scat[3], c.Latents.Scat[4] };
+		for (int i = 0; i < 4; i++) lenInputs[i * samples + s] = lenInput[i];
+		for (int i = 0; i < 8; i++) pathInputs[i * samples + s] = pathInput[i];
+		for (int i = 0; i < 12; i++) scatInputs[i * samples + s] = scatInput[i];
+	}
+
+	auto evaluate = [&](Outcome* o) {
+		for (int s = 0; s < samples; s++)
+		{
+			const Case& c = cases[s];
+			float input[12];
+			for (int i = 0; i < 4; i++) input[i] = lenInputs[i * samples + s];
+			models.lenModel(input, o[s].Len);
+			for (int i = 0; i < 8; i++) input[i] = pathInputs[i * samples + s];
+			models.pathModel(input, o[s].Path);
+			if (models.HasScattering())
+			{
+				for (int i = 0; i < 12; i++) input[i] = scatInputs[i * samples + s];
+				models.scatModel(input, o[s].Scat);
+			}
+
+			CVAEPathVariables variables;
+			o[s].Scattered = GenerateVariablesWithModel(models, c.G, c.Phi, c.Win, c.Density, c.Latents, o[s].x, o[s].w, variables);
+			o[s].N = variables.N;
+			float factor;
+			if (models.HasScattering())
+				GenerateFullVariablesWithModel(models, c.G, c.Phi, c.Win, c.Density, c.Latents, o[s].x, o[s].w, o[s].X, o[s].W, factor);
+		}
+	};
+	configure(reference);
+	evaluate(referenceOutcomes);
+	configure(evaluation);
+	evaluate(outcomes);
+
+	struct Accumulated {
+		double Sum = 0;
+		float Max = 0;
+		int Count = 0;
+		void Add(float e) { Sum += e; Max = maxf(Max, e); Count++; }
+		CVAEPrecisionError Get() const { return CVAEPrecisionError{ Count == 0 ? 0.0f : (float)(Sum / Count), Max }; }
+	};
+	Accumulated lenMu, lenLogVar, pathMu, pathLogVar, scatMu, scatLogVar;
+	Accumulated events, exitPosition, exitDirection, scatPosition, scatDirection;
+	int mismatches = 0;
+
+	// First half of the outputs of a network are mu and the second half logVar
+	auto compare = [](const float* a, const float* b, int count, Accumulated& mu, Accumulated& logVar) {
+		for (int i = 0; i < count / 2; i++)
+		{
+			mu.Add(fabsf(a[i] - b[i]));
+			logVar.Add(fabsf(a[count / 2 + i] - b[count / 2 + i]));
+		}
+	};
+	auto finite = [](const float* a, int count) {
+		for (int i = 0; i < count; i++)
+			if (!isfinite(a[i]))
+				return false;
+		return true;
+	};
+
+	for (int s = 0; s < samples; s++)
+	{
+		const Outcome& r = referenceOutcomes[s];
+		const Outcome& o = outcomes[s];
+		if (!finite(r.Len, 2) || !finite(r.Path, 6) || (models.HasScattering() && !finite(r.Scat, 12)) ||
+			!isfinite(r.N) || !isfinite(r.x.x) || !isfinite(r.w.x))
+		{
+			result.NonFinite++;
+			continue;
+		}
+
+		if (!finite(o.Len, 2) || !finite(o.Path, 6) || (models.HasScattering() && !finite(o.Scat, 12)) ||
+			!isfinite(o.N) || !isfinite(o.x.x) || !isfinite(o.w.x))
+		{
+			result.Overflows++;
+			continue;
+		}
+
+		compare(o.Len, r.Len, 2, lenMu, lenLogVar);
+		compare(o.Path, r.Path, 6, pathMu, pathLogVar);
+		if (models.HasScattering())
+			compare(o.Scat, r.Scat, 12, scatMu, scatLogVar);
+
+		if (o.Scattered != r.Scattered)
+		{
+			mismatches++;
+			continue;
+		}
+		if (!r.Scattered)
+			continue;
+		events.Add(fabsf(o.N - r.N) / r.N);
+		exitPosition.Add(length(o.x - r.x));
+		exitDirection.Add(length(o.w - r.w));
+		if (models.HasScattering() && r.N >= 2 && o.N >= 2)
+		{
+			scatPosition.Add(length(o.X - r.X));
+			scatDirection.Add(length(o.W - r.W));
+		}
+	}
+
+	result.LenMu = lenMu.Get();
+	result.LenLogVar = lenLogVar.Get();
+	result.PathMu = pathMu.Get();
+	result.PathLogVar = pathLogVar.Get();
+	result.ScatMu = scatMu.Get();
+	result.ScatLogVar = scatLogVar.Get();
+	result.AbsorptionMismatch = mismatches / (float)max(1, samples - result.NonFinite - result.Overflows);
+	result.Events = events.Get();
+	result.ExitPosition = exitPosition.Get();
+	result.ExitDirection = exitDirection.Get();
+	result.ScatPosition = scatPosition.Get();
+	result.ScatDirection = scatDirection.Get();
+
+	for (int pass = 0; pass < 2; pass++)
+	{
+		configure(pass == 0 ? reference : evaluation);
+		Stopwatch stopwatch;
+		models.lenModelBatch(lenInputs, outputs, samples);
+		models.pathModelBatch(pathInputs, outputs, samples);
+		if (models.HasScattering())
+			models.scatModelBatch(scatInputs, outputs, samples);
+		float samplesPerSecond = samples * 1000.0f / stopwatch.Milliseconds();
+		if (pass == 0)
+			result.ReferenceSamplesPerSecond = samplesPerSecond;
+		else
+			result.SamplesPerSecond = samplesPerSecond;
+	}
+	configure(CVAEEvaluation{ MLPPrecision::Float32, MLPMathMode::Accurate });
+
+	delete[] lenInputs;
+	delete[] pathInputs;
+	delete[] scatInputs;
+	delete[] outputs;
+	delete[] cases;
+	delete[] referenceOutcomes;
+	delete[] outcomes;
+	return result;
+}
+
+/// Compares the networks evaluated with a reduced precision against fp32.
+inline CVAEPrecisionReport CheckCVAEPrecision(CVAEModels& models, MLPPrecision precision, int samples = 100000, unsigned int seed = 1) {
+	return CompareCVAEEvaluation(models, CVAEEvaluation{ MLPPrecision::Float32, MLPMathMode::Accurate },
+		CVAEEvaluation{ precision, MLPMathMode::Accurate }, samples, seed);
+}
+
+/// Compares the networks evaluated with an implementation of the activations against the accurate one in fp32,
+/// e.g. the effect of MLPMathMode::Fast on the sampled exits or the overflows of MLPMathMode::Reference.
+inline CVAEPrecisionReport CheckCVAEMathMode(CVAEModels& models, MLPMathMode mode, int samples = 100000, unsigned int seed = 1) {
+	return CompareCVAEEvaluation(models, CVAEEvaluation{ MLPPrecision::Float32, MLPMathMode::Accurate },
+		CVAEEvaluation{ MLPPrecision::Float32, mode }, samples, seed);
+}
@@ -1,18 +1,24 @@
 #pragma once
 
-#include "SphereTracingBase.h"
+#include "CVAETechniqueBase.h"
 
-class CVAEPathtracingTechnique : public SphereTracingBase {
+class CVAEPathtracingTechnique : public CVAETechniqueBase {
 
 public:
 	~CVAEPathtracingTechnique() {}
 
-	struct CVAEPathtracing : public STPathtracingPipeline {
+	struct CVAEPathtracing : public CVAEPipeline {
 		virtual const char* ShaderFile() {
 			return "./Techniques/CVAEPathtracing/CVAEPathtracing_RT.cso";
 		}
 	};
 
+#ifndef USE_CVAE_X
+	virtual const char* BakedModelFile() override {
+		return ".\\Techniques\\CVAEPathtracing\\CVAEScatteringModel.bin";
+	}
+#endif
+
 	virtual void CreatePipeline(gObj<RTXPathtracingPipelineBase>& pipeline)
 	{
 		pipeline = new CVAEPathtracing();
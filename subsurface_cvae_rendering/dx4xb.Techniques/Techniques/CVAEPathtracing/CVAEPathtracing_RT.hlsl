@@ -1,6 +1,8 @@
 #include "STBase_RT.h"
 
-#ifdef USE_CVAE_X
+#if defined(USE_CVAE_MODEL_BUFFER)
+#include "CVAEModelBuffer_RT.h"
+#elif defined(USE_CVAE_X)
 #include "CVAEScatteringModelX.h"
 #else
 #include "CVAEScatteringModel.h"
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "CVAEModels.h"
+
+/// Random numbers consumed by GenerateVariablesWithModel and GenerateFullVariablesWithModel in the shaders.
+/// The CPU versions take them as input, so the same paths can be sampled with different networks.
+struct CVAELatents {
+	// Uniform, rotation around the incoming direction
+	float Rotation;
+	// Standard normals of the lenModel latent and of the sampled length
+	float Len[2];
+	float LenSample;
+	// Uniform, absorption test
+	float Absorption;
+	// Standard normals of the pathModel latent and of the sampled exit
+	float Path[5];
+	float PathSample[3];
+	// Standard normals of the scatModel latent and of the sampled scattering (position and direction)
+	float Scat[5];
+	float ScatSample[6];
+};
+
+/// Radial space of the samplers, the tangent frame of win rotated by rAlpha around win.
+/// Rows of the matrix R in the shaders.
+struct CVAEFrame {
+	float3 R0, R1, R2;
+
+	CVAEFrame(float3 win, float rAlpha) {
+		float3 temp = fabsf(win.x) >= 0.9999f ? float3(0, 0, 1) : float3(1, 0, 0);
+		float3 winY = normalize(cross(temp, win));
+		float3 winX = cross(win, winY);
+		float c = cosf(rAlpha), s = sinf(rAlpha);
+		R0 = winX * c - winY * s;
+		R1 = winX * s + winY * c;
+		R2 = win;
+	}
+
+	// mul(v, R)
+	inline float3 ToRadial(float3 v) const {
+		return R0 * v.x + R1 * v.y + R2 * v.z;
+	}
+};
+
+inline float CVAESampleNormal(float mu, float logVar, float z) {
+	return mu + z * expf(clamp(logVar, -16.0f, 16.0f) * 0.5f);
+}
+
+/// Variables of a sampled path used by the scattering model.
+struct CVAEPathVariables {
+	float N;
+	float LogN;
+	float CosTheta;
+	float Wt;
+	float Wb;
+};
+
+/// CPU version of GenerateVariablesWithModel (CVAEPathtracing_RT.hlsl) with the random numbers given by latents.
+/// Returns false if the path is absorbed, otherwise x and w are the exit position and direction (unit sphere, radial space).
+inline bool GenerateVariablesWithModel(const CVAEModels& models, float G, float Phi, float3 win, float density,
+	const CVAELatents& latents, float3& x, float3& w, CVAEPathVariables& path) {
+	x = float3(0, 0, 0);
+	w = win;
+
+	CVAEFrame R(win, latents.Rotation * 2 * 3.14159265f);
+
+	float lenInput[4] = { density, G, latents.Len[0], latents.Len[1] };
+	float lenOutput[2];
+	models.lenModel(lenInput, lenOutput);
+
+	float logN = maxf(0.0f, CVAESampleNormal(lenOutput[0], lenOutput[1], latents.LenSample));
+	float n = roundf(expf(logN) + 0.49f);
+	logN = logf(n);
+	path.N = n;
+	path.LogN = logN;
+
+	if (latents.Absorption >= powf(Phi, n))
+		return false;
+
+	float pathInput[8] = { density, G, logN, latents.Path[0], latents.Path[1], latents.Path[2], latents.Path[3], latents.Path[4] };
+	float pathOutput[6];
+	models.pathModel(pathInput, pathOutput);
+	float pathOut[3];
+	for (int i = 0; i < 3; i++)
+		pathOut[i] = clamp(CVAESampleNormal(pathOutput[i], pathOutput[3 + i], latents.PathSample[i]), -0.9999f, 0.9999f);
+	float costheta = pathOut[0];
+	float wt = n > 1 ? pathOut[1] : 0.0f; // only if n > 1
+	float wb = n > 2 ? pathOut[2] : 0.0f; // only if n > 2
+	path.CosTheta = costheta;
+	path.Wt = wt;
+	path.Wb = wb;
+
+	x = float3(0, sqrtf(1 - costheta * costheta), costheta);
+	float3 N = x;
+	float3 B = float3(1, 0, 0);
+	float3 T = cross(x, B);
+
+	w = normalize(N * sqrtf(maxf(0.0f, 1 - wt * wt - wb * wb)) + T * wt + B * wb);
+	x = R.ToRadial(x);
+	w = R.ToRadial(w); // move to radial space
+	return true;
+}
+
+/// CPU version of GenerateFullVariablesWithModel (NEECVAEPathtracing_RT.hlsl) with the random numbers given by latents.
+/// X and W are the sampled scattering position and direction inside the sphere, factor the weight of its contribution.
+/// The networks must have a scattering model.
+inline bool GenerateFullVariablesWithModel(const CVAEModels& models, float G, float Phi, float3 win, float density,
+	const CVAELatents& latents, float3& x, float3& w, float3& X, float3& W, float& factor) {
+	X = float3(0, 0, 0);
+	W = win;
+	factor = 1;
+
+	CVAEPathVariables path;
+	if (!GenerateVariablesWithModel(models, G, Phi, win, density, latents, x, w, path))
+		return false;
+
+	float scatInput[12] = { density, G, powf(1 - Phi, 1.0f / 6.0f), path.LogN, path.CosTheta, path.Wt, path.Wb,
+		latents.Scat[0], latents.Scat[1], latents.Scat[2], latents.Scat[3], latents.Scat[4] };
+	float scatOutput[12];
+	models.scatModel(scatInput, scatOutput);
+
+	if (path.N >= 2)
+	{
+		CVAEFrame R(win, latents.Rotation * 2 * 3.14159265f);
+		X = float3(
+			CVAESampleNormal(scatOutput[0], scatOutput[6], latents.ScatSample[0]),
+			CVAESampleNormal(scatOutput[1], scatOutput[7], latents.ScatSample[1]),
+			CVAESampleNormal(scatOutput[2], scatOutput[8], latents.ScatSample[2]));
+		X = X / maxf(1.0f, length(X));
+		W = normalize(float3(
+			CVAESampleNormal(scatOutput[3], scatOutput[9], latents.ScatSample[3]),
+			CVAESampleNormal(scatOutput[4], scatOutput[10], latents.ScatSample[4]),
+			CVAESampleNormal(scatOutput[5], scatOutput[11], latents.ScatSample[5])));
+
+		X = R.ToRadial(X);
+		W = R.ToRadial(W); // move to radial space
+
+		float accum = Phi >= 0.99999f ? path.N : Phi * (1 - powf(Phi, path.N)) / (1 - Phi);
+		factor = accum / powf(Phi, path.N);
+	}
+	return true;
+}
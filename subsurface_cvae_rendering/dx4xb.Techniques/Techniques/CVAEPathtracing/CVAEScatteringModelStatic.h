@@ -0,0 +1,159 @@
+// Networks of CVAEScatteringModel.h compiled for StaticMLP (see CPU/StaticMLP.h).
+
+constexpr float lenModelParameters[] = {
+	0.0122271990f, -0.00101708167f, -0.567415476f, 0.458054245f, 0.452227622f, -1.95851290f, -0.0143996608f, -0.000181068404f,
+	3.79437995f, -0.134266496f, -0.380310684f, 2.77176595f, -0.185353294f, 0.124791600f, 0.410965770f, 9.04845142f,
+	0.211322144f, 0.189186051f, 0.179097787f, 1.13683522f, 0.557630360f, -1.48589540f, -0.593092203f, 0.0869317055f,
+	-2.91357192e-05f, 1.98445323e-05f, 7.04889680e-05f, 8.03430448e-05f, -3.87826185e-06f, 0.000121876605f, -4.64706973e-05f, -9.08664661e-05f,
+	-3.23680758f, 0.409097999f, -0.585904777f, -3.37986493f, 0.351260841f, 1.74073410f, 2.17526031f, -10.2391500f,
+	-1.11869872f, 0.0572388135f, -0.975907922f, -3.72127628f, 0.204749078f, 0.0722579435f, -0.121291168f, 1.95493686f,
+	6.07386971f, -0.0364819616f, -1.01329088f, 14.3453760f, 8.03407478f, 0.490335286f, -0.147057161f, -0.792587757f,
+	-8.06221962f, -0.138622284f, 0.0424991250f, -23.3430767f, 0.880880654f, 0.461012334f, -0.271208614f, -0.945658684f,
+	-0.295830607f, 0.210183039f, 0.0622607321f, -0.902790189f, 0.330369771f, 0.0845065862f, 0.0162301268f, -0.216004550f,
+	0.501701593f, -0.538762629f, 0.00777693605f, 1.60351872f, -0.317992717f, 0.432249993f, -0.0984428003f, 0.694982111f,
+	-5.19487238f, -0.140893966f, -9.41729355f, -14.7805128f, -0.465191483f, -0.127190426f, -0.607262731f, -0.226735458f,
+	-0.962028384f, 0.394850582f, -0.357001662f, -3.17268491f, 1.29282987f, 0.0631322637f, -0.138719603f, 0.117451549f,
+	4.56121492f, -0.107335106f, 8.27682877f, 17.1522999f, -0.427021146f, -0.114836499f, -1.17843044f, -0.0170759987f,
+	2.75974894f, -1.54914141f, 0.183208689f, 6.67704964f, 6.42642307f, 1.69929206f, 0.0225427933f, -4.48297739f,
+	-0.00659786817f, 11.1251059f, 0.389776021f, 0.0649550930f, -1.54450500f, 1.89854455f, 0.167568117f, -3.94241405f,
+	-0.191542551f, -1.29817677f, 0.579242349f, 0.748831630f, -0.252389938f, -16.4172325f, -0.581675351f, -0.0708570331f,
+	1.45567334f, 1.93787408f };
+typedef StaticMLP<lenModelParameters, 4,
+	StaticLayer<8, MLPActivation::Softplus>,
+	StaticLayer<8, MLPActivation::Softplus>,
+	StaticLayer<2, MLPActivation::None>> lenModelStatic;
+
+constexpr float pathModelParameters[] = {
+	-0.00178896636f, -0.00304706302f, -0.00397127355f, 0.00807061605f, 0.00265344442f, 0.00164695620f, -0.00616388256f, -0.00524123153f,
+	-0.00343392184f, -0.0123171713f, -0.00215362059f, 0.00277782488f, -0.284103423f, -0.869757056f, -0.742061853f, 6.63966370f,
+	0.833292186f, 0.268252224f, -2.76255059f, -1.35404611f, -0.895750999f, -2.97638106f, -0.344329655f, 0.944804192f,
+	-22.5281773f, 0.271317810f, 0.321027100f, -0.872353077f, -24.1100388f, -2.14785051f, -0.702696681f, 0.457772464f,
+	0.302716076f, -28.4150543f, 0.172969401f, -0.261892706f, -2.13177973e-05f, -1.16618667e-05f, -5.42462949e-05f, -4.23446045e-06f,
+	1.49475045e-05f, 6.80712765e-05f, 0.000114162161f, -4.81618663e-05f, -8.21055364e-05f, -1.36127373e-05f, 7.39503303e-05f, -0.000102851751f,
+	1.65777928e-05f, -6.55649637e-05f, 9.73712740e-05f, -0.000171021340f, 2.65733725e-05f, 5.42602793e-05f, -6.85443010e-05f, -3.25335641e-05f,
+	-9.77117597e-05f, -9.15425426e-06f, -5.93134100e-05f, -1.22149768e-05f, -0.235485375f, -1.52555597f, 0.762209058f, 1.03281212f,
+	0.375134885f, 0.117040724f, 0.698766470f, -0.477647215f, -0.219636366f, -1.15876865f, -1.31700087f, 0.460173249f,
+	2.07198500e-05f, 1.17849086e-05f, -2.17197012e-05f, 0.000208989833f, -6.76574127e-05f, -8.66589380e-06f, 8.44215465e-05f, -3.21261978e-05f,
+	1.24328108e-06f, -2.04435273e-05f, 7.11071043e-05f, -1.50405131e-05f, 4.30852197e-05f, -0.000189477214f, -3.93645278e-05f, 0.000125907725f,
+	1.85541958e-05f, 7.98257606e-05f, 3.94322815e-05f, -4.72740212e-05f, -1.87881619e-06f, 1.40886368e-05f, 6.85471823e-05f, -1.94933509e-05f,
+	-1.42060184f, -1.74690223f, -1.56047738f, -8.46701908f, -1.45973814f, -0.741697788f, -4.73182869f, -0.445787847f,
+	-1.68130803f, -1.82521164f, -1.52668297f, -0.657239318f, 0.351166189f, -1.27806568f, -0.970303237f, 0.378053069f,
+	-0.160232306f, 2.59747791f, -0.317795634f, 2.35172915f, -0.427291036f, -6.41116047f, -2.43438101f, 3.48589063f,
+	0.0915325582f, 0.240725502f, -0.531488478f, 0.0119013730f, 0.215972915f, -0.226519972f, -3.57231712f, -0.762282073f,
+	0.211813956f, -0.194683284f, 0.757773936f, -0.0138079999f, -0.0934142843f, 0.197665334f, -1.98731661f, 0.134898826f,
+	-0.0282261353f, -0.136002228f, -0.199669093f, -0.199812740f, -0.341726094f, -0.170734018f, -0.0492770672f, -0.178165704f,
+	0.496450514f, 0.235733733f, 0.0533217527f, -0.397678673f, 0.519120276f, -0.475186795f, -0.164549321f, -2.33206844f,
+	-1.16613686f, -3.24268794f, 0.0473604314f, -0.722746491f, 2.28547621f, 0.371698260f, -0.623151958f, -0.519849300f,
+	1.26165557f, 0.924177647f, -0.302040845f, -2.57072282f, -0.654607952f, -3.55535293f, -0.768277407f, -0.0568736643f,
+	-0.703174472f, -0.789855301f, 0.393172145f, 0.163964391f, 0.130465180f, -0.959444284f, -0.208077610f, -0.706166029f,
+	-0.269956231f, -0.886983514f, -1.12673748f, 0.0304243434f, 0.408157885f, -0.798986495f, -5.03405046f, -0.305017084f,
+	0.338863581f, 0.0747273266f, 1.51229739f, 0.424074799f, 0.846715212f, -1.21317506f, 2.08991122f, 0.180103660f,
+	-0.438992232f, -0.126599789f, 0.527826071f, 0.227797404f, -0.212727785f, -0.00268672896f, -1.00263381f, 0.255277425f,
+	-0.364283085f, -0.0670768470f, -1.03944755f, 0.106087320f, 0.295562208f, -0.492434859f, -0.0889741927f, -0.462819606f,
+	0.325656503f, -0.283376336f, -0.0973940715f, 0.0117482031f, -0.420793921f, 0.152664110f, -0.826450586f, 0.132829741f,
+	0.286537319f, -0.971281946f, -5.21061516f, -0.177214801f, 0.255545139f, -0.337079495f, -3.75038004f, -4.46321249f,
+	-0.438922346f, -2.84657001f, -0.962020993f, -0.617703736f, -0.237752378f, -0.515553951f, -0.719592154f, 0.0290841758f,
+	-0.269878328f, 0.0133283408f, 1.74084330f, -0.378437400f, -0.409220010f, -0.0604963154f, -2.94456482f, -0.218392104f,
+	-0.109035358f, 0.133366391f, -2.08990169f, -0.578603506f, 0.169805855f, -0.654147923f, -0.320738345f, -0.963504136f,
+	-0.687005162f, -0.556975722f, -0.224348411f, -0.611451447f, 1.98636425f, -0.0553616993f, -0.315265834f, -0.411159188f,
+	0.416828424f, 1.99900484f, -0.252576321f, -0.00418522116f, -0.546386600f, -0.136213467f, 0.0637360811f, 0.0470168255f,
+	-0.261282474f, 0.762171030f, -0.0358974971f, -4.15539932f, -4.14821386f, 2.38459945f, 1.70968699f, -0.0671698824f,
+	0.000319638697f, 2.97593546f, 1.31396019f, -8.71542454f, -2.51278901f, -0.00494453125f, -0.00138410809f, -3.07691431f,
+	-1.02682841f, 0.730437994f, -0.781212807f, 0.333947420f, -0.0514404029f, -15.9142885f, 0.438357085f, 10.4259148f,
+	0.0848142654f, -1.03045440f, 0.0392120257f, -1.13475978f, -2.19555116f, 9.58770657f, 0.169749066f, -0.579843402f,
+	0.0115493489f, 0.429459393f, -3.71767783f, -10.2126474f, 5.37280941f, -0.0169024244f, 0.00174041407f, 7.17867184f,
+	-1.49623239f, -4.24861717f, 2.10318041f, -0.000332578784f, 0.00227600918f, -0.138553843f, -3.15544629f, -3.01515126f,
+	-2.25806022f, -0.205398142f, -0.0114007723f, 6.62999058f, -0.797515929f, -20.5085773f, -0.909626007f, 0.139798865f,
+	-0.00598039106f, 10.6911907f, 32.8886719f, 58.3825455f, -2.43715620f, 0.0316107757f, -0.00195812155f, -8.78455353f,
+	4.12677670f, 6.00728226f, -0.0449335650f, 0.446623355f, 0.00148666266f, 14.5135956f, -8.90974712f, -19.5438862f,
+	-0.345525682f, 0.200508535f, 0.0330091603f, -7.31903076f, 4.33267784f, -6.79034710f };
+typedef StaticMLP<pathModelParameters, 8,
+	StaticLayer<12, MLPActivation::Softplus>,
+	StaticLayer<12, MLPActivation::Softplus>,
+	StaticLayer<6, MLPActivation::None>> pathModelStatic;
+
+constexpr float scatModelParameters[] = {
+	-0.00526846712f, -0.0129617974f, -0.00824313890f, 0.00247066980f, -0.00768661778f, 0.00399318105f, -0.00212620106f, -0.00884791277f,
+	-0.346721798f, -0.0942756683f, -0.00839700457f, -0.00530735636f, 0.487005889f, -0.0580649488f, -0.190448314f, 0.0258789212f,
+	-0.341444939f, -0.0466281213f, 0.321790844f, 0.332117796f, -1.59055996f, -0.346924394f, 0.0917955264f, 0.208001420f,
+	2.26848936f, -8.63055801f, 0.594901741f, 0.258368939f, -1.34381318f, 0.294728488f, -1.62458217f, -3.16777658f,
+	-1.31350815f, -1.95902050f, 0.0351144895f, -6.19587135f, 0.667516649f, 1.18969977f, -0.326483101f, 0.0150448000f,
+	0.273841739f, 0.0981387198f, 0.0396888256f, -0.153983682f, -0.207629398f, 0.471163779f, 0.358704776f, 0.420112222f,
+	-0.122258008f, -0.163869873f, 0.0625512302f, -0.0221974608f, -0.0971920937f, -0.0558724068f, 0.0284286309f, -0.266017795f,
+	-0.194723248f, -0.104469240f, -0.0731906891f, 0.00624835771f, -0.0106461933f, -0.105892099f, 0.117958754f, 0.0282806251f,
+	-0.114793576f, 0.0238707848f, 0.0192184281f, -0.0785425380f, -0.449750751f, -0.00125340710f, -0.0738460645f, -0.0324144326f,
+	0.0413880199f, 0.135810137f, 0.0396432616f, 0.0292695276f, -0.0343854576f, 0.0287558008f, 0.0237028692f, -0.0132237105f,
+	0.0266847704f, 0.0366378501f, -0.0333920494f, 0.0523861274f, -0.00441805972f, -0.0134784682f, 0.00453467201f, 0.00658465549f,
+	0.00521804951f, 0.00772804581f, -0.00215894030f, 0.0226602983f, 0.0464243777f, -0.0297630616f, -0.0128785670f, -0.00534511777f,
+	-0.00641656108f, -0.00480430853f, -0.00142219535f, 0.00611589896f, 0.0191851854f, 0.00590199465f, -0.00385795417f, 0.0157113131f,
+	0.0552451685f, -0.0333562195f, -0.00980832893f, -0.00136383227f, -0.00556037715f, -0.0167298242f, -0.00512155565f, 0.0120946597f,
+	0.0219701361f, 0.0101357205f, -0.00239221333f, 0.0321174152f, 0.0654105619f, -0.0501799844f, -0.0204620361f, -0.00723025994f,
+	0.00662960624f, 0.0154490741f, -0.00113238208f, -0.0118115339f, -0.0184425097f, -0.00985561218f, 0.00249478384f, -0.0371120349f,
+	-0.0794114321f, 0.0626171529f, 0.0203870274f, 0.00729194563f, 0.489711106f, 4.42519855f, -0.00221681828f, 0.122793585f,
+	0.519192755f, 0.375822395f, 0.0669604093f, 3.06325293f, 1.21586037f, 1.40056443f, 0.274699241f, 1.67231905f,
+	-0.652938247f, 3.60210633f, -0.769537151f, 0.415231973f, -0.718998730f, -1.45378244f, 0.515402138f, 0.816285968f,
+	-0.920693755f, -1.90514612f, 0.0674155578f, 1.68081725f, 0.0332535543f, 0.251479894f, -0.474890023f, 0.177096754f,
+	-0.0998294950f, 0.219039932f, 0.249667570f, -0.199414164f, 0.315729976f, -0.0582872927f, -0.0313897617f, -0.483335346f,
+	-0.934543550f, -4.92812967f, 1.64552581f, 1.80862522f, -3.05846739f, 0.443802446f, -4.57395029f, -3.89926457f,
+	1.06786609f, 2.90366411f, -1.13833034f, -0.504670322f, -0.0252823345f, 1.74277532f, -0.695585847f, -0.700899720f,
+	0.546403646f, 0.970547318f, 1.72161150f, -1.30061293f, 0.275744528f, 0.00817191601f, 0.312303066f, -3.53535843f,
+	0.418522060f, -0.0678682104f, 0.269345880f, -0.714697838f, 0.789694011f, -0.840320528f, 1.17738867f, -0.511844397f,
+	0.433351219f, 0.280561239f, -0.195159256f, -1.39636266f, 0.412184179f, 2.32915783f, -1.14407730f, 0.248256341f,
+	-0.00672045210f, 0.971287251f, 1.94753301f, -1.85716212f, 0.524099946f, -0.238146111f, -0.405687839f, -3.50775766f,
+	-0.247953862f, 1.61545587f, -0.157395706f, 0.211394668f, 0.315050930f, 0.672270656f, 0.603100359f, -1.97171140f,
+	0.898409843f, 0.239341155f, 0.783032775f, -3.34015536f, -0.0179767050f, 1.84969831f, -0.346195549f, -0.636496961f,
+	0.107970715f, 0.873605669f, 0.706953645f, -0.585647523f, 0.0752016157f, 0.190039739f, 0.240319327f, -2.05282283f,
+	-0.329398036f, 1.00290608f, 0.756201565f, 0.0242304765f, 1.48662555f, -0.866884947f, 1.57705963f, -1.99141002f,
+	-0.570597708f, 3.03229976f, 0.489333391f, -0.539859176f, 0.147579655f, 1.10833073f, -1.32752860f, -0.628769159f,
+	-0.112391137f, 0.298429161f, 0.694448769f, 0.959872723f, 0.0562870912f, 0.327144206f, 0.191922411f, 0.448152989f,
+	-0.0768906325f, -0.130662426f, -0.411700994f, -0.353207529f, -0.876897275f, 0.252678394f, -0.576100290f, 1.30691397f,
+	0.0241958424f, 0.705516756f, 0.389004678f, 0.611183226f, 0.119229428f, 0.149642915f, 0.614604473f, -0.293476224f,
+	0.224824935f, -0.336887717f, 0.305355042f, -0.233076349f, 0.510500431f, 0.250261396f, 0.258204758f, -0.330936790f,
+	0.867535353f, 1.19246089f, 0.823262095f, -1.15613806f, 0.00583572220f, -1.71695662f, 0.960226715f, -3.44722867f,
+	-0.567229211f, 0.432654530f, 0.312221617f, -1.30575097f, 0.953918338f, -0.218180984f, 0.152883276f, -0.577486634f,
+	0.722985327f, -1.06199777f, -0.519487917f, 1.47296739f, 0.623620391f, 0.797460020f, 1.10158670f, 1.63050592f,
+	-0.448417962f, -1.06132269f, -0.328256935f, -0.444679379f, -8.58101940f, -0.664306939f, -0.567627013f, -1.47803748f,
+	0.0165555403f, -0.296430081f, -0.780851305f, -1.01237202f, 0.188502237f, -0.456076443f, -0.0448729917f, 0.384267956f,
+	4.11212492f, 0.0928114131f, -0.692574680f, 0.0228136666f, -0.328817368f, -0.513600171f, 0.258164108f, 0.0698201880f,
+	-1.20747590f, -0.667836130f, 0.122953430f, -0.887895107f, 0.164840862f, 0.112639859f, -0.358944774f, -0.0834723040f,
+	-2.31267691f, -0.912605941f, -0.244271591f, -1.23639059f, 0.126611203f, -2.06674647f, 0.00271197897f, 0.602393627f,
+	1.22645128f, -0.187656701f, 1.06348693f, 0.0312191136f, 2.54326344f, 2.11544824f, -2.38610911f, -1.55585575f,
+	-0.327747583f, -0.00557363313f, -0.259294719f, -0.660213351f, -5.08084345f, -0.231781214f, -1.80030572f, -0.235726610f,
+	0.183608115f, -0.992215276f, -0.517225444f, 0.109304950f, -0.542734087f, -0.131438047f, -0.154105633f, 0.717055559f,
+	-3.02595353f, -0.702100515f, -2.51294494f, 0.100019626f, -0.603398740f, -2.08314490f, -0.707743824f, -1.16006196f,
+	0.377231508f, -0.408196181f, -0.627496541f, 2.99331331f, -2.10808349f, 0.0865924656f, -0.586099267f, -1.32453740f,
+	1.17783916f, -0.128702253f, -0.375403792f, 0.118061490f, -2.05362749f, -4.39982796f, -1.52482653f, 0.259632528f,
+	-10.5787048f, 0.117983490f, -1.76598024f, -3.59930158f, -0.607119024f, -1.08738112f, -1.64130473f, -1.41051292f,
+	-1.10606551f, -0.0256623495f, -0.0433693305f, -1.79937863f, -1.16787899f, 0.0495977141f, 0.297877043f, -0.00861757062f,
+	-0.00773577252f, -0.115812615f, -0.514395356f, -0.337837249f, -0.930604935f, -0.220079944f, -0.0797376558f, -1.04514229f,
+	-0.237002924f, -0.0612461530f, -0.451947957f, 0.0460759699f, -0.865176439f, -0.419907928f, -0.515726566f, -0.646173418f,
+	-0.671865463f, -0.731118441f, 0.507860601f, -0.751554906f, 4.66121817f, -0.181633338f, -0.250564963f, 0.0157229844f,
+	-0.928482533f, 0.397671312f, -0.425195158f, -0.0888710544f, -6.40136337f, -2.53606653f, -0.378820926f, -2.92578578f,
+	2.08507967f, -0.955226183f, -4.05475807f, -2.92267084f, -4.21481705f, -7.36605358f, -1.11865723f, -2.99780607f,
+	-0.397050709f, -0.607502580f, -0.583310664f, -0.169501767f, 0.839071691f, -0.246290341f, 0.0860765204f, 1.78590131f,
+	-0.749589086f, 0.250832409f, -0.650557339f, -0.779697835f, -0.0177482385f, 0.0280929152f, 0.281557590f, -0.707778394f,
+	-0.668158889f, -2.34406567f, -35.4645958f, -24.4139748f, -19.7837887f, -19.6050339f, -17.7511654f, -20.0241375f,
+	0.00104732614f, -0.515227556f, -2.17706728f, -0.194396377f, -1.15575266f, -0.143580198f, -25.3070221f, -16.2513180f,
+	-16.0669289f, -12.8498888f, -11.3679018f, -13.1091728f, -0.000445849262f, 0.000549819029f, 0.0167141762f, -0.0435506180f,
+	-0.0494221002f, -0.0762462616f, -7.65548468f, -2.72510600f, 7.59542799f, 8.08770370f, 7.08709145f, 6.13417530f,
+	6.40872167e-06f, 3.75649652e-05f, 0.000231144979f, 0.000151357512f, 0.000254002749f, 0.000749701692f, -32.1553764f, -23.2376080f,
+	-24.0271301f, -26.4098320f, -25.6661377f, -24.7067585f, 0.0697734803f, 12.3441792f, 1.00832164f, 2.09065127f,
+	4.44682264f, 7.09971046f, -9.49324131f, -6.74422264f, 5.79627705f, -2.78498030f, 2.96549845f, -5.56190634f,
+	0.00369375572f, 0.0724639967f, 0.273725063f, 0.286068648f, 0.447318286f, 1.21804321f, -4.02963305f, -3.36247802f,
+	0.461391658f, -5.43246460f, -3.29980612f, 1.23334110f, 0.00328171044f, -0.0377077721f, -0.0925785601f, 0.476609111f,
+	-0.353270382f, 3.54961014f, -6.09120846f, -11.6193981f, -24.1337395f, 3.03874922f, 3.77243257f, -2.26279306f,
+	-5.64603033e-05f, 0.00276496750f, 0.0100008445f, -0.00882478803f, 0.0242452286f, -0.458140582f, 1.73204958f, 1.96840274f,
+	1.28585625f, 1.27932143f, 1.36941922f, 1.31958222f, 9.92215791e-06f, 0.000221505557f, 0.000955636438f, 0.000638962549f,
+	0.00105994043f, 0.00333782658f, -35.6860390f, -28.8595085f, -25.4416924f, -18.6997795f, -16.3192558f, -20.6403522f,
+	0.000887825328f, 0.00618373416f, 0.0171306934f, 0.0569205172f, 0.0894392878f, 0.0828750283f, -18.5630474f, -19.0755234f,
+	-16.1776123f, -1.47127283f, -1.36314547f, 0.454729766f, 0.0164062306f, -0.240114838f, -1.31046104f, 0.887881041f,
+	0.478550673f, 2.06772375f, -20.4051552f, -10.4086418f, -12.7226801f, -8.15548801f, -8.87448978f, -10.2369814f,
+	0.00719421776f, 0.116939969f, 0.416062295f, 0.502690136f, 0.732668340f, 2.05015111f, -21.3786297f, -13.5546112f,
+	-13.7868319f, -12.9891148f, -11.0575781f, -13.7971516f, -0.000552110490f, -0.0108160404f, -0.0411506929f, -0.0422010757f,
+	-0.0661187544f, 0.818897843f, -5.62762308f, -6.48956680f, -6.32754326f, -4.90717888f, -5.18200350f, -5.10519123f };
+typedef StaticMLP<scatModelParameters, 12,
+	StaticLayer<12, MLPActivation::Softplus>,
+	StaticLayer<12, MLPActivation::Softplus>,
+	StaticLayer<12, MLPActivation::Softplus>,
+	StaticLayer<12, MLPActivation::None>> scatModelStatic;
+
@@ -0,0 +1,216 @@
+// Networks of CVAEScatteringModelX.h compiled for StaticMLP (see CPU/StaticMLP.h).
+
+constexpr float lenModelParameters[] = {
+	0.0122271990f, -0.00101708167f, -0.567415476f, 0.458054245f, 0.452227622f, -1.95851290f, -0.0143996608f, -0.000181068404f,
+	3.79437995f, -0.134266496f, -0.380310684f, 2.77176595f, -0.185353294f, 0.124791600f, 0.410965770f, 9.04845142f,
+	0.211322144f, 0.189186051f, 0.179097787f, 1.13683522f, 0.557630360f, -1.48589540f, -0.593092203f, 0.0869317055f,
+	-2.91357192e-05f, 1.98445323e-05f, 7.04889680e-05f, 8.03430448e-05f, -3.87826185e-06f, 0.000121876605f, -4.64706973e-05f, -9.08664661e-05f,
+	-3.23680758f, 0.409097999f, -0.585904777f, -3.37986493f, 0.351260841f, 1.74073410f, 2.17526031f, -10.2391500f,
+	-1.11869872f, 0.0572388135f, -0.975907922f, -3.72127628f, 0.204749078f, 0.0722579435f, -0.121291168f, 1.95493686f,
+	6.07386971f, -0.0364819616f, -1.01329088f, 14.3453760f, 8.03407478f, 0.490335286f, -0.147057161f, -0.792587757f,
+	-8.06221962f, -0.138622284f, 0.0424991250f, -23.3430767f, 0.880880654f, 0.461012334f, -0.271208614f, -0.945658684f,
+	-0.295830607f, 0.210183039f, 0.0622607321f, -0.902790189f, 0.330369771f, 0.0845065862f, 0.0162301268f, -0.216004550f,
+	0.501701593f, -0.538762629f, 0.00777693605f, 1.60351872f, -0.317992717f, 0.432249993f, -0.0984428003f, 0.694982111f,
+	-5.19487238f, -0.140893966f, -9.41729355f, -14.7805128f, -0.465191483f, -0.127190426f, -0.607262731f, -0.226735458f,
+	-0.962028384f, 0.394850582f, -0.357001662f, -3.17268491f, 1.29282987f, 0.0631322637f, -0.138719603f, 0.117451549f,
+	4.56121492f, -0.107335106f, 8.27682877f, 17.1522999f, -0.427021146f, -0.114836499f, -1.17843044f, -0.0170759987f,
+	2.75974894f, -1.54914141f, 0.183208689f, 6.67704964f, 6.42642307f, 1.69929206f, 0.0225427933f, -4.48297739f,
+	-0.00659786817f, 11.1251059f, 0.389776021f, 0.0649550930f, -1.54450500f, 1.89854455f, 0.167568117f, -3.94241405f,
+	-0.191542551f, -1.29817677f, 0.579242349f, 0.748831630f, -0.252389938f, -16.4172325f, -0.581675351f, -0.0708570331f,
+	1.45567334f, 1.93787408f };
+typedef StaticMLP<lenModelParameters, 4,
+	StaticLayer<8, MLPActivation::Softplus>,
+	StaticLayer<8, MLPActivation::Softplus>,
+	StaticLayer<2, MLPActivation::None>> lenModelStatic;
+
+constexpr float pathModelParameters[] = {
+	-0.0334500968f, -0.00286275870f, -0.0177533273f, -0.0102282353f, -0.000510550686f, -0.00281109638f, 0.000719019503f, -0.0161783416f,
+	-0.0171707515f, -0.00541006727f, -0.00555257127f, 0.00193197792f, 0.00932794344f, -0.00864845980f, 0.0156862326f, 0.00501404656f,
+	-0.128987864f, 0.802810788f, 1.95001900f, 4.70342112f, -2.75910664f, 2.80993271f, -1.41285205f, 0.664805293f,
+	-0.569183350f, -2.38142180f, -2.16222286f, 0.295903951f, 4.00124502f, -1.03686404f, 0.690526724f, 2.35625768f,
+	-24.0893459f, -29.6201515f, 3.21302223f, 1.86515677f, -32.3862686f, 0.360120624f, -0.863313437f, -0.157959700f,
+	2.93830156f, 0.945729494f, 0.967439532f, -25.8146496f, -1.23302925f, 1.58479202f, -1.27683616f, -0.939197540f,
+	-5.49234028e-05f, 6.76445561e-05f, -2.96880953e-05f, -3.48821013e-05f, -0.000206596043f, -0.000271505909f, 9.64638020e-05f, -0.000171959575f,
+	-0.000113484464f, 2.75922521e-05f, -5.12415172e-05f, 7.89011574e-06f, 2.16008539e-05f, 9.47253193e-06f, 5.24265597e-05f, -2.00733339e-05f,
+	0.000217953304f, 8.28687334e-05f, -0.000107126929f, 3.92558786e-06f, -5.33691818e-05f, -5.47014060e-05f, 5.55924344e-05f, 1.95523626e-05f,
+	3.36059711e-05f, -0.000127625317f, 7.70817205e-05f, 5.05811331e-05f, 4.86918680e-06f, -0.000143872283f, 0.000114513437f, -0.000120627818f,
+	0.000170132596f, 1.61280386e-05f, 6.94488626e-05f, -4.31958597e-06f, -5.89663832e-05f, -0.000157249742f, -7.56766240e-05f, 7.21526376e-05f,
+	-0.000114450624f, 0.000109170243f, -2.95601712e-05f, 0.000143555080f, 0.000205203061f, 6.78684664e-05f, 7.85980737e-05f, -6.67584754e-05f,
+	-7.87655808e-05f, -0.000190480569f, 6.13969896e-05f, -0.000162731434f, 7.57511516e-05f, 2.46399068e-05f, 1.06400094e-05f, -6.12040822e-05f,
+	0.000212901126f, 4.18556783e-06f, -0.000127780659f, 0.000106580745f, 5.74579026e-05f, 0.000102616956f, -0.000130776607f, -2.08545280e-05f,
+	-0.0362423398f, 1.38589013f, 0.401687115f, 0.479498625f, -1.09962499f, -0.119389467f, -0.767354250f, -0.0996528193f,
+	0.204514131f, 1.37257946f, -2.15436363f, -0.435581475f, 0.289552569f, 0.978156149f, 0.483701766f, 1.93159926f,
+	-0.822371840f, -0.200106442f, 0.752519965f, -3.65655565f, -0.139705569f, -0.714120150f, 0.246934593f, 0.0208986346f,
+	-3.05314803f, -0.864839613f, -1.67686617f, 0.446596086f, -0.661875129f, 1.81641865f, 0.911353230f, 1.38707387f,
+	-0.883344769f, 0.466615111f, 0.892208159f, -1.30337286f, 0.142565832f, 1.73770285f, 0.903135419f, -1.04671836f,
+	1.11830735f, -1.93710256f, 0.167915791f, -0.240402102f, -1.17445731f, -0.437463015f, 2.46721721f, 0.489853710f,
+	0.228146523f, 0.159615800f, 0.693000257f, 0.0261029880f, -0.617764413f, -0.598072588f, -0.836007297f, -1.55702567f,
+	0.0989969298f, -0.209519044f, -0.601625204f, 0.299434721f, -0.757148504f, -7.84273815f, -0.896601319f, -2.89394879f,
+	0.129418880f, -2.38470864f, -1.41777062f, -1.40722001f, -1.59177947f, 0.0422879420f, 0.215556785f, 0.0445611663f,
+	-0.331113398f, -3.19325328f, -1.93805456f, -0.456485569f, 0.110578001f, -0.231290370f, -2.98997593f, -0.0633188561f,
+	-0.0443758816f, -3.49424601f, -2.61086416f, 0.436794162f, 4.97388792f, 0.112488635f, -0.176093072f, 0.300760031f,
+	0.361567438f, -0.809322834f, -17.9875183f, 0.375722736f, -0.0433641374f, 0.919033587f, -5.65211344f, 0.455281466f,
+	-1.59108591f, 0.117610671f, 0.0110469582f, -2.06945157f, -0.694258213f, -1.89334202f, 0.140411243f, -1.20962059f,
+	0.0117356293f, -11.8617887f, -2.13480926f, 0.517739296f, -0.967477798f, 1.32714212f, -0.487058759f, -0.701306105f,
+	-0.0322561935f, 0.470298678f, -0.566276789f, 0.302126974f, -4.51080465f, -0.0907048136f, -0.295414746f, 1.86268842f,
+	-0.220728114f, 1.03066635f, 0.282591641f, 0.468030930f, 0.0908330753f, 4.11813593f, 0.658923566f, -4.50477409f,
+	1.60853171f, 0.173073739f, -0.0500151664f, 2.41596699f, -0.811640084f, -2.01628590f, 0.258066714f, 0.780956149f,
+	0.327820390f, 0.972160518f, -1.09311736f, -0.260081887f, 0.744859278f, 0.745929241f, -2.33041787f, -1.70997286f,
+	0.511687398f, 0.877052367f, 0.330000103f, 1.74287534f, 0.783576846f, -0.403421074f, 0.620964110f, -1.67458153f,
+	0.462422937f, 0.714959085f, 0.936619759f, -0.991405725f, -0.0873370692f, -5.28739166f, 1.39921081f, 1.40671992f,
+	-0.0836889148f, -2.76559758f, 0.143476292f, 1.31610847f, -2.32948017f, -0.113702923f, -0.0376883671f, -0.105395839f,
+	0.0542058460f, 2.86622190f, -1.32347035f, 0.128630862f, 0.0202309191f, 0.290369838f, -3.59426427f, -0.184349880f,
+	-0.422006249f, 0.560795963f, -1.09583235f, -0.950062215f, 0.125183195f, 0.585117280f, -0.191012233f, -0.297565848f,
+	-0.273527175f, 0.958270431f, 1.16516376f, 0.357363403f, -0.115836933f, -0.115114890f, -2.39718390f, 0.0677641407f,
+	0.530056119f, 0.0571331121f, -0.748173058f, -1.30303001f, -0.433820307f, -0.373404741f, -0.398680210f, -0.565053880f,
+	-0.534101665f, -1.91108799f, -1.52700675f, -0.219988883f, 0.412101626f, -1.71920097f, -0.507824242f, 0.194332853f,
+	0.151762083f, 0.0893529579f, 1.88518000f, -5.58429909f, -0.0337447710f, 1.35407674f, 0.521172047f, -5.12475157f,
+	1.17866349f, 1.27341521f, 0.139419422f, 0.176288813f, -1.29776204f, -1.47801960f, 0.989335656f, 3.14538312f,
+	-1.23395526f, 1.03625262f, 0.142685592f, -1.26235783f, -7.24960804f, 0.306159794f, -0.0242933016f, -1.96346617f,
+	-0.275385141f, 1.64153588f, -2.10750079f, 0.449328870f, -0.794234335f, -2.02446127f, 0.866389096f, 2.04142690f,
+	-0.0960480049f, 0.323939145f, -0.395790726f, 0.536432505f, 0.399759978f, -0.144917756f, 0.262037545f, -0.993495524f,
+	0.0840075016f, 0.538577676f, 0.435587883f, -0.736770809f, -0.399842709f, -2.81825805f, 1.40764987f, -0.396350473f,
+	0.324797899f, 0.0232973993f, -0.0611202531f, -0.487259954f, 0.879912317f, -0.0454244055f, 0.853269696f, 1.12489939f,
+	0.705069780f, 0.904078007f, -0.705243289f, -1.25853884f, 0.0256868582f, -0.202983528f, 1.11557305f, -1.94360852f,
+	-0.750630736f, -1.08896697f, -0.163902372f, 0.312213123f, -0.158740148f, 0.401601166f, 0.535307407f, 0.599169254f,
+	-0.386346370f, -0.992347598f, -1.05639613f, 0.723649681f, -0.131320268f, 1.68635190f, 0.615203798f, -0.0352991931f,
+	1.13996339f, 0.0974621251f, 0.405160040f, -0.721707344f, 0.574405789f, -1.15028811f, 1.25451636f, -0.0140099218f,
+	0.448581308f, 0.0849815682f, 0.0842975155f, -0.736187458f, -0.598075926f, 0.217597783f, 0.770457685f, 1.74956083f,
+	0.366243154f, -0.0918866172f, 0.354480803f, -0.413244635f, -0.458971798f, -0.934199274f, -0.432029039f, -0.373846203f,
+	-0.498109221f, -0.458473116f, -0.458672553f, -0.124994628f, -0.0812069178f, -0.389550507f, -1.61765742f, 0.444608480f,
+	-0.541050315f, -1.55770707f, -0.487201124f, -1.16804790f, -0.955424666f, 0.305825114f, -0.360322237f, 1.25189817f,
+	-1.11240876f, 1.05090082f, -0.727704763f, 0.169291362f, -0.0919469073f, -1.35043442f, -3.15794659f, -0.426780939f,
+	-1.50336957f, -2.29289746f, -1.20254612f, -0.764365792f, -0.0530789606f, 1.47356439f, -5.87861490f, -8.08946609f,
+	-0.742685735f, -2.84131408f, -1.30430996f, 0.771211207f, -0.314425468f, -1.62016678f, 0.789533436f, -1.07242477f,
+	0.472532630f, 5.16421700f, 0.918573141f, -1.42477643f, 1.65470076f, -0.431070626f, 3.13104534f, 1.59329653f,
+	4.28457451f, 0.776379228f, 2.41142344f, -0.0919266716f, 0.286670148f, -0.202775910f, 1.86251998f, 1.46541440f,
+	3.43095303f, -1.32272732f, -5.61910343f, -0.856091261f, 0.752782643f, -0.663097441f, -2.02576399f, -6.27030945f,
+	-0.769216239f, -2.08996582f, 0.925675631f, -0.805306554f, 0.509589732f, -0.0976879001f, -0.795055807f, -1.44174898f,
+	-0.676246524f, -0.0945185125f, -1.49773002f, -0.447602600f, -0.121379010f, 0.521156609f, 0.399028033f, 0.206220791f,
+	-0.412772506f, 0.438936591f, -1.64273965f, -0.125629261f, -1.87622452f, 0.000110589368f, 0.0929637924f, -0.535299897f,
+	-0.877573967f, -0.700683057f, -0.327938437f, -0.374139309f, -0.250022620f, -0.418490291f, -0.332632661f, -0.253139853f,
+	-0.263603657f, -0.402499139f, -0.834916472f, -0.361196488f, -0.449038029f, 0.00576856686f, -0.451657981f, -0.960678518f,
+	-0.382809520f, 1.22233534f, 0.441781700f, 1.80586362f, -0.289502293f, 0.211857617f, 0.256801844f, 0.115881480f,
+	-1.08019495f, 0.0234186109f, 1.46437562f, -0.390161753f, 0.266388059f, -0.0166815110f, 0.442017853f, 0.676312566f,
+	-1.85899544f, -2.89781380f, -0.331973910f, -0.952208042f, -0.151228994f, -0.114214502f, -2.00024748f, -0.472866118f,
+	-0.816722572f, 0.0316297598f, -0.369383216f, -0.644034028f, 0.486665398f, 0.0120631056f, -0.644252479f, 0.309790194f,
+	0.366591871f, -3.72023559f, -6.79925060f, -1.28324819f, -0.203504592f, -1.88906133f, 1.43483758f, -0.835047543f,
+	-1.17120218f, -1.38154256f, -0.0462151021f, -0.873344421f, -2.11381984f, -0.000758686394f, -1.04390049f, 0.476537138f,
+	0.159865394f, 1.69117296f, -5.98607254f, 0.0366004258f, 0.144839704f, 4.70260477f, -1.44361329f, 3.32336736f,
+	0.281395853f, 5.41182518f, -0.300922781f, -0.0283435546f, 2.62017155f, 0.0178205092f, -2.79234576f, -5.79086828f,
+	-1.57777846f, -2.50522137f, -1.23860252f, -0.644799709f, -0.794592738f, 0.127489582f, -0.878518462f, -0.579022169f,
+	-0.602478147f, 1.16931212f, 0.0710834637f, -0.529517293f, -1.12305796f, -0.0121004144f, 0.307063758f, -0.573415458f,
+	-0.217634276f, -0.790479660f, -0.444139898f, -0.140077636f, -0.253972799f, 1.17821443f, 0.415507048f, 0.733008027f,
+	-0.890187442f, 0.532713830f, -1.91351748f, 0.157613486f, -1.09987521f, -1.15190601f, 2.47636271f, -0.951446235f,
+	-54.0859795f, -0.296641588f, -7.84746075f, -2.39991474f, -0.418898135f, -3.26840711f, 2.72894955f, -1.38129294f,
+	-0.513417482f, -3.08575416f, -2.07756782f, -1.19177783f, -2.88663721f, 0.0273891222f, -3.45444369f, 0.200499639f,
+	1.15244627f, -0.0589164868f, -1.82607281f, -0.140525714f, 0.109137490f, -0.0853399858f, -0.493546963f, -25.3794346f,
+	-0.136682972f, -9.23851299f, -0.0506923012f, -0.253862560f, -0.160589278f, -0.0284780655f, -0.463180721f, 0.285751402f,
+	-3.10305381f, 3.42488241f, -1.79885125f, -1.45004022f, 0.511287570f, 0.957157135f, 2.10564256f, 0.645130754f,
+	-1.44868803f, 0.986387610f, -1.19643128f, -0.331827372f, 0.115184389f, -0.0273971315f, 3.70568895f, -3.07420850f,
+	-0.0506304167f, -0.364924580f, -0.0992286429f, -0.0342025273f, -0.0608059280f, 0.0778355449f, -1.23513091f, 3.68074489f,
+	-0.529648364f, -0.590052366f, 0.0767959878f, -0.712965548f, -0.595342994f, -0.290003330f, -0.696397543f, -0.166572690f,
+	0.396408349f, 0.00614115503f, 6.76221171e-05f, -3.89508748f, -5.62983131f, -5.73032808f, 1.07004297f, -1.44601357f,
+	-0.00929420814f, 8.92173386f, 5.14474964f, 4.87841368f, -1.13162851f, 0.00771656400f, 0.000181967684f, -2.01586318f,
+	0.795383692f, 1.65337694f, 0.0501857661f, 0.960595906f, 0.00293876440f, -0.241121292f, -3.56007242f, 0.0721174479f,
+	0.466242313f, -0.00169788371f, -3.66626796e-06f, 30.4101944f, -4.32050514f, -19.7435894f, -0.00892892387f, -0.000370123424f,
+	-5.37269125e-06f, -6.47743750f, 0.470299929f, -16.4941044f, -0.0137425838f, 0.00357485586f, 0.000140499222f, -13.9882269f,
+	-4.91090727f, -2.24760985f, 0.000687821012f, -1.32565847e-05f, -3.15596139e-06f, 2.10450721f, 9.12450123f, 8.81188583f,
+	1.03723395f, -0.672154665f, -0.00196310133f, -9.79918480f, 2.14868474f, 16.4245644f, -0.00881353952f, 0.000220377202f,
+	5.26742770e-06f, -24.5172539f, -34.9107590f, 5.90706158f, 8.39032269f, 0.00419548387f, -0.000149052314f, -8.07962608f,
+	4.02603579f, -6.84612226f, -3.27659392f, -0.00987483561f, -0.000127363935f, -3.54577971f, -5.15902138f, -12.4126320f,
+	-5.36717892f, 0.00103858788f, 1.23097934e-05f, 3.16331077f, -31.4535999f, -41.1961021f, 1.42798090f, 0.000609481591f,
+	1.47048445e-06f, -8.86845016f, -9.10855579f, -9.49760532f, 0.848826826f, 0.000536759675f, 1.51298163e-05f, 17.7691841f,
+	-23.2942352f, -11.7640219f, 0.745326102f, -0.00925849937f, -0.000113818634f, 2.69555163f, -14.9565039f, -20.7662640f,
+	0.166733801f, 0.000178969742f, 2.63251627e-06f, -9.87297249f, -14.4783192f, -13.2357283f };
+typedef StaticMLP<pathModelParameters, 8,
+	StaticLayer<16, MLPActivation::Softplus>,
+	StaticLayer<16, MLPActivation::Softplus>,
+	StaticLayer<16, MLPActivation::Softplus>,
+	StaticLayer<6, MLPActivation::None>> pathModelStatic;
+
+constexpr float scatModelParameters[] = {
+	-0.00526846712f, -0.0129617974f, -0.00824313890f, 0.00247066980f, -0.00768661778f, 0.00399318105f, -0.00212620106f, -0.00884791277f,
+	-0.346721798f, -0.0942756683f, -0.00839700457f, -0.00530735636f, 0.487005889f, -0.0580649488f, -0.190448314f, 0.0258789212f,
+	-0.341444939f, -0.0466281213f, 0.321790844f, 0.332117796f, -1.59055996f, -0.346924394f, 0.0917955264f, 0.208001420f,
+	2.26848936f, -8.63055801f, 0.594901741f, 0.258368939f, -1.34381318f, 0.294728488f, -1.62458217f, -3.16777658f,
+	-1.31350815f, -1.95902050f, 0.0351144895f, -6.19587135f, 0.667516649f, 1.18969977f, -0.326483101f, 0.0150448000f,
+	0.273841739f, 0.0981387198f, 0.0396888256f, -0.153983682f, -0.207629398f, 0.471163779f, 0.358704776f, 0.420112222f,
+	-0.122258008f, -0.163869873f, 0.0625512302f, -0.0221974608f, -0.0971920937f, -0.0558724068f, 0.0284286309f, -0.266017795f,
+	-0.194723248f, -0.104469240f, -0.0731906891f, 0.00624835771f, -0.0106461933f, -0.105892099f, 0.117958754f, 0.0282806251f,
+	-0.114793576f, 0.0238707848f, 0.0192184281f, -0.0785425380f, -0.449750751f, -0.00125340710f, -0.0738460645f, -0.0324144326f,
+	0.0413880199f, 0.135810137f, 0.0396432616f, 0.0292695276f, -0.0343854576f, 0.0287558008f, 0.0237028692f, -0.0132237105f,
+	0.0266847704f, 0.0366378501f, -0.0333920494f, 0.0523861274f, -0.00441805972f, -0.0134784682f, 0.00453467201f, 0.00658465549f,
+	0.00521804951f, 0.00772804581f, -0.00215894030f, 0.0226602983f, 0.0464243777f, -0.0297630616f, -0.0128785670f, -0.00534511777f,
+	-0.00641656108f, -0.00480430853f, -0.00142219535f, 0.00611589896f, 0.0191851854f, 0.00590199465f, -0.00385795417f, 0.0157113131f,
+	0.0552451685f, -0.0333562195f, -0.00980832893f, -0.00136383227f, -0.00556037715f, -0.0167298242f, -0.00512155565f, 0.0120946597f,
+	0.0219701361f, 0.0101357205f, -0.00239221333f, 0.0321174152f, 0.0654105619f, -0.0501799844f, -0.0204620361f, -0.00723025994f,
+	0.00662960624f, 0.0154490741f, -0.00113238208f, -0.0118115339f, -0.0184425097f, -0.00985561218f, 0.00249478384f, -0.0371120349f,
+	-0.0794114321f, 0.0626171529f, 0.0203870274f, 0.00729194563f, 0.489711106f, 4.42519855f, -0.00221681828f, 0.122793585f,
+	0.519192755f, 0.375822395f, 0.0669604093f, 3.06325293f, 1.21586037f, 1.40056443f, 0.274699241f, 1.67231905f,
+	-0.652938247f, 3.60210633f, -0.769537151f, 0.415231973f, -0.718998730f, -1.45378244f, 0.515402138f, 0.816285968f,
+	-0.920693755f, -1.90514612f, 0.0674155578f, 1.68081725f, 0.0332535543f, 0.251479894f, -0.474890023f, 0.177096754f,
+	-0.0998294950f, 0.219039932f, 0.249667570f, -0.199414164f, 0.315729976f, -0.0582872927f, -0.0313897617f, -0.483335346f,
+	-0.934543550f, -4.92812967f, 1.64552581f, 1.80862522f, -3.05846739f, 0.443802446f, -4.57395029f, -3.89926457f,
+	1.06786609f, 2.90366411f, -1.13833034f, -0.504670322f, -0.0252823345f, 1.74277532f, -0.695585847f, -0.700899720f,
+	0.546403646f, 0.970547318f, 1.72161150f, -1.30061293f, 0.275744528f, 0.00817191601f, 0.312303066f, -3.53535843f,
+	0.418522060f, -0.0678682104f, 0.269345880f, -0.714697838f, 0.789694011f, -0.840320528f, 1.17738867f, -0.511844397f,
+	0.433351219f, 0.280561239f, -0.195159256f, -1.39636266f, 0.412184179f, 2.32915783f, -1.14407730f, 0.248256341f,
+	-0.00672045210f, 0.971287251f, 1.94753301f, -1.85716212f, 0.524099946f, -0.238146111f, -0.405687839f, -3.50775766f,
+	-0.247953862f, 1.61545587f, -0.157395706f, 0.211394668f, 0.315050930f, 0.672270656f, 0.603100359f, -1.97171140f,
+	0.898409843f, 0.239341155f, 0.783032775f, -3.34015536f, -0.0179767050f, 1.84969831f, -0.346195549f, -0.636496961f,
+	0.107970715f, 0.873605669f, 0.706953645f, -0.585647523f, 0.0752016157f, 0.190039739f, 0.240319327f, -2.05282283f,
+	-0.329398036f, 1.00290608f, 0.756201565f, 0.0242304765f, 1.48662555f, -0.866884947f, 1.57705963f, -1.99141002f,
+	-0.570597708f, 3.03229976f, 0.489333391f, -0.539859176f, 0.147579655f, 1.10833073f, -1.32752860f, -0.628769159f,
+	-0.112391137f, 0.298429161f, 0.694448769f, 0.959872723f, 0.0562870912f, 0.327144206f, 0.191922411f, 0.448152989f,
+	-0.0768906325f, -0.130662426f, -0.411700994f, -0.353207529f, -0.876897275f, 0.252678394f, -0.576100290f, 1.30691397f,
+	0.0241958424f, 0.705516756f, 0.389004678f, 0.611183226f, 0.119229428f, 0.149642915f, 0.614604473f, -0.293476224f,
+	0.224824935f, -0.336887717f, 0.305355042f, -0.233076349f, 0.510500431f, 0.250261396f, 0.258204758f, -0.330936790f,
+	0.867535353f, 1.19246089f, 0.823262095f, -1.15613806f, 0.00583572220f, -1.71695662f, 0.960226715f, -3.44722867f,
+	-0.567229211f, 0.432654530f, 0.312221617f, -1.30575097f, 0.953918338f, -0.218180984f, 0.152883276f, -0.577486634f,
+	0.722985327f, -1.06199777f, -0.519487917f, 1.47296739f, 0.623620391f, 0.797460020f, 1.10158670f, 1.63050592f,
+	-0.448417962f, -1.06132269f, -0.328256935f, -0.444679379f, -8.58101940f, -0.664306939f, -0.567627013f, -1.47803748f,
+	0.0165555403f, -0.296430081f, -0.780851305f, -1.01237202f, 0.188502237f, -0.456076443f, -0.0448729917f, 0.384267956f,
+	4.11212492f, 0.0928114131f, -0.692574680f, 0.0228136666f, -0.328817368f, -0.513600171f, 0.258164108f, 0.0698201880f,
+	-1.20747590f, -0.667836130f, 0.122953430f, -0.887895107f, 0.164840862f, 0.112639859f, -0.358944774f, -0.0834723040f,
+	-2.31267691f, -0.912605941f, -0.244271591f, -1.23639059f, 0.126611203f, -2.06674647f, 0.00271197897f, 0.602393627f,
+	1.22645128f, -0.187656701f, 1.06348693f, 0.0312191136f, 2.54326344f, 2.11544824f, -2.38610911f, -1.55585575f,
+	-0.327747583f, -0.00557363313f, -0.259294719f, -0.660213351f, -5.08084345f, -0.231781214f, -1.80030572f, -0.235726610f,
+	0.183608115f, -0.992215276f, -0.517225444f, 0.109304950f, -0.542734087f, -0.131438047f, -0.154105633f, 0.717055559f,
+	-3.02595353f, -0.702100515f, -2.51294494f, 0.100019626f, -0.603398740f, -2.08314490f, -0.707743824f, -1.16006196f,
+	0.377231508f, -0.408196181f, -0.627496541f, 2.99331331f, -2.10808349f, 0.0865924656f, -0.586099267f, -1.32453740f,
+	1.17783916f, -0.128702253f, -0.375403792f, 0.118061490f, -2.05362749f, -4.39982796f, -1.52482653f, 0.259632528f,
+	-10.5787048f, 0.117983490f, -1.76598024f, -3.59930158f, -0.607119024f, -1.08738112f, -1.64130473f, -1.41051292f,
+	-1.10606551f, -0.0256623495f, -0.0433693305f, -1.79937863f, -1.16787899f, 0.0495977141f, 0.297877043f, -0.00861757062f,
+	-0.00773577252f, -0.115812615f, -0.514395356f, -0.337837249f, -0.930604935f, -0.220079944f, -0.0797376558f, -1.04514229f,
+	-0.237002924f, -0.0612461530f, -0.451947957f, 0.0460759699f, -0.865176439f, -0.419907928f, -0.515726566f, -0.646173418f,
+	-0.671865463f, -0.731118441f, 0.507860601f, -0.751554906f, 4.66121817f, -0.181633338f, -0.250564963f, 0.0157229844f,
+	-0.928482533f, 0.397671312f, -0.425195158f, -0.0888710544f, -6.40136337f, -2.53606653f, -0.378820926f, -2.92578578f,
+	2.08507967f, -0.955226183f, -4.05475807f, -2.92267084f, -4.21481705f, -7.36605358f, -1.11865723f, -2.99780607f,
+	-0.397050709f, -0.607502580f, -0.583310664f, -0.169501767f, 0.839071691f, -0.246290341f, 0.0860765204f, 1.78590131f,
+	-0.749589086f, 0.250832409f, -0.650557339f, -0.779697835f, -0.0177482385f, 0.0280929152f, 0.281557590f, -0.707778394f,
+	-0.668158889f, -2.34406567f, -35.4645958f, -24.4139748f, -19.7837887f, -19.6050339f, -17.7511654f, -20.0241375f,
+	0.00104732614f, -0.515227556f, -2.17706728f, -0.194396377f, -1.15575266f, -0.143580198f, -25.3070221f, -16.2513180f,
+	-16.0669289f, -12.8498888f, -11.3679018f, -13.1091728f, -0.000445849262f, 0.000549819029f, 0.0167141762f, -0.0435506180f,
+	-0.0494221002f, -0.0762462616f, -7.65548468f, -2.72510600f, 7.59542799f, 8.08770370f, 7.08709145f, 6.13417530f,
+	6.40872167e-06f, 3.75649652e-05f, 0.000231144979f, 0.000151357512f, 0.000254002749f, 0.000749701692f, -32.1553764f, -23.2376080f,
+	-24.0271301f, -26.4098320f, -25.6661377f, -24.7067585f, 0.0697734803f, 12.3441792f, 1.00832164f, 2.09065127f,
+	4.44682264f, 7.09971046f, -9.49324131f, -6.74422264f, 5.79627705f, -2.78498030f, 2.96549845f, -5.56190634f,
+	0.00369375572f, 0.0724639967f, 0.273725063f, 0.286068648f, 0.447318286f, 1.21804321f, -4.02963305f, -3.36247802f,
+	0.461391658f, -5.43246460f, -3.29980612f, 1.23334110f, 0.00328171044f, -0.0377077721f, -0.0925785601f, 0.476609111f,
+	-0.353270382f, 3.54961014f, -6.09120846f, -11.6193981f, -24.1337395f, 3.03874922f, 3.77243257f, -2.26279306f,
+	-5.64603033e-05f, 0.00276496750f, 0.0100008445f, -0.00882478803f, 0.0242452286f, -0.458140582f, 1.73204958f, 1.96840274f,
+	1.28585625f, 1.27932143f, 1.36941922f, 1.31958222f, 9.92215791e-06f, 0.000221505557f, 0.000955636438f, 0.000638962549f,
+	0.00105994043f, 0.00333782658f, -35.6860390f, -28.8595085f, -25.4416924f, -18.6997795f, -16.3192558f, -20.6403522f,
+	0.000887825328f, 0.00618373416f, 0.0171306934f, 0.0569205172f, 0.0894392878f, 0.0828750283f, -18.5630474f, -19.0755234f,
+	-16.1776123f, -1.47127283f, -1.36314547f, 0.454729766f, 0.0164062306f, -0.240114838f, -1.31046104f, 0.887881041f,
+	0.478550673f, 2.06772375f, -20.4051552f, -10.4086418f, -12.7226801f, -8.15548801f, -8.87448978f, -10.2369814f,
+	0.00719421776f, 0.116939969f, 0.416062295f, 0.502690136f, 0.732668340f, 2.05015111f, -21.3786297f, -13.5546112f,
+	-13.7868319f, -12.9891148f, -11.0575781f, -13.7971516f, -0.000552110490f, -0.0108160404f, -0.0411506929f, -0.0422010757f,
+	-0.0661187544f, 0.818897843f, -5.62762308f, -6.48956680f, -6.32754326f, -4.90717888f, -5.18200350f, -5.10519123f };
+typedef StaticMLP<scatModelParameters, 12,
+	StaticLayer<12, MLPActivation::Softplus>,
+	StaticLayer<12, MLPActivation::Softplus>,
+	StaticLayer<12, MLPActivation::Softplus>,
+	StaticLayer<12, MLPActivation::None>> scatModelStatic;
+
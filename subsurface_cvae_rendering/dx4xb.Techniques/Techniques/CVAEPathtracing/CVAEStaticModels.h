@@ -0,0 +1,37 @@
+#pragma once
+
+#include "../CPU/StaticMLP.h"
+
+// Baked networks compiled for StaticMLP (sizes of CVAEScatteringModel.h and CVAEScatteringModelX.h).
+namespace StaticCVAEModels {
+	namespace Base {
+#include "CVAEScatteringModelStatic.h"
+	}
+	namespace Extended {
+#include "CVAEScatteringModelXStatic.h"
+	}
+}
+
+struct StaticCVAEModelsBenchmark {
+	StaticMLPBenchmark Len;
+	StaticMLPBenchmark Path;
+	StaticMLPBenchmark Scat;
+};
+
+/// Compares the static networks of CVAEScatteringModel.h (or CVAEScatteringModelX.h if extended) with the runtime engine.
+inline StaticCVAEModelsBenchmark BenchmarkStaticCVAEModels(bool extended, int batchSize = 1024, int samples = 1 << 18, unsigned int seed = 0) {
+	StaticCVAEModelsBenchmark result;
+	if (extended)
+	{
+		result.Len = BenchmarkStaticMLP<StaticCVAEModels::Extended::lenModelStatic>(batchSize, samples, seed);
+		result.Path = BenchmarkStaticMLP<StaticCVAEModels::Extended::pathModelStatic>(batchSize, samples, seed);
+		result.Scat = BenchmarkStaticMLP<StaticCVAEModels::Extended::scatModelStatic>(batchSize, samples, seed);
+	}
+	else
+	{
+		result.Len = BenchmarkStaticMLP<StaticCVAEModels::Base::lenModelStatic>(batchSize, samples, seed);
+		result.Path = BenchmarkStaticMLP<StaticCVAEModels::Base::pathModelStatic>(batchSize, samples, seed);
+		result.Scat = BenchmarkStaticMLP<StaticCVAEModels::Base::scatModelStatic>(batchSize, samples, seed);
+	}
+	return result;
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "SphereTracingBase.h"
+#include "CVAEModels.h"
+
+/// Base of the pathtracers sampling the subsurface scattering with the CVAE networks.
+/// With USE_CVAE_MODEL_BUFFER the networks are read from CVAE_MODEL_FILE (or from the model file of the baked shader if missing)
+/// and uploaded to a buffer (space 2) used by CVAEModelBuffer_RT.h. The file is watched and a new model is uploaded between
+/// frames, so a frame always uses a single model, and the accumulation restarts.
+struct CVAETechniqueBase : public SphereTracingBase {
+
+	struct CVAEPipeline : public STPathtracingPipeline {
+
+		struct Program : public STPathtracingPipeline::Program {
+
+			void Bindings(gObj<RaytracingBinder> binder) {
+
+				STPathtracingPipeline::Program::Bindings(binder);
+
+#ifdef USE_CVAE_MODEL_BUFFER
+				binder->Space(2);
+				binder->SRV(0, Context().Dynamic_Cast<CVAEPipeline>()->ModelImage);
+#endif
+			}
+		};
+
+		virtual void CreateProgram(gObj<ProgramBase>& program) {
+			program = new Program();
+		}
+
+		// Image of the networks
+		gObj<Buffer> ModelImage;
+	};
+
+	// Model file written by compiling2Binary.py with the networks of the baked shader, used when there is no CVAE_MODEL_FILE.
+	virtual const char* BakedModelFile() {
+		return ".\\Techniques\\CVAEPathtracing\\CVAEScatteringModelX.bin";
+	}
+
+#ifdef USE_CVAE_MODEL_BUFFER
+
+	FileWatcher modelWatcher;
+	float* modelImage = nullptr;
+	int modelCapacity = 0;
+
+	~CVAETechniqueBase() {
+		delete[] modelImage;
+	}
+
+	// Writes the image of the networks in the buffer, growing it if necessary.
+	void PrepareModel(const CVAEModels& models) {
+		auto pipeline = this->pipeline.Dynamic_Cast<CVAEPipeline>();
+
+		int words = models.ImageSize();
+		if (words > modelCapacity)
+		{
+			delete[] modelImage;
+			modelImage = new float[words];
+			modelCapacity = words;
+			pipeline->ModelImage = CreateBufferSRV<float>(words);
+			pipeline->ModelImage->SetDebugName(L"CVAE Model Image");
+		}
+		models.WriteImage(modelImage);
+		pipeline->ModelImage->Write(modelImage);
+	}
+
+	// Loads the model file if it changed. Returns true if a new model was prepared.
+	// A file that can not be read or does not fit the shader evaluator (e.g. a newer version, no scattering network
+	// or layers wider than CVAE_BUFFER_MAX_WIDTH) keeps the current model. Its version is accepted anyway,
+	// so it is not read again every frame until it is written again.
+	bool ReloadModel() {
+		if (!modelWatcher.Changed())
+			return false;
+		modelWatcher.Accept();
+		CVAEModels models;
+		if (!models.Load(CVAE_MODEL_FILE) || !models.FitsModelBuffer())
+			return false;
+		PrepareModel(models);
+		return true;
+	}
+
+	virtual void OnLoad() override {
+
+		SphereTracingBase::OnLoad();
+
+		modelWatcher.Watch(CVAE_MODEL_FILE);
+		if (!ReloadModel())
+		{
+			CVAEModels models;
+			if (!models.Load(BakedModelFile()) || !models.FitsModelBuffer())
+				throw Exception::FromError(Errors::ShaderNotFound, "The model file of the baked CVAE networks can not be loaded for the model buffer.");
+			PrepareModel(models);
+		}
+
+		Execute_OnGPU(UploadModel);
+	}
+
+	virtual void OnDispatch() override {
+
+		if (ReloadModel())
+		{
+			Execute_OnGPU(UploadModel);
+			pipeline->AccumulativeInfo.Pass = 0; // restart accumulation with the new model
+		}
+
+		SphereTracingBase::OnDispatch();
+	}
+
+	void UploadModel(gObj<GraphicsManager> manager) {
+		manager->ToGPU(this->pipeline.Dynamic_Cast<CVAEPipeline>()->ModelImage);
+	}
+
+#endif
+};
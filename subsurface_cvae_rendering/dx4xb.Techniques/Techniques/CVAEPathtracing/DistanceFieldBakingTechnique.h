@@ -0,0 +1,18 @@
+#pragma once
+
+#include "CVAEPathtracingTechnique.h"
+
+// Bakes the distance fields of every geometry of the scene into the cache.
+// Use it as the technique for a scene once (e.g. before shipping a cache folder to other machines),
+// fields are always rebuilt and overwritten. After baking, the scene is rendered with CVAE pathtracing.
+class DistanceFieldBakingTechnique : public CVAEPathtracingTechnique {
+
+public:
+	~DistanceFieldBakingTechnique() {}
+
+	DistanceFieldBakingTechnique(const char* cacheFolder = "DFCache") {
+		dfCache.SetFolder(cacheFolder);
+		UseDistanceFieldCache = true;
+		ForceDistanceFieldRebuild = true;
+	}
+};
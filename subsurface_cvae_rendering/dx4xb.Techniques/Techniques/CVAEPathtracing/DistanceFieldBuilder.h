@@ -0,0 +1,839 @@
+#pragma once
+
+#include "dx4xb_math.h"
+#include "../CPU/Distances.h"
+#include "../CPU/Stopwatch.h"
+#include "DistanceFieldPyramid.h"
+
+using namespace dx4xb;
+
+#define DF_BUILDER_MAX_LEVELS 16
+
+// Work done by an incremental update of a distance field.
+struct DistanceFieldUpdateStatistics {
+	int ChangedTriangles;
+	// Cells touched by the old or new triangles (and their adjacent cells) where the initial distance was recomputed.
+	long long RecomputedCells;
+	// Cells outside the edit whose distance reached the new triangles and was reduced.
+	long long ClampedCells;
+	// Cells of the propagation band where distances were spread again.
+	long long SpreadCells;
+	// False if some changed triangle left the grid (the field must be built again with a new grid transform).
+	bool InsideGrid;
+	float Milliseconds;
+	// Range of the recomputed cells (empty if nothing changed).
+	int3 RecomputedLo = int3(0, 0, 0);
+	int3 RecomputedHi = int3(-1, -1, -1);
+};
+
+/// CPU version of the distance field construction (TriangleGrid, DistanceFieldInitial and DistanceFieldSpread shaders).
+/// A full build produces the same values as the GPU. The triangle lists of the cells are kept after building,
+/// so a deforming geometry can update only the triangles that changed:
+/// - the initial distances are recomputed in the cells touched by the old and new triangles (and their adjacent cells),
+/// - any other cell whose expanded box reaches the new triangles is clamped to its box distance to them,
+/// - distances are spread again only in a band of cells around the edit, the rest of the field is kept.
+/// Every step keeps the field conservative, so the updated field is valid but can be smaller than a full rebuild
+/// (far from the edit, space freed by the removed triangles is not reclaimed).
+/// The cost is proportional to the edit (and the cells whose safe region reached it) instead of the grid volume.
+class DistanceFieldBuilder {
+	// Triangles in grid space, 3 vertices per triangle.
+	float3* triangles = nullptr;
+	int* indices = nullptr;
+	int triangleCount = 0;
+
+	// Per cell head of the linked list of triangles intersecting the cell (-1 if empty).
+	int* head = nullptr;
+	// Linked list nodes (triangle and next node). Removed nodes are linked in a free list.
+	list<int> nodeTriangle;
+	list<int> nodeNext;
+	int freeNode = -1;
+
+	// Max-pyramid over the field (level k block covers 2^k x 2^k x 2^k cells, level 0 is the field),
+	// used to find the cells whose safe region can reach an edit without visiting the whole grid.
+	int maxLevels = 0;
+	int maxSizes[DF_BUILDER_MAX_LEVELS][3];
+	float* maxData[DF_BUILDER_MAX_LEVELS] = {};
+
+	void Release() {
+		if (triangles) delete[] triangles;
+		if (indices) delete[] indices;
+		if (head) delete[] head;
+		if (Field) delete[] Field;
+		for (int k = 0; k < DF_BUILDER_MAX_LEVELS; k++)
+			if (maxData[k])
+			{
+				delete[] maxData[k];
+				maxData[k] = nullptr;
+			}
+		triangles = nullptr;
+		indices = nullptr;
+		head = nullptr;
+		Field = nullptr;
+		nodeTriangle.reset();
+		nodeNext.reset();
+		freeNode = -1;
+	}
+
+	inline long long CellIndex(int x, int y, int z) const {
+		return x + (long long)Size.x * (y + (long long)Size.y * z);
+	}
+
+	inline float3 ToGrid(float3 P) const {
+		return mul(float4(P.x, P.y, P.z, 1), FromGeometryToGrid).get_xyz();
+	}
+
+	void SetTriangle(int t, const float3* positions) {
+		for (int v = 0; v < 3; v++)
+			triangles[t * 3 + v] = ToGrid(positions[indices[t * 3 + v]]);
+	}
+
+	bool TriangleInsideGrid(int t) const {
+		for (int v = 0; v < 3; v++)
+		{
+			float3 P = triangles[t * 3 + v];
+			if (P.x < 0 || P.y < 0 || P.z < 0 || P.x > Size.x || P.y > Size.y || P.z > Size.z)
+				return false;
+		}
+		return true;
+	}
+
+	// Range of cells covering the triangle (clamped to the grid).
+	void TriangleCells(int t, int3& minCell, int3& maxCell) const {
+		float3 c1 = triangles[t * 3 + 0], c2 = triangles[t * 3 + 1], c3 = triangles[t * 3 + 2];
+		float3 maxP = maxf(c1, maxf(c2, c3));
+		float3 minP = minf(c1, minf(c2, c3));
+		minCell = int3(
+			max(0, min(Size.x - 1, (int)minP.x)),
+			max(0, min(Size.y - 1, (int)minP.y)),
+			max(0, min(Size.z - 1, (int)minP.z)));
+		maxCell = int3(
+			max(0, min(Size.x - 1, (int)maxP.x)),
+			max(0, min(Size.y - 1, (int)maxP.y)),
+			max(0, min(Size.z - 1, (int)maxP.z)));
+	}
+
+	// Adds the triangle to the lists of all cells intersecting its plane (same test as TriangleGrid_CS).
+	void Insert(int t) {
+		float3 c1 = triangles[t * 3 + 0], c2 = triangles[t * 3 + 1], c3 = triangles[t * 3 + 2];
+		float3 N = cross(c3 - c1, c2 - c1);
+		int3 minCell = int3(0, 0, 0), maxCell = int3(0, 0, 0);
+		TriangleCells(t, minCell, maxCell);
+
+		for (int cz = minCell.z; cz <= maxCell.z; cz++)
+			for (int cy = minCell.y; cy <= maxCell.y; cy++)
+				for (int cx = minCell.x; cx <= maxCell.x; cx++)
+				{
+					bool anyPositive = false, anyNegative = false;
+					for (int corner = 0; corner < 8; corner++)
+					{
+						float eval = dot(float3((float)(cx + (corner & 1)), (float)(cy + ((corner >> 1) & 1)), (float)(cz + (corner >> 2))) - c1, N);
+						anyPositive |= eval > 0;
+						anyNegative |= eval < 0;
+					}
+					if (!anyPositive || !anyNegative)
+						continue;
+
+					int node;
+					if (freeNode != -1)
+					{
+						node = freeNode;
+						freeNode = nodeNext[node];
+						nodeTriangle[node] = t;
+					}
+					else
+					{
+						node = nodeTriangle.add(t);
+						nodeNext.add(-1);
+					}
+					long long cell = CellIndex(cx, cy, cz);
+					nodeNext[node] = head[cell];
+					head[cell] = node;
+				}
+	}
+
+	// Removes the triangle from the lists of the cells covering its current position.
+	void Remove(int t) {
+		int3 minCell = int3(0, 0, 0), maxCell = int3(0, 0, 0);
+		TriangleCells(t, minCell, maxCell);
+
+		for (int cz = minCell.z; cz <= maxCell.z; cz++)
+			for (int cy = minCell.y; cy <= maxCell.y; cy++)
+				for (int cx = minCell.x; cx <= maxCell.x; cx++)
+				{
+					int* link = &head[CellIndex(cx, cy, cz)];
+					while (*link != -1)
+					{
+						int node = *link;
+						if (nodeTriangle[node] == t)
+						{
+							*link = nodeNext[node];
+							nodeNext[node] = freeNode;
+							freeNode = node;
+						}
+						else
+							link = &nodeNext[node];
+					}
+				}
+	}
+
+	// Same as DistanceFieldInitial_CS for a cell.
+	float InitialDistance(int3 currentCell) const {
+		if (head[CellIndex(currentCell.x, currentCell.y, currentCell.z)] != -1) // not empty cell
+			return -1;
+
+		float3 corners[2][2][2];
+		for (int cz = 0; cz < 2; cz++)
+			for (int cy = 0; cy < 2; cy++)
+				for (int cx = 0; cx < 2; cx++)
+					corners[cx][cy][cz] = float3((float)(currentCell.x + cx), (float)(currentCell.y + cy), (float)(currentCell.z + cz));
+
+		float dist = 0.99999f;
+
+		for (int bz = -1; bz <= 1; bz++)
+			for (int by = -1; by <= 1; by++)
+				for (int bx = -1; bx <= 1; bx++)
+				{
+					int3 adjCell = int3(
+						max(0, min(Size.x - 1, currentCell.x + bx)),
+						max(0, min(Size.y - 1, currentCell.y + by)),
+						max(0, min(Size.z - 1, currentCell.z + bz)));
+
+					int currentTriangle = head[CellIndex(adjCell.x, adjCell.y, adjCell.z)];
+					if (currentTriangle == -1)
+						continue;
+
+					int type = abs(bz) + abs(by) + abs(bx);
+
+					if (type == 3) // corners
+					{
+						float3 corner = corners[(bx + 1) / 2][(by + 1) / 2][(bz + 1) / 2];
+						for (; currentTriangle != -1; currentTriangle = nodeNext[currentTriangle])
+						{
+							const float3* t = triangles + nodeTriangle[currentTriangle] * 3;
+							dist = minf(dist, distanceP2T(corner, t[0], t[1], t[2]));
+						}
+					}
+					if (type == 2) // edges (bx == 0 || by == 0 || bz == 0)
+					{
+						int3 mask = int3(abs(bx), abs(by), abs(bz));
+						int3 planeAxis = int3(1 - mask.x, 1 - mask.y, 1 - mask.z);
+						int3 coord0 = int3((bx + 1) / 2, (by + 1) / 2, (bz + 1) / 2);
+						int3 coord1 = int3(coord0.x * mask.x + planeAxis.x, coord0.y * mask.y + planeAxis.y, coord0.z * mask.z + planeAxis.z);
+
+						float3 edge0 = corners[coord0.x][coord0.y][coord0.z];
+						float3 edge1 = corners[coord1.x][coord1.y][coord1.z];
+
+						for (; currentTriangle != -1; currentTriangle = nodeNext[currentTriangle])
+						{
+							const float3* t = triangles + nodeTriangle[currentTriangle] * 3;
+							dist = minf(dist, distanceS2T(edge0, edge1, t[0], t[1], t[2]));
+						}
+					}
+					if (type == 1)
+					{
+						float3 N = float3((float)bx, (float)by, (float)bz);
+						float3 C = float3((float)(currentCell.x + (bx + 1) / 2), (float)(currentCell.y + (by + 1) / 2), (float)(currentCell.z + (bz + 1) / 2)); // intentionally int division
+						float3 B = abs(bz) == 1 ? float3(1, 0, 0) : float3(0, 0, 1);
+						float3 T = abs(cross(B, N));
+
+						for (; currentTriangle != -1; currentTriangle = nodeNext[currentTriangle])
+						{
+							const float3* t = triangles + nodeTriangle[currentTriangle] * 3;
+							dist = minf(dist, distanceQ2T(C, B, T, N, t[0], t[1], t[2]));
+						}
+					}
+				}
+
+		return dist;
+	}
+
+	// Same as DistanceFieldSpread_CS for a cell.
+	float SpreadDistance(const float* src, int level, int3 currentCell) const {
+		int Radius = (int)roundf(powf(3.0f, (float)level));
+		float RequiredDistance = (Radius - 1) * 0.5f;
+
+		float minDistance = 10000;
+		for (int bz = -1; bz <= 1; bz++)
+			for (int by = -1; by <= 1; by++)
+				for (int bx = -1; bx <= 1; bx++)
+				{
+					int3 adjCell = int3(
+						max(0, min(Size.x - 1, bx * Radius + currentCell.x)),
+						max(0, min(Size.y - 1, by * Radius + currentCell.y)),
+						max(0, min(Size.z - 1, bz * Radius + currentCell.z)));
+					minDistance = minf(minDistance, src[CellIndex(adjCell.x, adjCell.y, adjCell.z)]);
+				}
+
+		if (minDistance >= RequiredDistance) // can spread
+			return 2 * RequiredDistance + 1 + minDistance;
+		// can not enlarge with current info
+		return src[CellIndex(currentCell.x, currentCell.y, currentCell.z)];
+	}
+
+	// Number of spread levels, as in SphereTracingBase::BuildGrids.
+	int SpreadLevels() const {
+		int levels = (int)ceilf(logf((float)max(Size.x, max(Size.y, Size.z))) / logf(3.0f));
+		levels += levels % 2;
+		return levels;
+	}
+
+	inline float& MaxValue(int level, int3 block) {
+		if (level == 0)
+			return Field[CellIndex(block.x, block.y, block.z)];
+		return maxData[level][block.x + (long long)maxSizes[level][0] * (block.y + (long long)maxSizes[level][1] * block.z)];
+	}
+
+	// Recomputes a block of the max-pyramid from its children.
+	void UpdateMaxBlock(int level, int3 block) {
+		float m = -1;
+		for (int dz = 0; dz < 2; dz++)
+			for (int dy = 0; dy < 2; dy++)
+				for (int dx = 0; dx < 2; dx++)
+				{
+					int3 child = int3(2 * block.x + dx, 2 * block.y + dy, 2 * block.z + dz);
+					if (child.x < maxSizes[level - 1][0] && child.y < maxSizes[level - 1][1] && child.z < maxSizes[level - 1][2])
+						m = maxf(m, MaxValue(level - 1, child));
+				}
+		MaxValue(level, block) = m;
+	}
+
+	// Recomputes the max-pyramid blocks covering a range of cells.
+	void UpdateMaxPyramid(int3 lo, int3 hi) {
+		for (int k = 1; k < maxLevels; k++)
+			for (int z = lo.z >> k; z <= hi.z >> k; z++)
+				for (int y = lo.y >> k; y <= hi.y >> k; y++)
+					for (int x = lo.x >> k; x <= hi.x >> k; x++)
+						UpdateMaxBlock(k, int3(x, y, z));
+	}
+
+	void BuildMaxPyramid() {
+		maxLevels = 1;
+		maxSizes[0][0] = Size.x; maxSizes[0][1] = Size.y; maxSizes[0][2] = Size.z;
+		while (maxLevels < DF_BUILDER_MAX_LEVELS &&
+			(maxSizes[maxLevels - 1][0] > 1 || maxSizes[maxLevels - 1][1] > 1 || maxSizes[maxLevels - 1][2] > 1))
+		{
+			for (int axis = 0; axis < 3; axis++)
+				maxSizes[maxLevels][axis] = (maxSizes[maxLevels - 1][axis] + 1) / 2; // blocks cover the whole grid
+			maxData[maxLevels] = new float[(long long)maxSizes[maxLevels][0] * maxSizes[maxLevels][1] * maxSizes[maxLevels][2]];
+			maxLevels++;
+		}
+		UpdateMaxPyramid(int3(0, 0, 0), int3(Size.x - 1, Size.y - 1, Size.z - 1));
+	}
+
+	// Box (L-infinity) distance in cells between the cells lo..hi and the cells editLo..editHi.
+	static float BoxGap(int3 lo, int3 hi, int3 editLo, int3 editHi) {
+		int gx = max(0, max(editLo.x - hi.x - 1, lo.x - editHi.x - 1));
+		int gy = max(0, max(editLo.y - hi.y - 1, lo.y - editHi.y - 1));
+		int gz = max(0, max(editLo.z - hi.z - 1, lo.z - editHi.z - 1));
+		return (float)max(gx, max(gy, gz));
+	}
+
+	static bool Contains(int3 lo, int3 hi, int3 cell) {
+		return cell.x >= lo.x && cell.y >= lo.y && cell.z >= lo.z && cell.x <= hi.x && cell.y <= hi.y && cell.z <= hi.z;
+	}
+
+	// Clamps the cells of a max-pyramid block (except those in the recomputed range) whose expanded box reaches the
+	// edited cells. Blocks whose maximum can not reach the edit are skipped. Returns the new maximum of the block.
+	float ClampBlock(int level, int3 block, int3 recomputedLo, int3 recomputedHi, int3 editLo, int3 editHi, long long& clamped) {
+		float& value = MaxValue(level, block);
+		if (level == 0)
+		{
+			if (Contains(recomputedLo, recomputedHi, block))
+				return value;
+			float gap = BoxGap(block, block, editLo, editHi);
+			if (value > gap)
+			{
+				value = gap;
+				clamped++;
+			}
+			return value;
+		}
+
+		int3 lo = int3(block.x << level, block.y << level, block.z << level);
+		int3 hi = int3(
+			min(Size.x, lo.x + (1 << level)) - 1,
+			min(Size.y, lo.y + (1 << level)) - 1,
+			min(Size.z, lo.z + (1 << level)) - 1);
+		if (value <= BoxGap(lo, hi, editLo, editHi))
+			return value;
+
+		float m = -1;
+		for (int dz = 0; dz < 2; dz++)
+			for (int dy = 0; dy < 2; dy++)
+				for (int dx = 0; dx < 2; dx++)
+				{
+					int3 child = int3(2 * block.x + dx, 2 * block.y + dy, 2 * block.z + dz);
+					if (child.x < maxSizes[level - 1][0] && child.y < maxSizes[level - 1][1] && child.z < maxSizes[level - 1][2])
+						m = maxf(m, ClampBlock(level - 1, child, recomputedLo, recomputedHi, editLo, editHi, clamped));
+				}
+		value = m;
+		return m;
+	}
+
+public:
+	// Grid resolution.
+	int3 Size = int3(0, 0, 0);
+	// Transform from geometry space to grid space.
+	float4x4 FromGeometryToGrid;
+	// Distance field (slice-major, x fastest). Negative values for occupied cells.
+	float* Field = nullptr;
+	// Width in cells of the band around an edit where distances are spread again.
+	int Band = 8;
+
+	DistanceFieldBuilder() {}
+	DistanceFieldBuilder(const DistanceFieldBuilder&) = delete;
+	DistanceFieldBuilder& operator = (const DistanceFieldBuilder&) = delete;
+
+	~DistanceFieldBuilder() {
+		Release();
+	}
+
+	// Builds the field of a triangle mesh (positions in geometry space, 3 indices per triangle).
+	// Returns the time in milliseconds.
+	float Build(const float3* positions, const int* indices, int triangleCount, const float4x4& fromGeometryToGrid, int3 size) {
+		Stopwatch stopwatch;
+
+		Release();
+		this->Size = size;
+		this->FromGeometryToGrid = fromGeometryToGrid;
+		this->triangleCount = triangleCount;
+		this->indices = new int[triangleCount * 3];
+		memcpy(this->indices, indices, sizeof(int) * triangleCount * 3);
+		this->triangles = new float3[triangleCount * 3];
+
+		long long cells = (long long)size.x * size.y * size.z;
+		head = new int[cells];
+		for (long long c = 0; c < cells; c++)
+			head[c] = -1;
+
+		for (int t = 0; t < triangleCount; t++)
+		{
+			SetTriangle(t, positions);
+			Insert(t);
+		}
+
+		Field = new float[cells];
+		for (int z = 0; z < size.z; z++)
+			for (int y = 0; y < size.y; y++)
+				for (int x = 0; x < size.x; x++)
+					Field[CellIndex(x, y, z)] = InitialDistance(int3(x, y, z));
+
+		float* temp = new float[cells];
+		float* src = Field;
+		float* dst = temp;
+		int levels = SpreadLevels();
+		for (int level = 0; level < levels; level++)
+		{
+			for (int z = 0; z < size.z; z++)
+				for (int y = 0; y < size.y; y++)
+					for (int x = 0; x < size.x; x++)
+						dst[CellIndex(x, y, z)] = SpreadDistance(src, level, int3(x, y, z));
+			float* swap = src; src = dst; dst = swap;
+		}
+		// levels is even, the result is in Field
+		delete[] temp;
+
+		BuildMaxPyramid();
+
+		return stopwatch.Milliseconds();
+	}
+
+	// Updates the field after some triangles moved.
+	// positions has the new position of every vertex, changedTriangles the indices of the triangles that moved
+	// (triangles not in the list must have the same positions used before).
+	DistanceFieldUpdateStatistics Update(const float3* positions, const int* changedTriangles, int changedCount) {
+		Stopwatch stopwatch;
+
+		DistanceFieldUpdateStatistics stats = {};
+		stats.ChangedTriangles = changedCount;
+		stats.InsideGrid = true;
+		if (changedCount == 0 || !Field)
+			return stats;
+
+		// Cells touched by old and new triangles, and by new triangles only.
+		int3 touchedLo = Size, touchedHi = int3(-1, -1, -1);
+		int3 editLo = Size, editHi = int3(-1, -1, -1);
+		for (int i = 0; i < changedCount; i++)
+		{
+			int t = changedTriangles[i];
+			int3 minCell = int3(0, 0, 0), maxCell = int3(0, 0, 0);
+
+			TriangleCells(t, minCell, maxCell);
+			touchedLo = int3(min(touchedLo.x, minCell.x), min(touchedLo.y, minCell.y), min(touchedLo.z, minCell.z));
+			touchedHi = int3(max(touchedHi.x, maxCell.x), max(touchedHi.y, maxCell.y), max(touchedHi.z, maxCell.z));
+			Remove(t);
+
+			SetTriangle(t, positions);
+			stats.InsideGrid &= TriangleInsideGrid(t);
+
+			TriangleCells(t, minCell, maxCell);
+			touchedLo = int3(min(touchedLo.x, minCell.x), min(touchedLo.y, minCell.y), min(touchedLo.z, minCell.z));
+			touchedHi = int3(max(touchedHi.x, maxCell.x), max(touchedHi.y, maxCell.y), max(touchedHi.z, maxCell.z));
+			editLo = int3(min(editLo.x, minCell.x), min(editLo.y, minCell.y), min(editLo.z, minCell.z));
+			editHi = int3(max(editHi.x, maxCell.x), max(editHi.y, maxCell.y), max(editHi.z, maxCell.z));
+			Insert(t);
+		}
+
+		// Initial distances depend on the triangles of adjacent cells.
+		int3 recomputedLo = int3(max(0, touchedLo.x - 1), max(0, touchedLo.y - 1), max(0, touchedLo.z - 1));
+		int3 recomputedHi = int3(min(Size.x - 1, touchedHi.x + 1), min(Size.y - 1, touchedHi.y + 1), min(Size.z - 1, touchedHi.z + 1));
+		for (int z = recomputedLo.z; z <= recomputedHi.z; z++)
+			for (int y = recomputedLo.y; y <= recomputedHi.y; y++)
+				for (int x = recomputedLo.x; x <= recomputedHi.x; x++)
+					Field[CellIndex(x, y, z)] = InitialDistance(int3(x, y, z));
+		stats.RecomputedCells = (long long)(recomputedHi.x - recomputedLo.x + 1) * (recomputedHi.y - recomputedLo.y + 1) * (recomputedHi.z - recomputedLo.z + 1);
+		stats.RecomputedLo = recomputedLo;
+		stats.RecomputedHi = recomputedHi;
+
+		// Removed triangles only make the rest of the field more conservative, but new triangles can be inside
+		// the safe region of any cell. Those cells are found descending the max-pyramid.
+		ClampBlock(maxLevels - 1, int3(0, 0, 0), recomputedLo, recomputedHi, editLo, editHi, stats.ClampedCells);
+
+		// Spread again in the band. Every spread value is conservative given conservative neighbours,
+		// so cells are updated in place and keep the largest of both values.
+		int3 bandLo = int3(max(0, recomputedLo.x - Band), max(0, recomputedLo.y - Band), max(0, recomputedLo.z - Band));
+		int3 bandHi = int3(min(Size.x - 1, recomputedHi.x + Band), min(Size.y - 1, recomputedHi.y + Band), min(Size.z - 1, recomputedHi.z + Band));
+		int levels = SpreadLevels();
+		for (int level = 0; level < levels; level++)
+			for (int z = bandLo.z; z <= bandHi.z; z++)
+				for (int y = bandLo.y; y <= bandHi.y; y++)
+					for (int x = bandLo.x; x <= bandHi.x; x++)
+					{
+						float& value = Field[CellIndex(x, y, z)];
+						value = maxf(value, SpreadDistance(Field, level, int3(x, y, z)));
+					}
+		stats.SpreadCells = (long long)(bandHi.x - bandLo.x + 1) * (bandHi.y - bandLo.y + 1) * (bandHi.z - bandLo.z + 1);
+
+		UpdateMaxPyramid(bandLo, bandHi);
+
+		stats.Milliseconds = stopwatch.Milliseconds();
+		return stats;
+	}
+};
+
+/// Triangle mesh of an ellipsoid centered at the origin (slices x stacks quads), the test geometry of the harnesses.
+struct EllipsoidMesh {
+	int VertexCount;
+	int TriangleCount;
+	float3* Positions;
+	int* Indices;
+
+	EllipsoidMesh(float3 radii, int slices = 128, int stacks = 64) {
+		VertexCount = (slices + 1) * (stacks + 1);
+		TriangleCount = slices * stacks * 2;
+		Positions = new float3[VertexCount];
+		Indices = new int[TriangleCount * 3];
+		for (int j = 0; j <= stacks; j++)
+			for (int i = 0; i <= slices; i++)
+			{
+				float theta = PI * j / stacks, phi = 2 * PI * i / slices;
+				Positions[j * (slices + 1) + i] = float3(sinf(theta) * cosf(phi), cosf(theta), sinf(theta) * sinf(phi)) * radii;
+			}
+		int* index = Indices;
+		for (int j = 0; j < stacks; j++)
+			for (int i = 0; i < slices; i++)
+			{
+				int a = j * (slices + 1) + i, b = a + 1, c = a + slices + 1, d = c + 1;
+				*index++ = a; *index++ = c; *index++ = b;
+				*index++ = b; *index++ = c; *index++ = d;
+			}
+	}
+
+	EllipsoidMesh(const EllipsoidMesh&) = delete;
+	EllipsoidMesh& operator = (const EllipsoidMesh&) = delete;
+
+	~EllipsoidMesh() {
+		delete[] Positions;
+		delete[] Indices;
+	}
+
+	// Transform to a grid of the given resolution on the largest axis, as SphereTracingBase::SelectGridResolutions
+	// (the box of the mesh is the box of the grid).
+	float4x4 GridTransform(int resolution, int3& size) const {
+		float3 minim = Positions[0], maxim = Positions[0];
+		for (int v = 1; v < VertexCount; v++)
+		{
+			minim = minf(minim, Positions[v]);
+			maxim = maxf(maxim, Positions[v]);
+		}
+		size = DistanceFieldGridSize(minim, maxim, resolution);
+		float3 extent = maxim - minim;
+		float maxSize = maxf(extent.x, maxf(extent.y, extent.z));
+		return mul(Transforms::Translate(-minim), Transforms::Scale(max(size.x, max(size.y, size.z)) / maxSize));
+	}
+};
+
+/// Local deformations of a mesh for the update harnesses.
+/// Each even edit pushes the vertices within radius (geometry space) of a random vertex towards the center of the mesh,
+/// with a smooth falloff, and the next edit moves them back, so the mesh stays inside the grid.
+class LocalDeformation {
+	const float3* positions;
+	int vertexCount;
+	float radius, amplitude;
+	unsigned int state;
+	float3 center = float3(0, 0, 0);
+
+	// Triangles adjacent to each vertex
+	int* vertexTrianglesStart;
+	int* vertexTriangles;
+	int* markedEdit;
+	int* moved;
+	float3* offsets;
+	int movedCount = 0;
+	int edit = 0;
+
+	// xorshift32 (<random> can not be used with Windows min/max macros)
+	unsigned int NextRandom() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+public:
+	// Positions of the vertices after the last edit, and triangles moved by it.
+	float3* Current;
+	int* Changed;
+	int ChangedCount = 0;
+
+	LocalDeformation(const float3* positions, int vertexCount, const int* indices, int triangleCount,
+		float radius, float amplitude, unsigned int seed = 0) :
+		positions(positions), vertexCount(vertexCount), radius(radius), amplitude(amplitude) {
+		state = seed * 747796405u + 2891336453u;
+
+		Current = new float3[vertexCount];
+		memcpy(Current, positions, sizeof(float3) * vertexCount);
+		for (int v = 0; v < vertexCount; v++)
+			center = center + positions[v];
+		center = center * (1.0f / vertexCount);
+
+		vertexTrianglesStart = new int[vertexCount + 1];
+		vertexTriangles = new int[triangleCount * 3];
+		for (int v = 0; v <= vertexCount; v++)
+			vertexTrianglesStart[v] = 0;
+		for (int i = 0; i < triangleCount * 3; i++)
+			vertexTrianglesStart[indices[i] + 1]++;
+		for (int v = 0; v < vertexCount; v++)
+			vertexTrianglesStart[v + 1] += vertexTrianglesStart[v];
+		int* fill = new int[vertexCount];
+		for (int v = 0; v < vertexCount; v++)
+			fill[v] = vertexTrianglesStart[v];
+		for (int i = 0; i < triangleCount * 3; i++)
+			vertexTriangles[fill[indices[i]]++] = i / 3;
+		delete[] fill;
+
+		Changed = new int[triangleCount];
+		markedEdit = new int[triangleCount];
+		for (int t = 0; t < triangleCount; t++)
+			markedEdit[t] = -1;
+		moved = new int[vertexCount];
+		offsets = new float3[vertexCount];
+	}
+
+	LocalDeformation(const LocalDeformation&) = delete;
+	LocalDeformation& operator = (const LocalDeformation&) = delete;
+
+	~LocalDeformation() {
+		delete[] Current;
+		delete[] vertexTrianglesStart;
+		delete[] vertexTriangles;
+		delete[] Changed;
+		delete[] markedEdit;
+		delete[] moved;
+		delete[] offsets;
+	}
+
+	// Applies the next edit to Current and lists the triangles it moved in Changed.
+	void Next() {
+		if (edit % 2 == 0) // deform
+		{
+			float3 editCenter = positions[NextRandom() % vertexCount];
+			movedCount = 0;
+			for (int v = 0; v < vertexCount; v++)
+			{
+				float d = length(positions[v] - editCenter);
+				if (d >= radius)
+					continue;
+				float falloff = 1 - d / radius;
+				float3 toCenter = center - positions[v];
+				float toCenterLength = length(toCenter);
+				offsets[movedCount] = toCenterLength > 0 ? toCenter * (amplitude * falloff * falloff / toCenterLength) : float3(0, 0, 0);
+				moved[movedCount++] = v;
+			}
+			for (int i = 0; i < movedCount; i++)
+				Current[moved[i]] = positions[moved[i]] + offsets[i];
+		}
+		else // restore
+		{
+			for (int i = 0; i < movedCount; i++)
+				Current[moved[i]] = positions[moved[i]];
+		}
+
+		ChangedCount = 0;
+		for (int i = 0; i < movedCount; i++)
+			for (int j = vertexTrianglesStart[moved[i]]; j < vertexTrianglesStart[moved[i] + 1]; j++)
+			{
+				int t = vertexTriangles[j];
+				if (markedEdit[t] != edit)
+				{
+					markedEdit[t] = edit;
+					Changed[ChangedCount++] = t;
+				}
+			}
+		edit++;
+	}
+};
+
+// Result of the local deformation benchmark.
+struct DistanceFieldDeformationBenchmark {
+	int Triangles;
+	int3 Size = int3(0, 0, 0);
+	// Time of a full build.
+	float BuildMilliseconds;
+	int Edits;
+	// Averages per edit.
+	float UpdateMilliseconds;
+	float ChangedTriangles;
+	float RecomputedCells;
+	float ClampedCells;
+	float SpreadCells;
+};
+
+/// Measures incremental updates for local deformations of a mesh against a full build.
+inline DistanceFieldDeformationBenchmark BenchmarkLocalDeformation(
+	const float3* positions, int vertexCount, const int* indices, int triangleCount,
+	const float4x4& fromGeometryToGrid, int3 size,
+	float radius, float amplitude, int edits = 16, unsigned int seed = 0) {
+	LocalDeformation deformation(positions, vertexCount, indices, triangleCount, radius, amplitude, seed);
+
+	DistanceFieldBuilder builder;
+	DistanceFieldDeformationBenchmark result = {};
+	result.Triangles = triangleCount;
+	result.Size = size;
+	result.BuildMilliseconds = builder.Build(positions, indices, triangleCount, fromGeometryToGrid, size);
+
+	double milliseconds = 0, changedTriangles = 0, recomputed = 0, clamped = 0, spread = 0;
+	for (int edit = 0; edit < edits; edit++)
+	{
+		deformation.Next();
+		DistanceFieldUpdateStatistics stats = builder.Update(deformation.Current, deformation.Changed, deformation.ChangedCount);
+		milliseconds += stats.Milliseconds;
+		changedTriangles += stats.ChangedTriangles;
+		recomputed += stats.RecomputedCells;
+		clamped += stats.ClampedCells;
+		spread += stats.SpreadCells;
+	}
+
+	result.Edits = edits;
+	if (edits > 0)
+	{
+		result.UpdateMilliseconds = (float)(milliseconds / edits);
+		result.ChangedTriangles = (float)(changedTriangles / edits);
+		result.RecomputedCells = (float)(recomputed / edits);
+		result.ClampedCells = (float)(clamped / edits);
+		result.SpreadCells = (float)(spread / edits);
+	}
+
+	return result;
+}
+
+/// Distance from the cell [cell, cell + 1] (grid space) to a triangle outside it, with the functions of the initial distances.
+inline float DistanceCellToTriangle(int3 cell, float3 t1, float3 t2, float3 t3) {
+	float3 lo = float3((float)cell.x, (float)cell.y, (float)cell.z);
+	float dist = 1000000;
+	for (int axis = 0; axis < 3; axis++)
+		for (int side = 0; side < 2; side++)
+		{
+			float3 N = axis == 0 ? float3(1, 0, 0) : axis == 1 ? float3(0, 1, 0) : float3(0, 0, 1);
+			float3 B = axis == 2 ? float3(1, 0, 0) : float3(0, 0, 1);
+			float3 T = abs(cross(B, N));
+			dist = minf(dist, distanceQ2T(lo + N * (float)side, B, T, N, t1, t2, t3));
+		}
+	return dist;
+}
+
+/// Comparison of the fields kept by Update after local deformations with the fields built again from scratch.
+/// Update clamps the cells near an edit to their box gap, which can be tighter than the spread of a full build,
+/// so the cells larger than the built field are checked against the exact distances to the deformed mesh.
+struct DistanceFieldUpdateCheck {
+	int Edits;
+	long long Cells;
+	// Cells where the updated field is larger than the built one (and the largest difference)
+	long long Tighter;
+	float MaxTighter;
+	// Of those, cells whose value is larger than the distance to the triangles (and the largest excess)
+	long long Overestimates;
+	float MaxExcess;
+	// Cells of the recomputed ranges, those whose value differs from the built one (and the largest difference)
+	long long RecomputedCells;
+	long long RecomputedMismatches;
+	float MaxRecomputedDifference;
+};
+
+inline DistanceFieldUpdateCheck CheckLocalUpdates(int resolution = 32, int edits = 8, unsigned int seed = 0) {
+	EllipsoidMesh mesh(float3(0.5f, 0.35f, 0.25f), 64, 32);
+	int3 size = int3(0, 0, 0);
+	float4x4 toGrid = mesh.GridTransform(resolution, size);
+	LocalDeformation deformation(mesh.Positions, mesh.VertexCount, mesh.Indices, mesh.TriangleCount, 0.15f, 0.05f, seed);
+
+	DistanceFieldBuilder updated, built;
+	updated.Build(mesh.Positions, mesh.Indices, mesh.TriangleCount, toGrid, size);
+
+	float3* triangles = new float3[mesh.TriangleCount * 3];
+	DistanceFieldUpdateCheck check = {};
+	check.Edits = edits;
+	for (int edit = 0; edit < edits; edit++)
+	{
+		deformation.Next();
+		DistanceFieldUpdateStatistics stats = updated.Update(deformation.Current, deformation.Changed, deformation.ChangedCount);
+		built.Build(deformation.Current, mesh.Indices, mesh.TriangleCount, toGrid, size);
+		for (int i = 0; i < mesh.TriangleCount * 3; i++)
+		{
+			float3 P = deformation.Current[mesh.Indices[i]];
+			triangles[i] = mul(float4(P.x, P.y, P.z, 1), toGrid).get_xyz();
+		}
+
+		for (int z = 0; z < size.z; z++)
+			for (int y = 0; y < size.y; y++)
+				for (int x = 0; x < size.x; x++)
+				{
+					long long cell = x + size.x * (y + (long long)size.y * z);
+					float value = updated.Field[cell];
+					float difference = value - built.Field[cell];
+					check.Cells++;
+					if (x >= stats.RecomputedLo.x && x <= stats.RecomputedHi.x &&
+						y >= stats.RecomputedLo.y && y <= stats.RecomputedHi.y &&
+						z >= stats.RecomputedLo.z && z <= stats.RecomputedHi.z)
+					{
+						check.RecomputedCells++;
+						if (difference != 0)
+						{
+							check.RecomputedMismatches++;
+							check.MaxRecomputedDifference = maxf(check.MaxRecomputedDifference, fabsf(difference));
+						}
+					}
+					if (difference <= 0)
+						continue;
+					check.Tighter++;
+					check.MaxTighter = maxf(check.MaxTighter, difference);
+
+					// only triangles whose box is closer than the value can be closer than the value
+					float3 lo = float3((float)x, (float)y, (float)z), hi = lo + float3(1, 1, 1);
+					float distance = 1000000;
+					for (int t = 0; t < mesh.TriangleCount; t++)
+					{
+						const float3* T = triangles + t * 3;
+						float3 gap = maxf(float3(0, 0, 0), maxf(minf(T[0], minf(T[1], T[2])) - hi, lo - maxf(T[0], maxf(T[1], T[2]))));
+						if (length(gap) < value)
+							distance = minf(distance, DistanceCellToTriangle(int3(x, y, z), T[0], T[1], T[2]));
+					}
+					if (value > distance + 1e-4f)
+					{
+						check.Overestimates++;
+						check.MaxExcess = maxf(check.MaxExcess, value - distance);
+					}
+				}
+	}
+	delete[] triangles;
+	return check;
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include "dx4xb_scene.h"
+#include <compressapi.h>
+#include "../CPU/MappedFile.h"
+
+using namespace dx4xb;
+
+// Version of the distance field construction (TriangleGrid, DistanceFieldInitial and DistanceFieldSpread shaders).
+// Must be increased every time those shaders change the values they produce, so old cached fields are ignored.
+#define DF_ALGORITHM_VERSION 1
+
+// Version of the cache file layout.
+#define DF_CACHE_FILE_VERSION 1
+
+#define DF_CACHE_COMPRESSION_NONE 0
+#define DF_CACHE_COMPRESSION_XPRESS_HUFF 1
+
+// Header of a cached distance field file.
+// All fields are fixed size and little-endian so files can be shared between machines.
+struct DistanceFieldCacheHeader {
+	char Magic[4]; // DFCF
+	unsigned int FileVersion;
+	// Content hash of the geometry and the grid parameters.
+	unsigned long long Key;
+	// Grid resolution.
+	int Width, Height, Depth;
+	// Transform from geometry space to grid space used to build the field.
+	float GridTransform[16];
+	unsigned int Compression;
+	// Size in bytes of the decompressed field.
+	unsigned long long RawSize;
+	// Size in bytes of the field stored after the header.
+	unsigned long long StoredSize;
+};
+static_assert(sizeof(DistanceFieldCacheHeader) == 112, "Distance field cache header must be tightly packed");
+
+/// Persistent storage of baked distance fields.
+/// Each field is saved in a separated file named by the content hash of the geometry,
+/// compressed with Xpress-Huffman and memory-mapped when loaded.
+class DistanceFieldCache {
+
+	char folder[MAX_PATH];
+
+	void FileNameFor(unsigned long long key, char* fileName) {
+		sprintf_s(fileName, MAX_PATH, "%s\\%016llx.df", folder, key);
+	}
+
+	static unsigned long long Hash(unsigned long long hash, const void* data, size_t size) {
+		const byte* bytes = (const byte*)data;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 1099511628211ULL;
+		}
+		return hash;
+	}
+
+public:
+	DistanceFieldCache(const char* folder = "DFCache") {
+		SetFolder(folder);
+	}
+
+	// Changes the folder used to store the cached fields. It can be a shared network location.
+	void SetFolder(const char* folder) {
+		strcpy_s(this->folder, folder);
+	}
+
+	const char* Folder() const { return folder; }
+
+	// Computes the key of the distance field for a geometry of the scene.
+	// The key depends only on the vertex positions, the (relative) indices, the grid resolution and the
+	// algorithm version, therefore, the same mesh loaded in different scenes or machines shares the cached field.
+	static unsigned long long ComputeKey(gObj<IScene> desc, int geometryIndex, int3 gridSize) {
+		auto geom = desc->Geometries().Data[geometryIndex];
+
+		unsigned long long hash = 14695981039346656037ULL; // FNV-1a 64 offset basis
+		int version = DF_ALGORITHM_VERSION;
+		hash = Hash(hash, &version, sizeof(int));
+		hash = Hash(hash, &gridSize, sizeof(int3));
+		hash = Hash(hash, &geom.VertexCount, sizeof(int));
+		hash = Hash(hash, &geom.IndexCount, sizeof(int));
+		for (int j = 0; j < geom.VertexCount; j++)
+			hash = Hash(hash, &desc->Vertices().Data[geom.StartVertex + j].Position, sizeof(float3));
+		hash = Hash(hash, desc->Indices().Data + geom.StartIndex, sizeof(int) * geom.IndexCount);
+		return hash;
+	}
+
+	// Loads a cached field into data (width x height x depth floats, slice-major) and gets the grid transform used.
+	// Returns false if the field is not in the cache or the file is not valid.
+	bool Load(unsigned long long key, int3 gridSize, float* data, float4x4& gridTransform) {
+		char fileName[MAX_PATH];
+		FileNameFor(key, fileName);
+
+		MappedFile file;
+		if (!file.Open(fileName))
+			return false;
+
+		if (file.Size() < sizeof(DistanceFieldCacheHeader))
+			return false;
+
+		auto header = file.As<DistanceFieldCacheHeader>();
+		unsigned long long rawSize = (unsigned long long)gridSize.x * gridSize.y * gridSize.z * sizeof(float);
+		if (memcmp(header->Magic, "DFCF", 4) != 0 ||
+			header->FileVersion != DF_CACHE_FILE_VERSION ||
+			header->Key != key ||
+			header->Width != gridSize.x || header->Height != gridSize.y || header->Depth != gridSize.z ||
+			header->RawSize != rawSize ||
+			file.Size() < sizeof(DistanceFieldCacheHeader) + header->StoredSize)
+			return false;
+
+		const byte* stored = file.Data() + sizeof(DistanceFieldCacheHeader);
+
+		switch (header->Compression) {
+		case DF_CACHE_COMPRESSION_NONE:
+			if (header->StoredSize != rawSize)
+				return false;
+			memcpy(data, stored, rawSize);
+			break;
+		case DF_CACHE_COMPRESSION_XPRESS_HUFF:
+		{
+			DECOMPRESSOR_HANDLE decompressor;
+			if (!CreateDecompressor(COMPRESS_ALGORITHM_XPRESS_HUFF, nullptr, &decompressor))
+				return false;
+			SIZE_T decompressedSize;
+			BOOL success = Decompress(decompressor, stored, header->StoredSize, data, rawSize, &decompressedSize);
+			CloseDecompressor(decompressor);
+			if (!success || decompressedSize != rawSize)
+				return false;
+			break;
+		}
+		default:
+			return false;
+		}
+
+		memcpy(&gridTransform, header->GridTransform, sizeof(float4x4));
+		return true;
+	}
+
+	// Saves a field in the cache. The file is written aside and renamed at the end,
+	// so other processes reading the cache never see a partial file.
+	bool Save(unsigned long long key, int3 gridSize, const float* data, const float4x4& gridTransform) {
+		CreateDirectoryA(folder, nullptr);
+
+		DistanceFieldCacheHeader header = {};
+		memcpy(header.Magic, "DFCF", 4);
+		header.FileVersion = DF_CACHE_FILE_VERSION;
+		header.Key = key;
+		header.Width = gridSize.x;
+		header.Height = gridSize.y;
+		header.Depth = gridSize.z;
+		memcpy(header.GridTransform, &gridTransform, sizeof(float4x4));
+		header.RawSize = (unsigned long long)gridSize.x * gridSize.y * gridSize.z * sizeof(float);
+
+		const void* stored = data;
+		byte* compressed = nullptr;
+		header.Compression = DF_CACHE_COMPRESSION_NONE;
+		header.StoredSize = header.RawSize;
+
+		COMPRESSOR_HANDLE compressor;
+		if (CreateCompressor(COMPRESS_ALGORITHM_XPRESS_HUFF, nullptr, &compressor))
+		{
+			SIZE_T compressedSize;
+			// Query the size required for the compressed buffer
+			Compress(compressor, data, header.RawSize, nullptr, 0, &compressedSize);
+			compressed = new byte[compressedSize];
+			if (Compress(compressor, data, header.RawSize, compressed, compressedSize, &compressedSize)
+				&& compressedSize < header.RawSize)
+			{
+				stored = compressed;
+				header.Compression = DF_CACHE_COMPRESSION_XPRESS_HUFF;
+				header.StoredSize = compressedSize;
+			}
+			CloseCompressor(compressor);
+		}
+
+		char fileName[MAX_PATH];
+		FileNameFor(key, fileName);
+		char tempFileName[MAX_PATH];
+		sprintf_s(tempFileName, "%s.%u.tmp", fileName, GetCurrentProcessId());
+
+		bool saved = false;
+		FILE* file;
+		if (fopen_s(&file, tempFileName, "wb") == 0)
+		{
+			saved =
+				fwrite(&header, sizeof(DistanceFieldCacheHeader), 1, file) == 1 &&
+				fwrite(stored, 1, header.StoredSize, file) == header.StoredSize;
+			fclose(file);
+			saved = saved && MoveFileExA(tempFileName, fileName, MOVEFILE_REPLACE_EXISTING);
+			if (!saved)
+				DeleteFileA(tempFileName);
+		}
+
+		if (compressed)
+			delete[] compressed;
+		return saved;
+	}
+};
@@ -19,6 +19,8 @@ RWTexture3D<float> DistanceField : register(u0);
 
 cbuffer GridTransform : register(b0) {
 	float4x4 FromGeometryToGrid;
+	// Resolution of the grid (can be smaller than the Head texture)
+	int3 Size;
 }
 
 /// Gets the triangle in Grid space (0,0,0)-(Size, Size, Size)
@@ -31,10 +33,10 @@ void GetTriangle(int triangleIndex, inout float3 t[3]) {
 [numthreads(1024, 1, 1)]
 void main(uint3 DTid : SV_DispatchThreadID)
 {
-	uint Size, height, depth;
-	Head.GetDimensions(Size, height, depth);
+	if (DTid.x >= (uint)(Size.x * Size.y * Size.z))
+		return;
 
-	int3 currentCell = int3(DTid.x % Size, DTid.x / Size % Size, DTid.x / (Size * Size));
+	int3 currentCell = int3(DTid.x % Size.x, DTid.x / Size.x % Size.y, DTid.x / (Size.x * Size.y));
 
 	if (Head[currentCell] != -1) // not empty cell
 	{
@@ -0,0 +1,320 @@
+#pragma once
+
+#include "dx4xb_math.h"
+
+using namespace dx4xb;
+
+#define DF_PYRAMID_MAX_LEVELS 16
+
+/// Grid resolution for a geometry box when the largest axis has the given resolution.
+/// Cells are cubes, so the grids of elongated geometries are anisotropic and usually not powers of two.
+inline int3 DistanceFieldGridSize(float3 minim, float3 maxim, int resolution) {
+	float3 extent = maxim - minim;
+	float cellSize = maxf(extent.x, maxf(extent.y, extent.z)) / resolution;
+	return int3(
+		min(resolution, max(1, (int)ceilf(extent.x / cellSize))),
+		min(resolution, max(1, (int)ceilf(extent.y / cellSize))),
+		min(resolution, max(1, (int)ceilf(extent.z / cellSize))));
+}
+
+/// Mip chain of conservative minimums over a distance field.
+/// A cell of level k covers the 2^k x 2^k x 2^k block of level 0 cells below it and stores the minimum
+/// of their values (negative if any of them is occupied). Since every level 0 cell expanded by its value is empty,
+/// the whole block expanded by the minimum is also empty, and the safe radius of a point inside the block
+/// is the minimum plus the distance to the block border.
+/// Level sizes follow Direct3D mip rules (max(1, size >> k)), so the pyramid can be uploaded as the mips of a Texture3D.
+/// Once an axis is clamped to a single cell (size >> k == 0) a coarse cell covers less than its 2^k block,
+/// so only the levels before the first clamped one are used by the radius queries.
+class DistanceFieldPyramid {
+public:
+	// Number of levels (level 0 is the distance field).
+	int Levels = 0;
+	// Number of levels whose cells cover whole 2^k blocks (no axis clamped).
+	int CoveringLevels = 0;
+	// Resolution of each level (x, y, z).
+	int Sizes[DF_PYRAMID_MAX_LEVELS][3];
+	// Offset (in floats) of each level in Data.
+	long long Offsets[DF_PYRAMID_MAX_LEVELS];
+	// All levels consecutive, each level slice-major (x fastest).
+	float* Data = nullptr;
+	// Number of floats in Data.
+	long long Count = 0;
+
+	DistanceFieldPyramid() {}
+	DistanceFieldPyramid(const DistanceFieldPyramid&) = delete;
+	DistanceFieldPyramid& operator = (const DistanceFieldPyramid&) = delete;
+
+	~DistanceFieldPyramid() {
+		if (Data)
+			delete[] Data;
+	}
+
+	inline int3 Size(int level) const {
+		return int3(Sizes[level][0], Sizes[level][1], Sizes[level][2]);
+	}
+
+	// Number of mips of the full chain for a resolution.
+	static int LevelsFor(int3 size) {
+		int levels = 1;
+		int maxSize = max(size.x, max(size.y, size.z));
+		while ((maxSize >> levels) > 0 && levels < DF_PYRAMID_MAX_LEVELS)
+			levels++;
+		return levels;
+	}
+
+	// Number of levels without a clamped axis, the same test is done by PyramidRadius in STBase_RT.h.
+	static int CoveringLevelsFor(int3 size) {
+		return LevelsFor(int3(1, 1, 1) * min(size.x, min(size.y, size.z)));
+	}
+
+	void Build(const float* field, int3 size) {
+		if (Data)
+			delete[] Data;
+
+		Levels = LevelsFor(size);
+		CoveringLevels = CoveringLevelsFor(size);
+		Count = 0;
+		for (int k = 0; k < Levels; k++)
+		{
+			Sizes[k][0] = max(1, size.x >> k);
+			Sizes[k][1] = max(1, size.y >> k);
+			Sizes[k][2] = max(1, size.z >> k);
+			Offsets[k] = Count;
+			Count += (long long)Sizes[k][0] * Sizes[k][1] * Sizes[k][2];
+		}
+		Data = new float[Count];
+		memcpy(Data, field, sizeof(float) * size.x * size.y * size.z);
+
+		for (int k = 1; k < Levels; k++)
+		{
+			int3 fine = Size(k - 1);
+			int3 coarse = Size(k);
+			for (int z = 0; z < coarse.z; z++)
+				for (int y = 0; y < coarse.y; y++)
+					for (int x = 0; x < coarse.x; x++)
+					{
+						float m = 100000;
+						for (int dz = 0; dz < 2; dz++)
+							for (int dy = 0; dy < 2; dy++)
+								for (int dx = 0; dx < 2; dx++)
+								{
+									int3 child = int3(2 * x + dx, 2 * y + dy, 2 * z + dz);
+									if (child.x < fine.x && child.y < fine.y && child.z < fine.z)
+										m = minf(m, Value(k - 1, child));
+								}
+						Data[Offsets[k] + x + (long long)coarse.x * (y + (long long)coarse.y * z)] = m;
+					}
+		}
+	}
+
+	inline float Value(int level, int3 cell) const {
+		return Data[Offsets[level] + cell.x + (long long)Sizes[level][0] * (cell.y + (long long)Sizes[level][1] * cell.z)];
+	}
+
+	// Safe radius (in cells) using only the distance field (same as MaximalRadius in STBase_RT.h).
+	float FlatRadius(float3 P) const {
+		int3 cell = int3((int)floorf(P.x), (int)floorf(P.y), (int)floorf(P.z));
+		if (cell.x < 0 || cell.y < 0 || cell.z < 0 || cell.x >= Sizes[0][0] || cell.y >= Sizes[0][1] || cell.z >= Sizes[0][2])
+			return 0;
+		float radius = Value(0, cell);
+		if (radius < 0)
+			return 0;
+		float3 toMin = P - float3((float)cell.x, (float)cell.y, (float)cell.z);
+		float3 m = minf(toMin, float3(1, 1, 1) - toMin);
+		return radius + minf(m.x, minf(m.y, m.z));
+	}
+
+	// Safe radius (in cells) using every covering level of the pyramid.
+	// Levels are visited from fine to coarse until a block is occupied or not stored (coarser blocks contain it).
+	// Optionally returns the level giving the largest radius.
+	float Radius(float3 P, int* bestLevel = nullptr) const {
+		float best = FlatRadius(P);
+		if (bestLevel)
+			*bestLevel = 0;
+		if (best <= 0)
+			return best;
+
+		for (int k = 1; k < CoveringLevels; k++)
+		{
+			int blockSize = 1 << k;
+			int3 cell = int3((int)floorf(P.x) >> k, (int)floorf(P.y) >> k, (int)floorf(P.z) >> k);
+			if (cell.x >= Sizes[k][0] || cell.y >= Sizes[k][1] || cell.z >= Sizes[k][2])
+				break;
+			float value = Value(k, cell);
+			if (value < 0)
+				break;
+			// A stored cell of a covering level is a whole block inside the grid
+			float3 lo = float3((float)cell.x * blockSize, (float)cell.y * blockSize, (float)cell.z * blockSize);
+			float3 hi = lo + float3((float)blockSize, (float)blockSize, (float)blockSize);
+			float3 m = minf(P - lo, hi - P);
+			float radius = value + minf(m.x, minf(m.y, m.z));
+			if (radius > best)
+			{
+				best = radius;
+				if (bestLevel)
+					*bestLevel = k;
+			}
+		}
+		return best;
+	}
+};
+
+// Result of the sphere tracing harness.
+struct DistanceFieldStepStatistics {
+	int Rays;
+	// Average number of steps using only the distance field.
+	float FlatSteps;
+	// Average number of steps using the pyramid.
+	float PyramidSteps;
+};
+
+/// Sphere traces random rays from random empty cells of a grid with both queries and compares the number of steps.
+/// A ray ends when it leaves the grid or the safe radius is less than epsilon cells.
+inline DistanceFieldStepStatistics MeasureSphereTracingSteps(const DistanceFieldPyramid& pyramid, int rays = 4096, float epsilon = 0.01f, unsigned int seed = 0) {
+	// xorshift32 (<random> can not be used with Windows min/max macros)
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto uniform = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	int3 size = pyramid.Size(0);
+	float3 gridSize = float3((float)size.x, (float)size.y, (float)size.z);
+
+	DistanceFieldStepStatistics stats = { 0, 0, 0 };
+	long long flatSteps = 0, pyramidSteps = 0;
+
+	for (int attempt = 0; stats.Rays < rays && attempt < rays * 16; attempt++)
+	{
+		float3 origin = float3(uniform(), uniform(), uniform()) * gridSize;
+		if (pyramid.FlatRadius(origin) <= epsilon)
+			continue; // start only in empty space
+
+		float z = 1 - 2 * uniform();
+		float r = sqrtf(maxf(0.0f, 1 - z * z));
+		float phi = 2 * 3.14159265f * uniform();
+		float3 direction = float3(r * cosf(phi), r * sinf(phi), z);
+
+		for (int usePyramid = 0; usePyramid < 2; usePyramid++)
+		{
+			float3 x = origin;
+			int steps = 0;
+			while (steps < 10000 &&
+				x.x >= 0 && x.y >= 0 && x.z >= 0 && x.x < gridSize.x && x.y < gridSize.y && x.z < gridSize.z)
+			{
+				float radius = usePyramid ? pyramid.Radius(x) : pyramid.FlatRadius(x);
+				steps++;
+				if (radius < epsilon)
+					break;
+				x = x + direction * radius;
+			}
+			(usePyramid ? pyramidSteps : flatSteps) += steps;
+		}
+		stats.Rays++;
+	}
+
+	if (stats.Rays > 0)
+	{
+		stats.FlatSteps = flatSteps / (float)stats.Rays;
+		stats.PyramidSteps = pyramidSteps / (float)stats.Rays;
+	}
+	return stats;
+}
+
+// Result of the conservativeness check of the pyramid radius.
+struct DistanceFieldPyramidCheck {
+	int Points;
+	// Points where Radius is larger than the exact distance to the occupied cells (must be 0).
+	int Overestimates;
+	// Largest excess of Radius over the exact distance (cells).
+	float MaxExcess;
+	// Points where Radius is larger than FlatRadius (the coarse levels were used).
+	int Improved;
+};
+
+/// Checks that the pyramid radius never exceeds the exact distance to the occupied cells of a grid.
+/// The occupied cells are random boxes (some of them slabs crossing the grid), every empty cell stores its exact
+/// value (chebyshev gap to the nearest occupied cell, so the expanded cell touches it) and the exact distance
+/// of a point is the euclidean distance to the nearest box.
+inline DistanceFieldPyramidCheck CheckPyramidRadius(int3 size, int boxes = 4, int points = 1 << 14, unsigned int seed = 0) {
+	// xorshift32 (<random> can not be used with Windows min/max macros)
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto next = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	};
+	auto uniform = [&next]() {
+		return (next() >> 8) * (1.0f / 16777216.0f);
+	};
+
+	// Occupied boxes [lo, hi) in cells, x y z of lo then x y z of hi
+	int* bounds = new int[boxes * 6];
+	int sizes[3] = { size.x, size.y, size.z };
+	for (int b = 0; b < boxes; b++)
+	{
+		int slabAxis = b % 2 == 0 ? (int)(next() % 3) : -1;
+		for (int a = 0; a < 3; a++)
+		{
+			int extent = min(a == slabAxis || slabAxis == -1 ? 1 + (int)(next() % 2) : sizes[a], sizes[a]);
+			bounds[b * 6 + a] = extent == sizes[a] ? 0 : (int)(next() % (sizes[a] - extent + 1));
+			bounds[b * 6 + 3 + a] = bounds[b * 6 + a] + extent;
+		}
+	}
+
+	float* field = new float[(long long)size.x * size.y * size.z];
+	for (int z = 0; z < size.z; z++)
+		for (int y = 0; y < size.y; y++)
+			for (int x = 0; x < size.x; x++)
+			{
+				float value = 100000;
+				int cell[3] = { x, y, z };
+				for (int b = 0; b < boxes; b++)
+				{
+					// cells between the cell and the box along each axis, -1 inside
+					int gap = -1;
+					for (int a = 0; a < 3; a++)
+						gap = max(gap, max(bounds[b * 6 + a] - cell[a] - 1, cell[a] - bounds[b * 6 + 3 + a]));
+					value = minf(value, (float)gap);
+				}
+				field[x + (long long)size.x * (y + (long long)size.y * z)] = value;
+			}
+
+	DistanceFieldPyramid pyramid;
+	pyramid.Build(field, size);
+
+	DistanceFieldPyramidCheck check = { 0, 0, 0, 0 };
+	float3 gridSize = float3((float)size.x, (float)size.y, (float)size.z);
+	for (int p = 0; p < points; p++)
+	{
+		float3 P = float3(uniform(), uniform(), uniform()) * gridSize;
+		double exact = 1e30;
+		double position[3] = { P.x, P.y, P.z };
+		for (int b = 0; b < boxes; b++)
+		{
+			double squared = 0;
+			for (int a = 0; a < 3; a++)
+			{
+				double d = fmax(0.0, fmax(bounds[b * 6 + a] - position[a], position[a] - bounds[b * 6 + 3 + a]));
+				squared += d * d;
+			}
+			exact = fmin(exact, sqrt(squared));
+		}
+		float flat = pyramid.FlatRadius(P);
+		float radius = pyramid.Radius(P);
+		float excess = (float)(radius - exact);
+		if (excess > 1e-4f)
+			check.Overestimates++;
+		check.MaxExcess = maxf(check.MaxExcess, excess);
+		if (radius > flat)
+			check.Improved++;
+		check.Points++;
+	}
+
+	delete[] bounds;
+	delete[] field;
+	return check;
+}
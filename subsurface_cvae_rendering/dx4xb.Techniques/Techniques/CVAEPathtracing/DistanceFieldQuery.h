@@ -0,0 +1,321 @@
+#pragma once
+
+#include "dx4xb_math.h"
+#include <immintrin.h>
+#include "../CPU/Stopwatch.h"
+
+using namespace dx4xb;
+
+/// Queries of safe radii over a baked distance field (as stored by DistanceFieldCache or DistanceFieldBuilder).
+/// Positions and radii are in grid space (cells are unit cubes). The field is not owned.
+/// Semantics are the same used by the shaders: every cell expanded by its value is empty and occupied cells
+/// are negative. Geometry is inside the grid, so outside the grid the radius is the distance to the grid box.
+class DistanceFieldQuery {
+	const float* field = nullptr;
+	int3 size = int3(0, 0, 0);
+
+	inline float Value(int x, int y, int z) const {
+		return field[x + (long long)size.x * (y + (long long)size.y * z)];
+	}
+
+	// Distance from P to the grid box (0 inside).
+	inline float DistanceToGrid(float3 P) const {
+		float dx = maxf(0.0f, maxf(-P.x, P.x - size.x));
+		float dy = maxf(0.0f, maxf(-P.y, P.y - size.y));
+		float dz = maxf(0.0f, maxf(-P.z, P.z - size.z));
+		return sqrtf(dx * dx + dy * dy + dz * dz);
+	}
+
+	inline bool Inside(float3 P) const {
+		return P.x >= 0 && P.y >= 0 && P.z >= 0 && P.x < size.x && P.y < size.y && P.z < size.z;
+	}
+
+	// Safe radius at P given by the cell (x, y, z) only. Inside the cell it is the value plus the distance from P to the
+	// border of the cell, outside it is the value minus the (euclidean) distance from P to the cell, so the ball is always
+	// inside the cell expanded by its value. Cells are clamped to the grid. Used by the trilinear lookup, 0 if P is not
+	// inside the expanded cell.
+	inline float CellRadius(float3 P, int x, int y, int z) const {
+		x = max(0, min(size.x - 1, x));
+		y = max(0, min(size.y - 1, y));
+		z = max(0, min(size.z - 1, z));
+		float value = Value(x, y, z);
+		if (value < 0)
+			return 0;
+		float ox = maxf(0.0f, maxf(x - P.x, P.x - (x + 1)));
+		float oy = maxf(0.0f, maxf(y - P.y, P.y - (y + 1)));
+		float oz = maxf(0.0f, maxf(z - P.z, P.z - (z + 1)));
+		float outside = sqrtf(ox * ox + oy * oy + oz * oz);
+		if (outside > 0)
+			return maxf(0.0f, value - outside);
+		float rx = minf(P.x - x, x + 1 - P.x);
+		float ry = minf(P.y - y, y + 1 - P.y);
+		float rz = minf(P.z - z, z + 1 - P.z);
+		return value + minf(rx, minf(ry, rz));
+	}
+
+public:
+	DistanceFieldQuery() {}
+
+	DistanceFieldQuery(const float* field, int3 size) : field(field), size(size) {}
+
+	inline int3 Size() const { return size; }
+
+	// Safe radius using only the cell containing P (same as MaximalRadius in STBase_RT.h without the pyramid).
+	float Nearest(float3 P) const {
+		if (!Inside(P))
+			return DistanceToGrid(P);
+		int x = (int)P.x, y = (int)P.y, z = (int)P.z;
+		float value = Value(x, y, z);
+		if (value < 0) // no empty cell
+			return 0;
+		float3 m = minf(P - float3((float)x, (float)y, (float)z), float3((float)(x + 1), (float)(y + 1), (float)(z + 1)) - P);
+		return value + minf(m.x, minf(m.y, m.z));
+	}
+
+	// Conservative and continuous safe radius.
+	// Each of the 8 cells around P (by cell centers) gives a safe radius (CellRadius, a lower bound of the distance
+	// from P to the geometry also for the neighbour cells not containing P), and those radii are blended with the
+	// trilinear weights. A convex combination of lower bounds is never larger than the largest one, so the result is
+	// still safe.
+	float Trilinear(float3 P) const {
+		if (!Inside(P))
+			return DistanceToGrid(P);
+		float3 Q = P - float3(0.5f, 0.5f, 0.5f);
+		int x = (int)floorf(Q.x), y = (int)floorf(Q.y), z = (int)floorf(Q.z);
+		float fx = Q.x - x, fy = Q.y - y, fz = Q.z - z;
+
+		float c00 = lerp(CellRadius(P, x, y, z), CellRadius(P, x + 1, y, z), fx);
+		float c10 = lerp(CellRadius(P, x, y + 1, z), CellRadius(P, x + 1, y + 1, z), fx);
+		float c01 = lerp(CellRadius(P, x, y, z + 1), CellRadius(P, x + 1, y, z + 1), fx);
+		float c11 = lerp(CellRadius(P, x, y + 1, z + 1), CellRadius(P, x + 1, y + 1, z + 1), fx);
+		return lerp(lerp(c00, c10, fy), lerp(c01, c11, fy), fz);
+	}
+
+	// Gradient of the trilinear radius by central differences (h in cells).
+	// Points away from the geometry in empty space, it is zero inside occupied regions.
+	float3 Gradient(float3 P, float h = 0.25f) const {
+		return float3(
+			Trilinear(P + float3(h, 0, 0)) - Trilinear(P - float3(h, 0, 0)),
+			Trilinear(P + float3(0, h, 0)) - Trilinear(P - float3(0, h, 0)),
+			Trilinear(P + float3(0, 0, h)) - Trilinear(P - float3(0, 0, h))) * (0.5f / h);
+	}
+
+	// Moves P towards the closest geometry following the gradient, steps are the (safe) trilinear radius.
+	// Stops when the radius is less than epsilon, the gradient vanishes or after maxSteps. Returns the final radius.
+	// The field is conservative but not a true distance (adjacent cells can differ in several cells), so the gradient
+	// can lead to a ridge. Callers must check the returned radius; on success P is usually within half a cell of the surface.
+	float ProjectToSurface(float3& P, float epsilon = 0.01f, int maxSteps = 64) const {
+		float radius = Trilinear(P);
+		for (int step = 0; step < maxSteps && radius >= epsilon; step++)
+		{
+			float3 g = Gradient(P);
+			float l = length(g);
+			if (l < 1e-6f)
+				break;
+			P = P - g * (radius / l);
+			radius = Trilinear(P);
+		}
+		return radius;
+	}
+
+	// Nearest radii of 8 points given as structure of arrays.
+	void Nearest8(const float* x, const float* y, const float* z, float* radii) const {
+#if defined(__AVX2__)
+		__m256 px = _mm256_loadu_ps(x), py = _mm256_loadu_ps(y), pz = _mm256_loadu_ps(z);
+		__m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1);
+		__m256 sx = _mm256_set1_ps((float)size.x), sy = _mm256_set1_ps((float)size.y), sz = _mm256_set1_ps((float)size.z);
+
+		__m256 inside = _mm256_and_ps(
+			_mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(px, zero, _CMP_GE_OQ), _mm256_cmp_ps(py, zero, _CMP_GE_OQ)), _mm256_cmp_ps(pz, zero, _CMP_GE_OQ)),
+			_mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(px, sx, _CMP_LT_OQ), _mm256_cmp_ps(py, sy, _CMP_LT_OQ)), _mm256_cmp_ps(pz, sz, _CMP_LT_OQ)));
+
+		__m256 cx = _mm256_floor_ps(px), cy = _mm256_floor_ps(py), cz = _mm256_floor_ps(pz);
+		// Cells outside are clamped only to have a valid address, their lanes are masked
+		__m256i ix = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(cx, zero), _mm256_sub_ps(sx, one)));
+		__m256i iy = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(cy, zero), _mm256_sub_ps(sy, one)));
+		__m256i iz = _mm256_cvtps_epi32(_mm256_min_ps(_mm256_max_ps(cz, zero), _mm256_sub_ps(sz, one)));
+		__m256i index = _mm256_add_epi32(ix, _mm256_mullo_epi32(_mm256_set1_epi32(size.x),
+			_mm256_add_epi32(iy, _mm256_mullo_epi32(_mm256_set1_epi32(size.y), iz))));
+		__m256 value = _mm256_mask_i32gather_ps(zero, field, index, inside, 4);
+
+		__m256 fx = _mm256_sub_ps(px, cx), fy = _mm256_sub_ps(py, cy), fz = _mm256_sub_ps(pz, cz);
+		__m256 border = _mm256_min_ps(
+			_mm256_min_ps(_mm256_min_ps(fx, _mm256_sub_ps(one, fx)), _mm256_min_ps(fy, _mm256_sub_ps(one, fy))),
+			_mm256_min_ps(fz, _mm256_sub_ps(one, fz)));
+		__m256 radius = _mm256_and_ps(_mm256_add_ps(value, border), _mm256_cmp_ps(value, zero, _CMP_GE_OQ));
+
+		// Outside lanes, distance to the grid box
+		__m256 dx = _mm256_max_ps(zero, _mm256_max_ps(_mm256_sub_ps(zero, px), _mm256_sub_ps(px, sx)));
+		__m256 dy = _mm256_max_ps(zero, _mm256_max_ps(_mm256_sub_ps(zero, py), _mm256_sub_ps(py, sy)));
+		__m256 dz = _mm256_max_ps(zero, _mm256_max_ps(_mm256_sub_ps(zero, pz), _mm256_sub_ps(pz, sz)));
+		__m256 outside = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz)));
+
+		_mm256_storeu_ps(radii, _mm256_blendv_ps(outside, radius, inside));
+#else
+		for (int i = 0; i < 8; i++)
+			radii[i] = Nearest(float3(x[i], y[i], z[i]));
+#endif
+	}
+
+	// Trilinear radii of 8 points given as structure of arrays.
+	void Trilinear8(const float* x, const float* y, const float* z, float* radii) const {
+#if defined(__AVX2__)
+		__m256 px = _mm256_loadu_ps(x), py = _mm256_loadu_ps(y), pz = _mm256_loadu_ps(z);
+		__m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1), half = _mm256_set1_ps(0.5f);
+		__m256 sx = _mm256_set1_ps((float)size.x), sy = _mm256_set1_ps((float)size.y), sz = _mm256_set1_ps((float)size.z);
+		__m256 maxX = _mm256_sub_ps(sx, one), maxY = _mm256_sub_ps(sy, one), maxZ = _mm256_sub_ps(sz, one);
+
+		__m256 inside = _mm256_and_ps(
+			_mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(px, zero, _CMP_GE_OQ), _mm256_cmp_ps(py, zero, _CMP_GE_OQ)), _mm256_cmp_ps(pz, zero, _CMP_GE_OQ)),
+			_mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(px, sx, _CMP_LT_OQ), _mm256_cmp_ps(py, sy, _CMP_LT_OQ)), _mm256_cmp_ps(pz, sz, _CMP_LT_OQ)));
+
+		__m256 bx = _mm256_floor_ps(_mm256_sub_ps(px, half));
+		__m256 by = _mm256_floor_ps(_mm256_sub_ps(py, half));
+		__m256 bz = _mm256_floor_ps(_mm256_sub_ps(pz, half));
+		__m256 fx = _mm256_sub_ps(_mm256_sub_ps(px, half), bx);
+		__m256 fy = _mm256_sub_ps(_mm256_sub_ps(py, half), by);
+		__m256 fz = _mm256_sub_ps(_mm256_sub_ps(pz, half), bz);
+
+		__m256 result = zero;
+		for (int corner = 0; corner < 8; corner++)
+		{
+			// Cell of the corner clamped to the grid
+			__m256 cx = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(bx, _mm256_set1_ps((float)(corner & 1))), zero), maxX);
+			__m256 cy = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(by, _mm256_set1_ps((float)((corner >> 1) & 1))), zero), maxY);
+			__m256 cz = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(bz, _mm256_set1_ps((float)(corner >> 2))), zero), maxZ);
+			__m256i index = _mm256_add_epi32(_mm256_cvtps_epi32(cx), _mm256_mullo_epi32(_mm256_set1_epi32(size.x),
+				_mm256_add_epi32(_mm256_cvtps_epi32(cy), _mm256_mullo_epi32(_mm256_set1_epi32(size.y), _mm256_cvtps_epi32(cz)))));
+			__m256 value = _mm256_mask_i32gather_ps(zero, field, index, inside, 4);
+
+			// Value plus the distance to the border of the cell if P is inside, value minus the distance to the cell otherwise
+			__m256 ox = _mm256_max_ps(zero, _mm256_max_ps(_mm256_sub_ps(cx, px), _mm256_sub_ps(px, _mm256_add_ps(cx, one))));
+			__m256 oy = _mm256_max_ps(zero, _mm256_max_ps(_mm256_sub_ps(cy, py), _mm256_sub_ps(py, _mm256_add_ps(cy, one))));
+			__m256 oz = _mm256_max_ps(zero, _mm256_max_ps(_mm256_sub_ps(cz, pz), _mm256_sub_ps(pz, _mm256_add_ps(cz, one))));
+			__m256 distance = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ox, ox), _mm256_mul_ps(oy, oy)), _mm256_mul_ps(oz, oz)));
+			__m256 border = _mm256_min_ps(
+				_mm256_min_ps(
+					_mm256_min_ps(_mm256_sub_ps(px, cx), _mm256_sub_ps(_mm256_add_ps(cx, one), px)),
+					_mm256_min_ps(_mm256_sub_ps(py, cy), _mm256_sub_ps(_mm256_add_ps(cy, one), py))),
+				_mm256_min_ps(_mm256_sub_ps(pz, cz), _mm256_sub_ps(_mm256_add_ps(cz, one), pz)));
+			__m256 r = _mm256_blendv_ps(_mm256_add_ps(value, border), _mm256_sub_ps(value, distance),
+				_mm256_cmp_ps(distance, zero, _CMP_GT_OQ));
+			r = _mm256_max_ps(zero, r);
+			r = _mm256_and_ps(r, _mm256_cmp_ps(value, zero, _CMP_GE_OQ));
+
+			__m256 w = _mm256_mul_ps(
+				_mm256_mul_ps(corner & 1 ? fx : _mm256_sub_ps(one, fx), corner & 2 ? fy : _mm256_sub_ps(one, fy)),
+				corner & 4 ? fz : _mm256_sub_ps(one, fz));
+			result = _mm256_add_ps(result, _mm256_mul_ps(w, r));
+		}
+
+		__m256 dx = _mm256_max_ps(zero, _mm256_max_ps(_mm256_sub_ps(zero, px), _mm256_sub_ps(px, sx)));
+		__m256 dy = _mm256_max_ps(zero, _mm256_max_ps(_mm256_sub_ps(zero, py), _mm256_sub_ps(py, sy)));
+		__m256 dz = _mm256_max_ps(zero, _mm256_max_ps(_mm256_sub_ps(zero, pz), _mm256_sub_ps(pz, sz)));
+		__m256 outside = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy)), _mm256_mul_ps(dz, dz)));
+
+		_mm256_storeu_ps(radii, _mm256_blendv_ps(outside, result, inside));
+#else
+		for (int i = 0; i < 8; i++)
+			radii[i] = Trilinear(float3(x[i], y[i], z[i]));
+#endif
+	}
+};
+
+// Result of the query benchmark, in millions of queries per second.
+struct DistanceFieldQueryBenchmark {
+	int Queries;
+	float NearestRandom, NearestCoherent;
+	float TrilinearRandom, TrilinearCoherent;
+	float Nearest8Random, Nearest8Coherent;
+	float Trilinear8Random, Trilinear8Coherent;
+};
+
+/// Measures the query throughput of a field with random points (uniform in the grid) and coherent points
+/// (consecutive points along random rays with small steps, as in sphere tracing).
+inline DistanceFieldQueryBenchmark BenchmarkDistanceFieldQueries(const DistanceFieldQuery& query, int queries = 1 << 20, unsigned int seed = 0) {
+	// xorshift32 (<random> can not be used with Windows min/max macros)
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto uniform = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	queries = (queries + 7) & ~7;
+	int3 size = query.Size();
+	float3 gridSize = float3((float)size.x, (float)size.y, (float)size.z);
+
+	// Points stored as structure of arrays for the batched queries
+	float* points[2][3];
+	for (int set = 0; set < 2; set++)
+		for (int axis = 0; axis < 3; axis++)
+			points[set][axis] = new float[queries];
+
+	for (int i = 0; i < queries; i++)
+	{
+		float3 P = float3(uniform(), uniform(), uniform()) * gridSize;
+		points[0][0][i] = P.x; points[0][1][i] = P.y; points[0][2][i] = P.z;
+	}
+	float3 P = float3(0, 0, 0), D = float3(0, 0, 0);
+	for (int i = 0; i < queries; i++)
+	{
+		if (i % 64 == 0 || P.x < 0 || P.y < 0 || P.z < 0 || P.x >= gridSize.x || P.y >= gridSize.y || P.z >= gridSize.z)
+		{ // new ray
+			P = float3(uniform(), uniform(), uniform()) * gridSize;
+			float z = 1 - 2 * uniform();
+			float r = sqrtf(maxf(0.0f, 1 - z * z));
+			float phi = 2 * 3.14159265f * uniform();
+			D = float3(r * cosf(phi), r * sinf(phi), z) * 0.25f;
+		}
+		points[1][0][i] = P.x; points[1][1][i] = P.y; points[1][2][i] = P.z;
+		P = P + D;
+	}
+
+	float* radii = new float[queries];
+	volatile float sink = 0;
+	float rates[8];
+	for (int test = 0; test < 8; test++)
+	{
+		int set = test % 2;
+		const float* x = points[set][0];
+		const float* y = points[set][1];
+		const float* z = points[set][2];
+
+		Stopwatch stopwatch;
+		switch (test / 2) {
+		case 0:
+			for (int i = 0; i < queries; i++)
+				radii[i] = query.Nearest(float3(x[i], y[i], z[i]));
+			break;
+		case 1:
+			for (int i = 0; i < queries; i++)
+				radii[i] = query.Trilinear(float3(x[i], y[i], z[i]));
+			break;
+		case 2:
+			for (int i = 0; i < queries; i += 8)
+				query.Nearest8(x + i, y + i, z + i, radii + i);
+			break;
+		case 3:
+			for (int i = 0; i < queries; i += 8)
+				query.Trilinear8(x + i, y + i, z + i, radii + i);
+			break;
+		}
+		float milliseconds = stopwatch.Milliseconds();
+		sink = sink + radii[queries - 1];
+		rates[test] = milliseconds > 0 ? queries / (milliseconds * 1000.0f) : 0;
+	}
+
+	DistanceFieldQueryBenchmark result;
+	result.Queries = queries;
+	result.NearestRandom = rates[0]; result.NearestCoherent = rates[1];
+	result.TrilinearRandom = rates[2]; result.TrilinearCoherent = rates[3];
+	result.Nearest8Random = rates[4]; result.Nearest8Coherent = rates[5];
+	result.Trilinear8Random = rates[6]; result.Trilinear8Coherent = rates[7];
+
+	for (int set = 0; set < 2; set++)
+		for (int axis = 0; axis < 3; axis++)
+			delete[] points[set][axis];
+	delete[] radii;
+	return result;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "DistanceFieldBuilder.h"
+#include "DistanceFieldQuery.h"
+
+/// Radii of the queries of the field of an ellipsoid against the distances to its triangles,
+/// and the batched queries against the single ones.
+struct DistanceFieldQueryCheck {
+	int Points;
+	// Points whose radius is larger than the distance to the mesh (and the largest excess) for each query
+	int NearestOverestimates;
+	int TrilinearOverestimates;
+	int Trilinear8Overestimates;
+	float MaxExcess;
+	// Largest difference between Nearest8 and Nearest, and between Trilinear8 and Trilinear
+	float Nearest8Difference;
+	float Trilinear8Difference;
+};
+
+inline DistanceFieldQueryCheck CheckDistanceFieldQueries(int resolution = 32, int points = 1 << 13, unsigned int seed = 0) {
+	// xorshift32 (<random> can not be used with Windows min/max macros)
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto uniform = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	EllipsoidMesh mesh(float3(0.5f, 0.35f, 0.25f), 64, 32);
+	int3 size = int3(0, 0, 0);
+	float4x4 toGrid = mesh.GridTransform(resolution, size);
+	DistanceFieldBuilder builder;
+	builder.Build(mesh.Positions, mesh.Indices, mesh.TriangleCount, toGrid, size);
+	DistanceFieldQuery query(builder.Field, size);
+
+	float3* triangles = new float3[mesh.TriangleCount * 3];
+	for (int i = 0; i < mesh.TriangleCount * 3; i++)
+	{
+		float3 P = mesh.Positions[mesh.Indices[i]];
+		triangles[i] = mul(float4(P.x, P.y, P.z, 1), toGrid).get_xyz();
+	}
+
+	// Points uniform in the grid expanded by two cells (the lanes of a batch mix inside and outside points),
+	// and every other batch points within two cells of a vertex, where the radii are small and close to the distance
+	points = (points + 7) & ~7;
+	float3 lo = float3(-2, -2, -2), extent = float3((float)size.x + 4, (float)size.y + 4, (float)size.z + 4);
+	DistanceFieldQueryCheck check = {};
+	check.Points = points;
+	for (int batch = 0; batch < points; batch += 8)
+	{
+		float x[8], y[8], z[8], nearest8[8], trilinear8[8];
+		for (int i = 0; i < 8; i++)
+		{
+			float3 P = batch % 16 == 0 ?
+				lo + float3(uniform(), uniform(), uniform()) * extent :
+				triangles[(int)(uniform() * mesh.TriangleCount * 3)] + float3(uniform(), uniform(), uniform()) * 4 - float3(2, 2, 2);
+			x[i] = P.x; y[i] = P.y; z[i] = P.z;
+		}
+		query.Nearest8(x, y, z, nearest8);
+		query.Trilinear8(x, y, z, trilinear8);
+
+		for (int i = 0; i < 8; i++)
+		{
+			float3 P = float3(x[i], y[i], z[i]);
+			float nearest = query.Nearest(P);
+			float trilinear = query.Trilinear(P);
+			check.Nearest8Difference = maxf(check.Nearest8Difference, fabsf(nearest8[i] - nearest));
+			check.Trilinear8Difference = maxf(check.Trilinear8Difference, fabsf(trilinear8[i] - trilinear));
+
+			// only triangles whose box is closer than the largest radius can be closer than a radius
+			float largest = maxf(maxf(nearest, nearest8[i]), maxf(trilinear, trilinear8[i]));
+			float distance = 1000000;
+			for (int t = 0; t < mesh.TriangleCount; t++)
+			{
+				const float3* T = triangles + t * 3;
+				float3 gap = maxf(float3(0, 0, 0), maxf(minf(T[0], minf(T[1], T[2])) - P, P - maxf(T[0], maxf(T[1], T[2]))));
+				if (length(gap) <= largest)
+					distance = minf(distance, distanceP2T(P, T[0], T[1], T[2]));
+			}
+			check.NearestOverestimates += nearest > distance + 1e-4f;
+			check.TrilinearOverestimates += trilinear > distance + 1e-4f;
+			check.Trilinear8Overestimates += trilinear8[i] > distance + 1e-4f;
+			check.MaxExcess = maxf(check.MaxExcess, maxf(nearest, maxf(trilinear, trilinear8[i])) - distance);
+		}
+	}
+	delete[] triangles;
+	return check;
+}
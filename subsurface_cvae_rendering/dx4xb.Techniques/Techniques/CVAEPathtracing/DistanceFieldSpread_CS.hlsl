@@ -9,18 +9,20 @@ RWTexture3D<float>		GridDst : register(u0);
 
 cbuffer LevelInfo : register(b0) {
 	int Level;
+	// Resolution of the grid (the temporal grid can be larger)
+	int3 Size;
 }
 
 [numthreads(1024, 1, 1)]
 void main(uint3 DTid : SV_DispatchThreadID)
 {
-	uint Size, height, depth;
-	GridSrc.GetDimensions(Size, height, depth);
+	if (DTid.x >= (uint)(Size.x * Size.y * Size.z))
+		return;
 
 	/// for each cell consider the distances in adjacent cells at specific distance (depending on the level)
 	/// If all distances are greater than the required distance to spread, the new distance is updated.
 
-	int3 currentCell = int3(DTid.x % Size, DTid.x / Size % Size, DTid.x / (Size * Size));
+	int3 currentCell = int3(DTid.x % Size.x, DTid.x / Size.x % Size.y, DTid.x / (Size.x * Size.y));
 
 	int Radius = (int)round(pow(3, Level));
 	float RequiredDistance = (Radius - 1) * 0.5;
@@ -1,13 +1,13 @@
 #pragma once
 
-#include "SphereTracingBase.h"
+#include "CVAETechniqueBase.h"
 
-class NEECVAEPathtracingTechnique : public SphereTracingBase {
+class NEECVAEPathtracingTechnique : public CVAETechniqueBase {
 
 public:
 	~NEECVAEPathtracingTechnique() {}
 
-	struct NEECVAEPathtracing : public STPathtracingPipeline {
+	struct NEECVAEPathtracing : public CVAEPipeline {
 		virtual const char* ShaderFile() {
 			return "./Techniques/CVAEPathtracing/NEECVAEPathtracing_RT.cso";
 		}
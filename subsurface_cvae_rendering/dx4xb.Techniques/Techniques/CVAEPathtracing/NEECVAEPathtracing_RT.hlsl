@@ -1,7 +1,11 @@
 #include "STBase_RT.h"
 
+#ifdef USE_CVAE_MODEL_BUFFER
+#include "CVAEModelBuffer_RT.h"
+#else
 //#include "CVAEScatteringModel.h"
 #include "CVAEScatteringModelX.h"
+#endif
 
 float sampleNormal(float mu, float logVar) {
 	//return mu + gauss() * exp(logVar * 0.5);
@@ -12,6 +12,40 @@ struct GridInfo {
 StructuredBuffer<GridInfo> GridInfos : register(t1);
 Texture3D<float> DistanceField[100] : register(t2);
 
+#ifdef USE_DF_PYRAMID
+/// Improves a safe radius (grid space) with the coarser levels of the min-pyramid stored in the mips of the field.
+/// A level k cell is the minimum of its 2^k block, so the block expanded by that value is empty.
+/// See DistanceFieldPyramid.h
+float PyramidRadius(int grid, float3 positionInGrid, float radius) {
+	uint width, height, depth, levels;
+	DistanceField[grid].GetDimensions(0, width, height, depth, levels);
+	int3 size = int3(width, height, depth);
+	int3 cell0 = int3(floor(positionInGrid));
+	if (any(cell0 < 0) || any(cell0 >= size))
+		return radius;
+
+	[loop]
+	for (uint k = 1; k < levels; k++)
+	{
+		if (any((size >> k) == 0)) // clamped mip, its cells cover less than their 2^k block
+			break;
+		uint w, h, d, l;
+		DistanceField[grid].GetDimensions(k, w, h, d, l);
+		int3 cell = cell0 >> k;
+		if (any(cell >= int3(w, h, d)))
+			break;
+		float value = DistanceField[grid].mips[k][cell];
+		if (value < 0) // occupied block, coarser levels are occupied too
+			break;
+		float3 lo = cell << k;
+		float3 hi = lo + (1 << k);
+		float3 m = min(positionInGrid - lo, hi - positionInGrid);
+		radius = max(radius, value + min(m.x, min(m.y, m.z)));
+	}
+	return radius;
+}
+#endif
+
 /// Query the distance field grid.
 float MaximalRadius(float3 P, int object) {
 
@@ -27,6 +61,9 @@ float MaximalRadius(float3 P, int object) {
 	float minDistanceToCellBorder = min(m.x, min(m.y, m.z));
 	//float safeDistanceInGridSpace = radius;
 	float safeDistanceInGridSpace = minDistanceToCellBorder + radius;
+#ifdef USE_DF_PYRAMID
+	safeDistanceInGridSpace = PyramidRadius(info.GridIndex, positionInGrid, safeDistanceInGridSpace);
+#endif
 	return safeDistanceInGridSpace * info.FromGridToWorldScaling;
 }
 
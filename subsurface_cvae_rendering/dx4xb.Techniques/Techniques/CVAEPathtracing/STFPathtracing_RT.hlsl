@@ -18,17 +18,35 @@
 // Theta [0,pi] linear in cos(theta)
 #define BINS_THETA 45
 
-#define STRIDE_G (BINS_SA * BINS_R * BINS_THETA)
-#define STRIDE_SA (BINS_R * BINS_THETA)
+// Slots of resident (g, phi) pages of the tables (STF_PAGE_SLOTS in STFTechnique.h)
+#define PAGE_SLOTS 1024
+
+#define STRIDE_PAGE (BINS_R * BINS_THETA)
 #define STRIDE_R (BINS_THETA)
 
 // Shell Transport Function used as PDF of the outgoing position
 // The STF is storing actually the empirical cdf(x | g, phi, r)
+// Tables are stored by resident pages of (g, phi) [slot, r, theta]
 StructuredBuffer<float> STF						: register(t0, space2);
-// [r, phi, g] -> s^1
+// [slot, r] -> s^1
 StructuredBuffer<float> OnceTimeScatteringAlbedo : register(t1, space2);
-// [r, phi, g] -> s^m
+// [slot, r] -> s^m
 StructuredBuffer<float> MultipleTimeScatteringAlbedo : register(t2, space2);
+// [g, phi] -> slot of the page in the tables, -1 if the page is not resident
+StructuredBuffer<int> PageTable					: register(t3, space2);
+
+// Phi maps linearly in log(1 / (1 - phi)) from 0 to 0.999 over a number of bins that differs per sampler,
+// phi above 0.999 is the last bin (STF_PHI_BINS in STFTechnique.h must match the sampler used)
+#define PHI_BINS_SampleCosXAndW (BINS_SA - 2)
+#define PHI_BINS_SampleCosXAndW2 (BINS_SA - 1)
+
+// Slot of the page of the tables for g and phi with the phi mapping of a sampler.
+int PageSlot(float g, float phi, int phiBins) {
+	int phiBin = phi > 0.999 ? BINS_SA - 1 :
+		(log(1 / (1 - phi))) * phiBins / (log(1 / 0.001));
+	int gBin = min((g * 0.5 + 0.5) * BINS_G, BINS_G - 1);
+	return PageTable[gBin * BINS_SA + phiBin];
+}
 
 float DistanceToSphereBoundary(float3 x, float3 w)
 {
@@ -119,15 +137,13 @@ bool SampleCosXAndW2(float g, float phi, float r, out float theta, out float bet
 	rBin += (random() < r / (1 << rBin) - 1); // better than interpolate beteen logR and logR+1
 	//int rBin = (int)logR + (random() < (logR % 1)); // better than interpolate beteen logR and logR+1
 
-	int phiBin = phi > 0.999 ? BINS_SA - 1 :
-		(log(1 / (1 - phi))) * (BINS_SA - 1) / (log(1 / 0.001));
-	int gBin = min((g * 0.5 + 0.5) * BINS_G, BINS_G - 1);
-	int offsetInSTFTable = rBin * STRIDE_R + phiBin * STRIDE_SA + gBin * STRIDE_G;
+	int slot = PageSlot(g, phi, PHI_BINS_SampleCosXAndW2);
+	int offsetInSTFTable = rBin * STRIDE_R + slot * STRIDE_PAGE;
 
 	float selectingCase = random();
-	float prob1Scat = OnceTimeScatteringAlbedo[gBin * (BINS_SA * BINS_R) + phiBin * BINS_R + rBin];
+	float prob1Scat = OnceTimeScatteringAlbedo[slot * BINS_R + rBin];
 	//float prob1Scat = OnceTimeScatteringAlbedo[uint3(rBin, phiBin, gBin)];
-	float probmScat = MultipleTimeScatteringAlbedo[gBin * (BINS_SA * BINS_R) + phiBin * BINS_R + rBin];
+	float probmScat = MultipleTimeScatteringAlbedo[slot * BINS_R + rBin];
 	//float probmScat = MultipleTimeScatteringAlbedo[uint3(rBin, phiBin, gBin)];
 
 	if (selectingCase * (1 - exp(-r) - prob1Scat) < probmScat) {
@@ -198,16 +214,14 @@ bool SampleCosXAndW(float g, float phi, float r, out float theta, out float beta
 	rBin += (random() < (logR % 1)); // better than interpolate beteen logR and logR+1
 	r = pow(2.0, rBin);
 
-	int phiBin = phi > 0.999 ? BINS_SA - 1 :
-		(log(1 / (1 - phi))) * (BINS_SA - 2) / (log(1 / 0.001));
-	int gBin = min((g * 0.5 + 0.5) * BINS_G, BINS_G - 1);
-	int offsetInSTFTable = rBin * STRIDE_R + phiBin * STRIDE_SA + gBin * STRIDE_G;
+	int slot = PageSlot(g, phi, PHI_BINS_SampleCosXAndW);
+	int offsetInSTFTable = rBin * STRIDE_R + slot * STRIDE_PAGE;
 
 	float selectingCase = random();
 	float prob0Scat = exp(-r);
-	float prob1Scat = OnceTimeScatteringAlbedo[gBin*(BINS_SA * BINS_R) + phiBin * BINS_R + rBin];
+	float prob1Scat = OnceTimeScatteringAlbedo[slot * BINS_R + rBin];
 	//float prob1Scat = OnceTimeScatteringAlbedo[uint3(rBin, phiBin, gBin)];
-	float probmScat = MultipleTimeScatteringAlbedo[gBin * (BINS_SA * BINS_R) + phiBin * BINS_R + rBin];
+	float probmScat = MultipleTimeScatteringAlbedo[slot * BINS_R + rBin];
 	//float probmScat = MultipleTimeScatteringAlbedo[uint3(rBin, phiBin, gBin)];
 
 	if (selectingCase < prob0Scat) // no scattering
@@ -386,7 +400,8 @@ float3 ComputePath(float3 O, float3 D, inout int complexity)
 
 				float er = volMaterial.Extinction[cmp] * r;
 
-				if (er >= 1)
+				// media without resident tables are pathtraced (bins of the sampler in GenerateVariablesWithTable)
+				if (er >= 1 && PageSlot(volMaterial.G[cmp], volMaterial.ScatteringAlbedo[cmp], PHI_BINS_SampleCosXAndW) >= 0)
 				{
 					while (er >= 1) {
 						er = min(er, 256);
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "SphereTracingBase.h"
+#include "TableLoading.h"
+#include "TablePaging.h"
 
 // HG factor [-1,1] linear
 #define BINS_G 200
@@ -14,11 +16,25 @@
 // Theta [0,pi] linear in cos(theta)
 #define BINS_THETA 45
 
+// Phi bins of the sampler used by STFPathtracing_RT.hlsl (PHI_BINS_SampleCosXAndW), BINS_SA - 1 for SampleCosXAndW2
+#define STF_PHI_BINS (BINS_SA - 2)
+
+// Slots of resident (g, phi) pages of the tables (PAGE_SLOTS in STFPathtracing_RT.hlsl)
+#define STF_PAGE_SLOTS 1024
+
 class STFTechnique : public SphereTracingBase {
 
 public:
 	~STFTechnique() {}
 
+	// Cost of loading the tables in OnLoad
+	TableLoadStatistics Tables = {};
+
+	// Residency of the (g, phi) pages of the tables, the pages reachable from the volume materials are
+	// loaded from the mapped table when the materials change
+	TablePageCache Pages;
+	MappedFile Table;
+
 	struct STFPathtracing : public STPathtracingPipeline {
 
 		struct Program : public STPathtracingPipeline::Program {
@@ -31,6 +47,7 @@ public:
 				binder->SRV(0, Context().Dynamic_Cast<STFPathtracing>()->STF);
 				binder->SRV(1, Context().Dynamic_Cast<STFPathtracing>()->OneTimeSA);
 				binder->SRV(2, Context().Dynamic_Cast<STFPathtracing>()->MultiTimeSA);
+				binder->SRV(3, Context().Dynamic_Cast<STFPathtracing>()->PageTable);
 			}
 		};
 
@@ -46,6 +63,8 @@ public:
 		gObj<Buffer> STF;
 		gObj<Buffer> OneTimeSA;
 		gObj<Buffer> MultiTimeSA;
+		// Slot of every (g, phi) page
+		gObj<Buffer> PageTable;
 	};
 
 	virtual void CreatePipeline(gObj<RTXPathtracingPipelineBase>& pipeline)
@@ -62,38 +81,69 @@ public:
 
 		auto pipeline = this->pipeline.Dynamic_Cast<STFPathtracing>();
 
-		// Creating TABLES
-		pipeline->STF = CreateBufferSRV<float>(BINS_G * BINS_SA * BINS_R * BINS_THETA);
-		pipeline->OneTimeSA = CreateBufferSRV<float>(BINS_R * BINS_SA * BINS_G);
-		pipeline->MultiTimeSA = CreateBufferSRV<float>(BINS_R * BINS_SA * BINS_G);
+		// Creating TABLES, slots of [r][theta] and [r] pages
+		pipeline->STF = CreateBufferSRV<float>(STF_PAGE_SLOTS * BINS_R * BINS_THETA);
+		pipeline->OneTimeSA = CreateBufferSRV<float>(STF_PAGE_SLOTS * BINS_R);
+		pipeline->MultiTimeSA = CreateBufferSRV<float>(STF_PAGE_SLOTS * BINS_R);
+		pipeline->PageTable = CreateBufferSRV<int>(BINS_G * BINS_SA);
+		Pages.Create(BINS_G * BINS_SA, STF_PAGE_SLOTS);
 
-		FILE* stfFile;
-		errno_t err;
-		if (err = fopen_s(&stfFile, "stf2.bin", "rb"))
-		{
-			return;
-		}
+		Stopwatch stopwatch;
 
-		float* tempSTable = new float[BINS_G * BINS_SA * BINS_R];
-		fread((void*)tempSTable, 4, BINS_G * BINS_SA * BINS_R, stfFile);
-		pipeline->OneTimeSA->Write(tempSTable);
-		fread((void*)tempSTable, 4, BINS_G * BINS_SA * BINS_R, stfFile);
-		pipeline->MultiTimeSA->Write(tempSTable);
-		delete[] tempSTable;
-		tempSTable = new float[BINS_G * BINS_SA * BINS_R * BINS_THETA];
-		fread((void*)tempSTable, 4, BINS_G * BINS_SA * BINS_R * BINS_THETA, stfFile);
-		pipeline->STF->Write(tempSTable);
-		delete[] tempSTable;
+		// Without the table no page is resident and the media are pathtraced
+		Tables.Loaded = Table.Open("stf2.bin") &&
+			Table.Size() >= (unsigned long long)BINS_G * BINS_SA * BINS_R * (BINS_THETA + 2) * sizeof(float);
+		if (!Tables.Loaded)
+			Table.Close();
 
 		Execute_OnGPU(LoadTables);
 
+		Tables.TotalMilliseconds = stopwatch.Milliseconds();
+		Tables.Memory = MeasureProcessMemory();
+
 #pragma endregion
 	}
 
 	void LoadTables(gObj<GraphicsManager> manager) {
+		UpdatePages(manager);
+	}
+
+	// Loads the pages reachable from the volume materials that are not resident.
+	void UpdatePages(gObj<GraphicsManager> manager) {
+		auto pipeline = this->pipeline.Dynamic_Cast<STFPathtracing>();
+		auto desc = scene->getScene();
+
+		list<int> reachable;
+		if (Table.IsOpen())
+			ReachableSTFPages(desc->VolumeMaterials().Data, desc->VolumeMaterials().Count, BINS_G, BINS_SA, STF_PHI_BINS, reachable);
+		list<TablePageLoad> loads;
+		Pages.Require(reachable, loads);
+		Tables.MissingPages = Pages.Missing();
+		if (Pages.Missing() > 0)
+			ReportMissingPages("STFTechnique", Pages.Missing(), reachable.size(), STF_PAGE_SLOTS);
+
+		Stopwatch stopwatch;
+		unsigned long long albedos = (unsigned long long)BINS_G * BINS_SA * BINS_R;
+		const float* data = Table.As<float>();
+		for (int i = 0; i < loads.size(); i++)
+		{
+			unsigned long long page = loads[i].Page;
+			LoadTablePage(manager, pipeline->OneTimeSA, data + page * BINS_R, loads[i].Slot, BINS_R);
+			LoadTablePage(manager, pipeline->MultiTimeSA, data + albedos + page * BINS_R, loads[i].Slot, BINS_R);
+			LoadTablePage(manager, pipeline->STF, data + 2 * albedos + page * BINS_R * BINS_THETA, loads[i].Slot, BINS_R * BINS_THETA);
+			Tables.Bytes += BINS_R * (BINS_THETA + 2) * sizeof(float);
+		}
+		Tables.ReadMilliseconds += stopwatch.Milliseconds();
+		pipeline->PageTable->Write((int*)Pages.PageTable());
+		manager->ToGPU(pipeline->PageTable);
+	}
+
+	void UpdateBuffers(gObj<GraphicsManager> manager, SceneElement elements) {
+		SphereTracingBase::UpdateBuffers(manager, elements);
+
+		// The tables are created after the first update in OnLoad
 		auto pipeline = this->pipeline.Dynamic_Cast<STFPathtracing>();
-		manager->ToGPU(pipeline->STF);
-		manager->ToGPU(pipeline->OneTimeSA);
-		manager->ToGPU(pipeline->MultiTimeSA);
+		if (+(elements & SceneElement::Materials) && pipeline->PageTable)
+			UpdatePages(manager);
 	}
 };
\ No newline at end of file
@@ -29,6 +29,9 @@
 #define XW_R_STRIDE (BINS_LOGN * BINS_X)
 #define XW_LOGN_STRIDE (BINS_X)
 
+// Slots of resident g pages of the tables (STFX_PAGE_SLOTS in STFXTechnique.h)
+#define PAGE_SLOTS 16
+
 // PDF of the number of scatters
 // The table is storing actually the empirical cdf(logN | g, r)
 StructuredBuffer<float> CDF_LogN					: register(t0, space2);
@@ -37,6 +40,14 @@ StructuredBuffer<float> CDF_LogN					: register(t0, space2);
 // The table is split in two tables to allow more than 2G memory table
 StructuredBuffer<float> CDF_XW_L					: register(t1, space2);
 StructuredBuffer<float> CDF_XW_H					: register(t2, space2);
+// Tables are stored by resident pages of g, [g] -> slot of the page in the tables, -1 if the page is not resident
+StructuredBuffer<int> PageTable					: register(t3, space2);
+
+// Slot of the page of the tables used by SampleCosXAndW for g.
+int PageSlot(float g) {
+	int gBin = min((g * 0.5 + 0.5) * BINS_G, BINS_G - 1);
+	return PageTable[gBin];
+}
 
 int SearchBin(StructuredBuffer<float> cdf, int beg, int end, float value) {
 	while (beg < end) {
@@ -63,10 +74,10 @@ bool SampleCosXAndW(float g, float phi, float r, out float theta, out float beta
 		rBin = logR;
 		rBin += random() < (logR % 1);
 	}
-	int gBin = min((g * 0.5 + 0.5) * BINS_G, BINS_G - 1);
+	int slot = PageSlot(g);
 
 	// Get the logN from the table
-	int startPoslogNPos = gBin * LOGN_G_STRIDE + rBin * LOGN_R_STRIDE;
+	int startPoslogNPos = slot * LOGN_G_STRIDE + rBin * LOGN_R_STRIDE;
 	int selectedLogNBin = SearchBin(CDF_LogN, startPoslogNPos, startPoslogNPos + BINS_LOGN - 1, random()) - startPoslogNPos;
 	float logN = 8.0 * (selectedLogNBin + random()) / BINS_LOGN;
 
@@ -85,10 +96,10 @@ bool SampleCosXAndW(float g, float phi, float r, out float theta, out float beta
 	return true;*/
 
 	bool sampleLow = true;
-	if (startPoslogNPos >= BINS_G * BINS_R * BINS_LOGN / 2) // Sampling from high density pdfs
+	if (startPoslogNPos >= PAGE_SLOTS * BINS_R * BINS_LOGN / 2) // Sampling from the second half of the slots
 	{
 		sampleLow = false;
-		startPoslogNPos -= BINS_G * BINS_R * BINS_LOGN / 2; // Move the ptr respect to the second buffer.
+		startPoslogNPos -= PAGE_SLOTS * BINS_R * BINS_LOGN / 2; // Move the ptr respect to the second buffer.
 	}
 
 	int startxwPos = (startPoslogNPos + selectedLogNBin) * BINS_X;
@@ -210,7 +221,8 @@ float3 ComputePath(float3 O, float3 D, inout int complexity)
 
 				float er = volMaterial.Extinction[cmp] * r;
 
-				if (er >= 1) {
+				// media without resident tables are pathtraced
+				if (er >= 1 && PageSlot(volMaterial.G[cmp]) >= 0) {
 					er = min(er, 64);
 
 					float3 _x, _w, _X, _W;
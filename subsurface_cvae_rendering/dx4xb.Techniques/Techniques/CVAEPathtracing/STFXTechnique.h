@@ -1,6 +1,8 @@
 #pragma once
 
 #include "SphereTracingBase.h"
+#include "TableLoading.h"
+#include "TablePaging.h"
 
 // HG factor [-1,1] linear
 #define BINS_G 100
@@ -18,11 +20,22 @@
 #define BINS_ALPHA 10
 #define BINS_X (BINS_THETA * BINS_BETA * BINS_ALPHA)
 
+// Slots of resident g pages of the tables (PAGE_SLOTS in STFXPathtracing_RT.hlsl), half in each exit table
+#define STFX_PAGE_SLOTS 16
+
 class STFXTechnique : public SphereTracingBase {
 
 public:
 	~STFXTechnique() {}
 
+	// Cost of loading the tables in OnLoad
+	TableLoadStatistics Tables = {};
+
+	// Residency of the g pages of the tables, the pages reachable from the volume materials are
+	// loaded from the mapped table when the materials change
+	TablePageCache Pages;
+	MappedFile Table;
+
 	struct STFXPathtracing : public STPathtracingPipeline {
 
 		struct Program : public STPathtracingPipeline::Program {
@@ -35,6 +48,7 @@ public:
 				binder->SRV(0, Context().Dynamic_Cast<STFXPathtracing>()->CDF_LogN);
 				binder->SRV(1, Context().Dynamic_Cast<STFXPathtracing>()->CDF_XW_L);
 				binder->SRV(2, Context().Dynamic_Cast<STFXPathtracing>()->CDF_XW_H);
+				binder->SRV(3, Context().Dynamic_Cast<STFXPathtracing>()->PageTable);
 			}
 		};
 
@@ -50,6 +64,8 @@ public:
 		gObj<Buffer> CDF_LogN;
 		gObj<Buffer> CDF_XW_L;
 		gObj<Buffer> CDF_XW_H;
+		// Slot of every g page
+		gObj<Buffer> PageTable;
 	};
 
 	virtual void CreatePipeline(gObj<RTXPathtracingPipelineBase>& pipeline)
@@ -66,41 +82,73 @@ public:
 
 #pragma region Load Table Data from File
 
-		// Creating TABLES
-		pipeline->CDF_LogN = CreateBufferSRV<float>(BINS_G * BINS_R * BINS_LOGN);
-		pipeline->CDF_XW_L = CreateBufferSRV<float>(BINS_G * BINS_R * BINS_LOGN * BINS_X / 2); // Spliting 2.7 GB in two tables
-		pipeline->CDF_XW_H = CreateBufferSRV<float>(BINS_G * BINS_R * BINS_LOGN * BINS_X / 2);
+		// Creating TABLES, slots of [r][logN] and [r][logN][x] pages
+		pipeline->CDF_LogN = CreateBufferSRV<float>(STFX_PAGE_SLOTS * BINS_R * BINS_LOGN);
+		pipeline->CDF_XW_L = CreateBufferSRV<float>(STFX_PAGE_SLOTS * BINS_R * BINS_LOGN * BINS_X / 2); // Spliting the slots in two tables
+		pipeline->CDF_XW_H = CreateBufferSRV<float>(STFX_PAGE_SLOTS * BINS_R * BINS_LOGN * BINS_X / 2);
+		pipeline->PageTable = CreateBufferSRV<int>(BINS_G);
+		Pages.Create(BINS_G, STFX_PAGE_SLOTS);
 
-		FILE* stfFile;
-		errno_t err;
-		if (err = fopen_s(&stfFile, "stfx.bin", "rb"))
-		{
-			return;
-		}
-
-		float* tempSTable = new float[BINS_G * BINS_R * BINS_LOGN];
-		fread((void*)tempSTable, 4, BINS_G * BINS_R * BINS_LOGN, stfFile);
-		pipeline->CDF_LogN->Write(tempSTable);
-		delete tempSTable;
+		Stopwatch stopwatch;
 
-		tempSTable = new float[BINS_G * BINS_R * BINS_LOGN * BINS_X / 2];
-		fread((void*)tempSTable, 4, BINS_G * BINS_R * BINS_LOGN * BINS_X / 2, stfFile);
-		pipeline->CDF_XW_L->Write(tempSTable);
-		fread((void*)tempSTable, 4, BINS_G * BINS_R * BINS_LOGN * BINS_X / 2, stfFile);
-		pipeline->CDF_XW_H->Write(tempSTable);
-		delete[] tempSTable;
+		// Without the table no page is resident and the media are pathtraced
+		Tables.Loaded = Table.Open("stfx.bin") &&
+			Table.Size() >= (unsigned long long)BINS_G * BINS_R * BINS_LOGN * (BINS_X + 1) * sizeof(float);
+		if (!Tables.Loaded)
+			Table.Close();
 
 #pragma endregion
 
 		Execute_OnGPU(LoadTables);
+
+		Tables.TotalMilliseconds = stopwatch.Milliseconds();
+		Tables.Memory = MeasureProcessMemory();
 	}
 
 	void LoadTables(gObj<GraphicsManager> manager) {
+		UpdatePages(manager);
+	}
 
+	// Loads the pages reachable from the volume materials that are not resident.
+	void UpdatePages(gObj<GraphicsManager> manager) {
 		auto pipeline = this->pipeline.Dynamic_Cast<STFXPathtracing>();
+		auto desc = scene->getScene();
+
+		list<int> reachable;
+		if (Table.IsOpen())
+			ReachableSTFXPages(desc->VolumeMaterials().Data, desc->VolumeMaterials().Count, BINS_G, reachable);
+		list<TablePageLoad> loads;
+		Pages.Require(reachable, loads);
+		Tables.MissingPages = Pages.Missing();
+		if (Pages.Missing() > 0)
+			ReportMissingPages("STFXTechnique", Pages.Missing(), reachable.size(), STFX_PAGE_SLOTS);
+
+		Stopwatch stopwatch;
+		const int logNPage = BINS_R * BINS_LOGN;
+		const float* data = Table.As<float>();
+		for (int i = 0; i < loads.size(); i++)
+		{
+			unsigned long long page = loads[i].Page;
+			int slot = loads[i].Slot;
+			const float* xw = data + (unsigned long long)BINS_G * logNPage + page * logNPage * BINS_X;
+			LoadTablePage(manager, pipeline->CDF_LogN, data + page * logNPage, slot, logNPage);
+			if (slot < STFX_PAGE_SLOTS / 2)
+				LoadTablePage(manager, pipeline->CDF_XW_L, xw, slot, logNPage * BINS_X);
+			else
+				LoadTablePage(manager, pipeline->CDF_XW_H, xw, slot - STFX_PAGE_SLOTS / 2, logNPage * BINS_X);
+			Tables.Bytes += (unsigned long long)logNPage * (BINS_X + 1) * sizeof(float);
+		}
+		Tables.ReadMilliseconds += stopwatch.Milliseconds();
+		pipeline->PageTable->Write((int*)Pages.PageTable());
+		manager->ToGPU(pipeline->PageTable);
+	}
+
+	void UpdateBuffers(gObj<GraphicsManager> manager, SceneElement elements) {
+		SphereTracingBase::UpdateBuffers(manager, elements);
 
-		manager->ToGPU(pipeline->CDF_LogN);
-		manager->ToGPU(pipeline->CDF_XW_L);
-		manager->ToGPU(pipeline->CDF_XW_H);
+		// The tables are created after the first update in OnLoad
+		auto pipeline = this->pipeline.Dynamic_Cast<STFXPathtracing>();
+		if (+(elements & SceneElement::Materials) && pipeline->PageTable)
+			UpdatePages(manager);
 	}
 };
\ No newline at end of file
@@ -0,0 +1,507 @@
+#pragma once
+
+#include <math.h>
+#include "dx4xb_math.h"
+#include "../CPU/MappedFile.h"
+#include "../CPU/Parallel.h"
+
+using namespace dx4xb;
+
+// Version of the scatter dataset file layout.
+#define SCATTER_DATASET_FILE_VERSION 1
+
+#define SCATTER_DATASET_COLUMNS 13
+
+// Offset of the first column in the file.
+#define SCATTER_DATASET_DATA_OFFSET 64
+
+// Columns are padded to a multiple of this number of rows, so every column starts 64-byte aligned.
+#define SCATTER_DATASET_ROW_ALIGNMENT 16
+
+/// Columns of a scatter dataset, in the same order than the columns of the text files (ScattersDataSet.ds)
+/// and the arrays of the .npz files (sigma, g, albedo, n, z, tangent_beta, tangent_alpha, representative_X, representative_W).
+enum class ScatterColumn : int {
+	Sigma, G, Phi, N, CosTheta, Beta, Alpha, Xx, Xy, Xz, Wx, Wy, Wz
+};
+
+/// Training sample of the scattering models.
+/// A walk started at the center of a sphere of radius 1 with density Sigma, anisotropy G and albedo Phi leaves the sphere
+/// after N scattering events at the position with z = CosTheta and the direction with tangent components Beta and Alpha.
+/// X and W are the representative position and direction of the walk.
+struct ScatterSample {
+	float Sigma, G, Phi, N, CosTheta, Beta, Alpha;
+	float3 X, W;
+};
+static_assert(sizeof(ScatterSample) == SCATTER_DATASET_COLUMNS * sizeof(float), "Scatter sample must be a row of floats");
+
+// Header of a scatter dataset file.
+// The header is followed (at DataOffset) by Columns columns of Stride little-endian floats, the first Rows values are valid.
+struct ScatterDatasetHeader {
+	char Magic[4]; // SCDS
+	unsigned int FileVersion;
+	unsigned int Columns;
+	unsigned int DataOffset;
+	unsigned long long Rows;
+	unsigned long long Stride;
+};
+static_assert(sizeof(ScatterDatasetHeader) == 32, "Scatter dataset header must be tightly packed");
+
+/// Read-only access to a scatter dataset file mapped in memory.
+/// Columns are contiguous arrays, rows can be accessed randomly and only the touched pages are loaded.
+class ScatterDataset {
+	MappedFile file;
+	const ScatterDatasetHeader* header = nullptr;
+
+public:
+	// Maps a dataset file. Returns false if the file doesn't exist or it is not a valid dataset.
+	bool Open(const char* fileName) {
+		Close();
+		if (!file.Open(fileName))
+			return false;
+		auto h = file.As<ScatterDatasetHeader>();
+		if (file.Size() < sizeof(ScatterDatasetHeader) ||
+			memcmp(h->Magic, "SCDS", 4) != 0 ||
+			h->FileVersion != SCATTER_DATASET_FILE_VERSION ||
+			h->Columns != SCATTER_DATASET_COLUMNS ||
+			h->Rows > h->Stride ||
+			file.Size() < h->DataOffset + h->Stride * SCATTER_DATASET_COLUMNS * sizeof(float))
+		{
+			Close();
+			return false;
+		}
+		header = h;
+		return true;
+	}
+
+	void Close() {
+		file.Close();
+		header = nullptr;
+	}
+
+	inline bool IsOpen() const { return header != nullptr; }
+
+	inline unsigned long long Rows() const { return header ? header->Rows : 0; }
+
+	// Gets the Rows() values of a column.
+	inline const float* Column(ScatterColumn column) const {
+		return file.As<float>(header->DataOffset + header->Stride * (int)column * sizeof(float));
+	}
+
+	inline float Value(unsigned long long row, ScatterColumn column) const {
+		return Column(column)[row];
+	}
+
+	ScatterSample Row(unsigned long long row) const {
+		ScatterSample sample;
+		float* values = (float*)&sample;
+		for (int c = 0; c < SCATTER_DATASET_COLUMNS; c++)
+			values[c] = Column((ScatterColumn)c)[row];
+		return sample;
+	}
+};
+
+/// Writes a scatter dataset with a known maximum number of rows.
+/// The file is preallocated and rows are written at their final positions, so many threads can write
+/// disjoint ranges of rows at the same time (see ReserveRows). The file is written aside and renamed when closed.
+class ScatterDatasetWriter {
+#ifdef _WIN32
+	HANDLE file = INVALID_HANDLE_VALUE;
+#else
+	int file = -1;
+#endif
+	char fileName[MAX_PATH];
+	char tempFileName[MAX_PATH];
+	unsigned long long capacity = 0;
+	unsigned long long stride = 0;
+	volatile LONG64 reserved = 0;
+	volatile LONG failed = 0;
+
+	bool WriteAt(unsigned long long offset, const void* data, DWORD size) {
+#ifdef _WIN32
+		OVERLAPPED overlapped = {};
+		overlapped.Offset = (DWORD)offset;
+		overlapped.OffsetHigh = (DWORD)(offset >> 32);
+		DWORD written;
+		if (WriteFile(file, data, size, &written, &overlapped) && written == size)
+			return true;
+#else
+		if (pwrite(file, data, size, (off_t)offset) == (ssize_t)size)
+			return true;
+#endif
+		InterlockedExchange(&failed, 1);
+		return false;
+	}
+
+	void CloseFile() {
+#ifdef _WIN32
+		CloseHandle(file);
+		file = INVALID_HANDLE_VALUE;
+#else
+		close(file);
+		file = -1;
+#endif
+	}
+
+	inline unsigned long long ColumnOffset(int column, unsigned long long row) const {
+		return SCATTER_DATASET_DATA_OFFSET + (column * stride + row) * sizeof(float);
+	}
+
+public:
+	ScatterDatasetWriter() {}
+	ScatterDatasetWriter(const ScatterDatasetWriter&) = delete;
+	ScatterDatasetWriter& operator = (const ScatterDatasetWriter&) = delete;
+
+	~ScatterDatasetWriter() {
+		Discard();
+	}
+
+	// Starts a dataset with room for capacity rows. Returns false if the file can not be created.
+	bool Create(const char* fileName, unsigned long long capacity) {
+		Discard();
+		strcpy_s(this->fileName, fileName);
+		sprintf_s(tempFileName, "%s.tmp", fileName);
+
+#ifdef _WIN32
+		file = CreateFileA(tempFileName, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+#else
+		file = open(tempFileName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+		if (!IsOpen())
+			return false;
+
+		this->capacity = capacity;
+		stride = (capacity + SCATTER_DATASET_ROW_ALIGNMENT - 1) / SCATTER_DATASET_ROW_ALIGNMENT * SCATTER_DATASET_ROW_ALIGNMENT;
+		reserved = 0;
+		failed = 0;
+
+#ifdef _WIN32
+		LARGE_INTEGER size;
+		size.QuadPart = ColumnOffset(SCATTER_DATASET_COLUMNS, 0);
+		if (!SetFilePointerEx(file, size, nullptr, FILE_BEGIN) || !SetEndOfFile(file))
+#else
+		if (ftruncate(file, (off_t)ColumnOffset(SCATTER_DATASET_COLUMNS, 0)) != 0)
+#endif
+		{
+			Discard();
+			return false;
+		}
+		return true;
+	}
+
+#ifdef _WIN32
+	inline bool IsOpen() const { return file != INVALID_HANDLE_VALUE; }
+#else
+	inline bool IsOpen() const { return file >= 0; }
+#endif
+
+	inline unsigned long long Capacity() const { return capacity; }
+
+	// Reserves count consecutive rows and gets the first one. Can be called from many threads.
+	// Returns Capacity() if there is no room left for all the rows.
+	unsigned long long ReserveRows(unsigned long long count) {
+		unsigned long long first = (unsigned long long)InterlockedExchangeAdd64(&reserved, (LONG64)count);
+		return first + count <= capacity ? first : capacity;
+	}
+
+	// Writes count rows starting at firstRow, given by column (columns[c] has the count values of the column c).
+	bool WriteColumns(unsigned long long firstRow, int count, const float* const* columns) {
+		if (firstRow + count > capacity)
+			return false;
+		for (int c = 0; c < SCATTER_DATASET_COLUMNS; c++)
+			if (!WriteAt(ColumnOffset(c, firstRow), columns[c], count * sizeof(float)))
+				return false;
+		return true;
+	}
+
+	// Writes count rows starting at firstRow.
+	bool WriteRows(unsigned long long firstRow, const ScatterSample* samples, int count) {
+		const int CHUNK = 256;
+		float values[SCATTER_DATASET_COLUMNS][CHUNK];
+		const float* columns[SCATTER_DATASET_COLUMNS];
+		for (int c = 0; c < SCATTER_DATASET_COLUMNS; c++)
+			columns[c] = values[c];
+		for (int start = 0; start < count; start += CHUNK)
+		{
+			int size = min(CHUNK, count - start);
+			for (int i = 0; i < size; i++)
+			{
+				const float* row = (const float*)(samples + start + i);
+				for (int c = 0; c < SCATTER_DATASET_COLUMNS; c++)
+					values[c][i] = row[c];
+			}
+			if (!WriteColumns(firstRow + start, size, columns))
+				return false;
+		}
+		return true;
+	}
+
+	// Finishes the dataset with its first rows rows and replaces the file.
+	// Returns false (and the file is not replaced) if any write failed.
+	bool Close(unsigned long long rows) {
+		if (!IsOpen())
+			return false;
+		ScatterDatasetHeader header = { { 'S', 'C', 'D', 'S' }, SCATTER_DATASET_FILE_VERSION, SCATTER_DATASET_COLUMNS,
+			SCATTER_DATASET_DATA_OFFSET, min(rows, capacity), stride };
+		bool written = WriteAt(0, &header, sizeof(ScatterDatasetHeader)) && !failed;
+		CloseFile();
+
+		if (!written || !MoveFileExA(tempFileName, fileName, MOVEFILE_REPLACE_EXISTING))
+		{
+			DeleteFileA(tempFileName);
+			return false;
+		}
+		return true;
+	}
+
+	// Finishes the dataset with the reserved rows.
+	bool Close() {
+		return Close(min((unsigned long long)reserved, capacity));
+	}
+
+	// Stops writing and removes the partial file.
+	void Discard() {
+		if (!IsOpen())
+			return;
+		CloseFile();
+		DeleteFileA(tempFileName);
+	}
+};
+
+// Size of the blocks of text parsed by a thread in ConvertScatterDatasetCSV.
+#define SCATTER_DATASET_CSV_BLOCK (4 << 20)
+
+/// Parses a line of a scatter dataset text file, 13 comma-separated values.
+/// Returns false if the line has less values or any of them is not a number.
+inline bool ParseScatterSample(const char* line, int length, ScatterSample& sample) {
+	char text[1024];
+	if (length <= 0 || length >= 1024)
+		return false;
+	memcpy(text, line, length);
+	text[length] = 0;
+
+	float* values = (float*)&sample;
+	char* position = text;
+	for (int c = 0; c < SCATTER_DATASET_COLUMNS; c++)
+	{
+		if (c > 0)
+		{
+			if (*position != ',')
+				return false;
+			position++;
+		}
+		char* end;
+		values[c] = strtof(position, &end);
+		if (end == position || isnan(values[c]))
+			return false;
+		position = end;
+	}
+	return true;
+}
+
+/// Converts a scatter dataset from the text format (ScattersDataSet.ds) to the binary format.
+/// Lines with NaN values are dropped as in main_convertDS.py. The text is mapped and parsed in blocks by threads threads
+/// (the logical processors by default) and the rows keep the order of the lines.
+/// Returns the number of rows written or -1 if any file could not be read or written.
+inline long long ConvertScatterDatasetCSV(const char* csvFileName, const char* fileName, int threads = 0) {
+	MappedFile csv;
+	if (!csv.Open(csvFileName))
+		return -1;
+	const char* text = csv.As<char>();
+	unsigned long long size = csv.Size();
+
+	// Blocks start after a line break
+	int blockCount = (int)((size + SCATTER_DATASET_CSV_BLOCK - 1) / SCATTER_DATASET_CSV_BLOCK);
+	unsigned long long* starts = new unsigned long long[blockCount + 1];
+	starts[0] = 0;
+	for (int b = 1; b < blockCount; b++)
+	{
+		unsigned long long start = max(starts[b - 1], (unsigned long long)b * SCATTER_DATASET_CSV_BLOCK);
+		while (start < size && text[start - 1] != '\n')
+			start++;
+		starts[b] = start;
+	}
+	starts[blockCount] = size;
+
+	ScatterSample** samples = new ScatterSample*[blockCount];
+	int* counts = new int[blockCount];
+	ParallelFor(blockCount, [&](int b, int) {
+		const char* begin = text + starts[b];
+		const char* end = text + starts[b + 1];
+		int lines = 1;
+		for (const char* c = begin; c < end; c++)
+			lines += *c == '\n';
+		samples[b] = new ScatterSample[lines];
+		counts[b] = 0;
+		while (begin < end)
+		{
+			const char* lineEnd = begin;
+			while (lineEnd < end && *lineEnd != '\n')
+				lineEnd++;
+			int length = (int)(lineEnd - begin);
+			if (length > 0 && begin[length - 1] == '\r')
+				length--;
+			if (ParseScatterSample(begin, length, samples[b][counts[b]]))
+				counts[b]++;
+			begin = lineEnd + 1;
+		}
+	}, threads);
+
+	unsigned long long* firstRows = new unsigned long long[blockCount + 1];
+	firstRows[0] = 0;
+	for (int b = 0; b < blockCount; b++)
+		firstRows[b + 1] = firstRows[b] + counts[b];
+	long long rows = (long long)firstRows[blockCount];
+
+	ScatterDatasetWriter writer;
+	if (writer.Create(fileName, rows))
+	{
+		ParallelFor(blockCount, [&](int b, int) {
+			writer.WriteRows(firstRows[b], samples[b], counts[b]);
+		}, threads);
+		if (!writer.Close(rows))
+			rows = -1;
+	}
+	else
+		rows = -1;
+
+	for (int b = 0; b < blockCount; b++)
+		delete[] samples[b];
+	delete[] samples;
+	delete[] counts;
+	delete[] starts;
+	delete[] firstRows;
+	return rows;
+}
+
+/// Round trips of random samples through ScatterDatasetWriter (rows reserved and written by threads) and ScatterDataset,
+/// and through a text file with NaN lines and mixed line breaks converted by ConvertScatterDatasetCSV.
+/// The files are named after fileName (fileName, fileName.csv and fileName.csv.ds) and removed at the end.
+struct ScatterDatasetCheck {
+	int Rows;
+	// Files that could not be written, converted or opened
+	int FileErrors;
+	// Rows of the written dataset, and rows read different (any bit) from the samples written there
+	long long WrittenRows;
+	int WrittenMismatches;
+	// Lines of the text file and those with a NaN value
+	int Lines;
+	int NaNLines;
+	// Rows of the converted dataset, and rows different (any bit) from the lines without NaN in their order
+	long long ConvertedRows;
+	int ConvertedMismatches;
+};
+
+inline ScatterDatasetCheck CheckScatterDataset(const char* fileName, int rows = 1 << 17, int threads = 4, unsigned int seed = 0) {
+	// xorshift32 (<random> can not be used with Windows min/max macros)
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto uniform = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	ScatterDatasetCheck check = {};
+	check.Rows = rows;
+	ScatterSample* samples = new ScatterSample[rows];
+	for (int i = 0; i < rows; i++)
+	{
+		ScatterSample& s = samples[i];
+		s.Sigma = 1000 * uniform() * uniform();
+		s.G = 2 * uniform() - 1;
+		s.Phi = uniform();
+		s.N = floorf(64 * uniform());
+		s.CosTheta = 2 * uniform() - 1;
+		s.Beta = 2 * uniform() - 1;
+		s.Alpha = 2 * uniform() - 1;
+		s.X = float3(uniform(), uniform(), uniform()) * 2 - float3(1, 1, 1);
+		s.W = float3(uniform(), uniform(), uniform()) * 2 - float3(1, 1, 1);
+	}
+
+	char csvFileName[MAX_PATH], convertedFileName[MAX_PATH];
+	sprintf_s(csvFileName, "%s.csv", fileName);
+	sprintf_s(convertedFileName, "%s.csv.ds", fileName);
+
+	// chunks of rows land where their reservation says, the capacity is larger than the rows written
+	const int CHUNK = 1000;
+	int chunks = (rows + CHUNK - 1) / CHUNK;
+	unsigned long long* firstRows = new unsigned long long[chunks];
+	ScatterDatasetWriter writer;
+	ScatterDataset dataset;
+	if (writer.Create(fileName, rows + 100))
+	{
+		ParallelFor(chunks, [&](int c, int) {
+			int count = min(CHUNK, rows - c * CHUNK);
+			firstRows[c] = writer.ReserveRows(count);
+			writer.WriteRows(firstRows[c], samples + c * CHUNK, count);
+		}, threads);
+		if (!writer.Close())
+			check.FileErrors++;
+	}
+	else
+		check.FileErrors++;
+	if (dataset.Open(fileName))
+	{
+		check.WrittenRows = dataset.Rows();
+		for (int c = 0; c < chunks; c++)
+			for (int i = 0; i < min(CHUNK, rows - c * CHUNK); i++)
+			{
+				ScatterSample row = firstRows[c] + i < dataset.Rows() ? dataset.Row(firstRows[c] + i) : ScatterSample{};
+				check.WrittenMismatches += memcmp(&row, samples + c * CHUNK + i, sizeof(ScatterSample)) != 0;
+			}
+		dataset.Close();
+	}
+	else
+		check.FileErrors++;
+
+	// a column of some lines is NaN, lines end with \n or \r\n, the last one without line break
+	int* validLines = new int[rows];
+	int validCount = 0;
+	FILE* csv;
+	if (fopen_s(&csv, csvFileName, "wb") == 0)
+	{
+		for (int i = 0; i < rows; i++)
+		{
+			const float* values = (const float*)(samples + i);
+			bool nan = i % 37 == 5;
+			for (int c = 0; c < SCATTER_DATASET_COLUMNS; c++)
+			{
+				if (nan && c == i % SCATTER_DATASET_COLUMNS)
+					fprintf(csv, c > 0 ? ",nan" : "nan");
+				else
+					fprintf(csv, c > 0 ? ",%.9g" : "%.9g", values[c]);
+			}
+			if (i < rows - 1)
+				fprintf(csv, i % 3 == 0 ? "\r\n" : "\n");
+			check.NaNLines += nan;
+			if (!nan)
+				validLines[validCount++] = i;
+		}
+		check.Lines = rows;
+		if (fclose(csv) != 0)
+			check.FileErrors++;
+	}
+	else
+		check.FileErrors++;
+
+	check.ConvertedRows = ConvertScatterDatasetCSV(csvFileName, convertedFileName, threads);
+	if (check.ConvertedRows >= 0 && dataset.Open(convertedFileName))
+	{
+		for (int k = 0; k < validCount; k++)
+		{
+			ScatterSample row = (unsigned long long)k < dataset.Rows() ? dataset.Row(k) : ScatterSample{};
+			check.ConvertedMismatches += memcmp(&row, samples + validLines[k], sizeof(ScatterSample)) != 0;
+		}
+		dataset.Close();
+	}
+	else
+		check.FileErrors++;
+
+	DeleteFileA(fileName);
+	DeleteFileA(csvFileName);
+	DeleteFileA(convertedFileName);
+	delete[] samples;
+	delete[] firstRows;
+	delete[] validLines;
+	return check;
+}
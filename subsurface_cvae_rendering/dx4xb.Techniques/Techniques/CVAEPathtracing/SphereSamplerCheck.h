@@ -0,0 +1,99 @@
+#pragma once
+
+#include "SphereWalk.h"
+#include "CVAEBatchSampling.h"
+
+/// Accuracy of a sampler of the sphere exits against the walks of WalkSphere (starting with a scattering at the center)
+/// for a (g, phi, r) configuration, and its cost.
+struct SphereSamplerAccuracy {
+	float G, Phi, R;
+	int Samples;
+	// |p - p_ref| of the probability of leaving the sphere
+	float ExitProbabilityError;
+	// Relative error of the mean number of scattering events of the exits
+	float EventsError;
+	// Total variation distances of the histograms of the exits
+	float EventsDistance;
+	float ThetaDistance, BetaDistance, AlphaDistance;
+	// Distance of theta between two sets of walks with the same number of samples, errors below it are noise
+	float ThetaNoise;
+	// Single thread cost of a sample of the sampler and of a walk
+	float NanosecondsPerSample;
+	float ReferenceNanosecondsPerSample;
+};
+
+/// Compares a sampler with the walks of WalkSphereParallel (threads threads).
+/// sampler(g, phi, r, count, seed, statistics) adds count samples to the statistics with a single thread.
+/// Walks start with a scattering at the center unless scatterAtCenter is false (as SampleCosXAndW of the STF tables).
+template<typename Sampler>
+inline SphereSamplerAccuracy CompareSphereSampler(float g, float phi, float r, Sampler sampler,
+	int samples = 1 << 20, unsigned int seed = 1, int threads = 0, bool scatterAtCenter = true) {
+	SphereSamplerAccuracy result = {};
+	result.G = g;
+	result.Phi = phi;
+	result.R = r;
+	result.Samples = samples;
+
+	SphereExitStatistics reference, noise, statistics;
+	WalkSphereParallel(g, phi, r, scatterAtCenter, samples, seed, reference, threads);
+	WalkSphereParallel(g, phi, r, scatterAtCenter, samples, seed + 1, noise, threads);
+
+	// cost of the walks, a single chunk is enough
+	SphereExitStatistics timing;
+	timing.Clear();
+	int timed = min(samples, SPHERE_WALK_CHUNK);
+	Stopwatch stopwatch;
+	WalkSphere(g, phi, r, scatterAtCenter, timed, seed + 2, timing);
+	result.ReferenceNanosecondsPerSample = stopwatch.Milliseconds() * 1000000.0f / timed;
+
+	statistics.Clear();
+	stopwatch.Start();
+	sampler(g, phi, r, samples, seed + 3, statistics);
+	result.NanosecondsPerSample = stopwatch.Milliseconds() * 1000000.0f / samples;
+
+	result.ExitProbabilityError = fabsf(statistics.ExitProbability() - reference.ExitProbability());
+	result.EventsError = fabsf(statistics.MeanEvents() - reference.MeanEvents()) / maxf(1.0f, reference.MeanEvents());
+	result.EventsDistance = SphereExitStatistics::TotalVariation(statistics.EventBins, statistics.Exits, reference.EventBins, reference.Exits, SPHERE_EVENT_BINS);
+	result.ThetaDistance = SphereExitStatistics::TotalVariation(statistics.ThetaBins, statistics.Exits, reference.ThetaBins, reference.Exits, SPHERE_EXIT_BINS);
+	result.BetaDistance = SphereExitStatistics::TotalVariation(statistics.BetaBins, statistics.Exits, reference.BetaBins, reference.Exits, SPHERE_EXIT_BINS);
+	result.AlphaDistance = SphereExitStatistics::TotalVariation(statistics.AlphaBins, statistics.Exits, reference.AlphaBins, reference.Exits, SPHERE_EXIT_BINS);
+	result.ThetaNoise = SphereExitStatistics::TotalVariation(noise.ThetaBins, noise.Exits, reference.ThetaBins, reference.Exits, SPHERE_EXIT_BINS);
+	return result;
+}
+
+/// Exits of the CVAE sampler (CVAESampleBatch::GenerateVariablesWithModel) with incoming direction (0, 0, 1),
+/// theta, beta and alpha are the sampled CosTheta, Wt and Wb.
+inline void SampleCVAEExits(const CVAEModels& models, float g, float phi, float r, int count, unsigned int seed,
+	SphereExitStatistics& statistics, int batchSize = 512) {
+	CVAESampleBatch batch;
+	batch.Resize(batchSize);
+	for (int s = 0; s < batchSize; s++)
+	{
+		batch.G[s] = g;
+		batch.Phi[s] = phi;
+		batch.Density[s] = r;
+		batch.Win[0][s] = 0;
+		batch.Win[1][s] = 0;
+		batch.Win[2][s] = 1;
+	}
+	for (int b = 0; b * batchSize < count; b++)
+	{
+		int size = min(batchSize, count - b * batchSize);
+		batch.Resize(size);
+		batch.GenerateLatents(seed * 7919u + b);
+		batch.GenerateVariablesWithModel(models);
+		for (int s = 0; s < size; s++)
+			if (batch.Scattered[s] != 0)
+				statistics.AddExit(batch.N[s], batch.CosTheta[s], batch.Wt[s], batch.Wb[s]);
+			else
+				statistics.AddAbsorbed();
+	}
+}
+
+/// Compares the CVAE sampler with the walks for a configuration.
+inline SphereSamplerAccuracy CompareCVAESampler(const CVAEModels& models, float g, float phi, float r,
+	int samples = 1 << 20, unsigned int seed = 1, int threads = 0) {
+	return CompareSphereSampler(g, phi, r, [&models](float g, float phi, float r, int count, unsigned int seed, SphereExitStatistics& statistics) {
+		SampleCVAEExits(models, g, phi, r, count, seed, statistics);
+	}, samples, seed, threads);
+}
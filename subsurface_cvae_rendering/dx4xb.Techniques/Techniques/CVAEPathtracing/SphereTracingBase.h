@@ -1,8 +1,10 @@
 #pragma once
 
 #include "..\Pathtracing\PathtracingBase.h"
+#include "DistanceFieldCache.h"
+#include "DistanceFieldPyramid.h"
 
-struct SphereTracingBase : public PathtracingTechniqueBase {
+struct SphereTracingBase : public PathtracingTechniqueBase, public IReportDistanceFields {
 
 #pragma region Grid Construction Compute Shaders
 
@@ -46,7 +48,10 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 
 		gObj<Texture3D> DistanceField;
 
-		float4x4 GridTransform;
+		struct GridTransformCB {
+			float4x4 FromGeometryToGrid;
+			int3 Size = int3(0, 0, 0);
+		} GridTransform;
 
 		virtual void Bindings(gObj<ComputeBinder> binder) override {
 			binder->SRV(0, VertexBuffer);
@@ -68,7 +73,10 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 
 		gObj<Texture3D> GridSrc;
 		gObj<Texture3D> GridDst;
-		int LevelInfo;
+		struct LevelInfoCB {
+			int Level;
+			int3 Size = int3(0, 0, 0);
+		} LevelInfo;
 
 		virtual void Bindings(gObj<ComputeBinder> binder) override {
 			binder->UAV(0, GridDst);
@@ -117,7 +125,23 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 	// Array with a Grid for every geometry.
 	gObj<Texture3D>* perGeometryDF;
 	gObj<Texture3D> tempGrid;
-	int GridSize = 256;
+
+	// Resolution selected for each geometry (reported via IReportDistanceFields).
+	// Cells are cubes, so grids of elongated geometries are anisotropic.
+	DistanceFieldSelection* dfSelections;
+	// Componentwise maximum of all grid resolutions (size of the temporal resources).
+	int3 largestGridSize = int3(1, 1, 1);
+
+	// Maximum resolution of the largest axis of a grid.
+	int MaxGridSize = 256;
+	// Minimum resolution of the largest axis of a grid.
+	int MinGridSize = 16;
+	// Resolution of the largest axis per square root of the number of triangles.
+	float CellsPerSqrtTriangle = 4;
+	// Memory budget in bytes for all distance fields.
+	long long DistanceFieldBudget = 256ll * 1024 * 1024;
+	// Determines if the number of sphere tracing steps with and without the pyramid is measured on the CPU.
+	bool MeasurePyramidSteps = false;
 
 	struct GridInfo {
 		// Index of the base geometry (grid).
@@ -135,6 +159,23 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 	// Grid transform for each geometry.
 	float4x4* gridTransforms;
 
+#pragma endregion
+
+#pragma region Distance field cache
+
+	// Baked distance fields stored on disk.
+	DistanceFieldCache dfCache;
+	// Determines if distance fields are loaded from (and saved to) the cache.
+	bool UseDistanceFieldCache = true;
+	// Determines if distance fields are built even if they are in the cache (the cache is overwritten).
+	bool ForceDistanceFieldRebuild = false;
+	// Cache key for each geometry.
+	unsigned long long* dfKeys;
+	// Determines for each geometry if its distance field was loaded from the cache.
+	bool* dfFromCache;
+	// Number of geometries that need a distance field construction.
+	int dfToBuild;
+
 #pragma endregion
 
 	// Inherited via PathtracingTechniqueBase to include grid construction
@@ -148,14 +189,6 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 
 		G2WTransforms = new float4x4[globalGeometryCount];
 
-		perGeometryDF = new gObj<Texture3D>[desc->Geometries().Count];
-		for (int i = 0; i < desc->Geometries().Count; i++)
-		{
-			perGeometryDF[i] = CreateTexture3DUAV<float>(GridSize, GridSize, GridSize);
-			perGeometryDF[i]->SetDebugName(L"Distance Field");
-		}
-		tempGrid = CreateTexture3DUAV<float>(GridSize, GridSize, GridSize);
-		tempGrid->SetDebugName(L"Temporal Grid for DF");
 		GridInfos = CreateBufferSRV<GridInfo>(globalGeometryCount);
 		GridInfos->SetDebugName(L"Grid Infos");
 		gridInfosData = new GridInfo[globalGeometryCount];
@@ -163,12 +196,16 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 #pragma region Computing Per-Geometry Grid Dimensions and Transforms
 
 		gridTransforms = new float4x4[desc->Geometries().Count];
+		dfSelections = new DistanceFieldSelection[desc->Geometries().Count];
+
+		float3* minims = new float3[desc->Geometries().Count];
+		float3* maxims = new float3[desc->Geometries().Count];
 
 		for (int i = 0; i < desc->Geometries().Count; i++)
 		{
 			auto geom = desc->Geometries().Data[i];
 
-#pragma region Compute AABB of geometry and Transform
+#pragma region Compute AABB of geometry
 			float3 minim = float3(10000, 10000, 10000), maxim = float3(-10000, -10000, -10000);
 			for (int j = 0; j < geom.IndexCount; j++)
 			{
@@ -181,14 +218,68 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 				maxim = maxf(maxim, vPos);
 			}
 			float3 dimensions = maxim - minim;
-			maxim = minim + dimensions + float3(0.01, 0.01, 0.01);
-			minim = minim - float3(0.01, 0.01, 0.01);
-			float maxSize = maxf(maxim.x - minim.x, maxf(maxim.y - minim.y, maxim.z - minim.z));
+			maxims[i] = minim + dimensions + float3(0.01, 0.01, 0.01);
+			minims[i] = minim - float3(0.01, 0.01, 0.01);
+#pragma endregion
+		}
+
+		SelectGridResolutions(minims, maxims);
+
+		delete[] minims;
+		delete[] maxims;
 
-			gridTransforms[i] = mul(Transforms::Translate(-minim), Transforms::Scale(GridSize / maxSize));
 #pragma endregion
+
+		perGeometryDF = new gObj<Texture3D>[desc->Geometries().Count];
+		largestGridSize = int3(1, 1, 1);
+		for (int i = 0; i < desc->Geometries().Count; i++)
+		{
+			largestGridSize = int3(
+				max(largestGridSize.x, dfSelections[i].Size.x),
+				max(largestGridSize.y, dfSelections[i].Size.y),
+				max(largestGridSize.z, dfSelections[i].Size.z));
 		}
 
+#pragma region Loading cached distance fields
+
+		dfKeys = new unsigned long long[desc->Geometries().Count];
+		dfFromCache = new bool[desc->Geometries().Count];
+		dfToBuild = 0;
+
+		float* cachedField = nullptr;
+
+		for (int i = 0; i < desc->Geometries().Count; i++)
+		{
+			dfFromCache[i] = false;
+			if (UseDistanceFieldCache)
+			{
+				dfKeys[i] = DistanceFieldCache::ComputeKey(desc, i, dfSelections[i].Size);
+				if (!ForceDistanceFieldRebuild)
+				{
+					if (!cachedField)
+						cachedField = new float[largestGridSize.x * largestGridSize.y * largestGridSize.z];
+					if (dfCache.Load(dfKeys[i], dfSelections[i].Size, cachedField, gridTransforms[i]))
+					{
+#ifdef USE_DF_PYRAMID
+						CreatePyramid(i, cachedField);
+#else
+						CreateGrid(i);
+						perGeometryDF[i]->Write(cachedField);
+#endif
+						dfFromCache[i] = true;
+					}
+				}
+			}
+			if (!dfFromCache[i])
+				CreateGrid(i);
+			dfSelections[i].FromCache = dfFromCache[i];
+			if (!dfFromCache[i])
+				dfToBuild++;
+		}
+
+		if (cachedField)
+			delete[] cachedField;
+
 #pragma endregion
 
 		PathtracingTechniqueBase::OnLoad();
@@ -199,12 +290,21 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 		pipeline->DistanceFields = perGeometryDF;
 		pipeline->NumberOfDFs = desc->Geometries().Count;
 
+		if (dfToBuild == 0) // All distance fields were loaded from the cache
+		{
+			Execute_OnGPU(UploadCachedGrids);
+			return;
+		}
+
 		Load(creatingGrid);
 		Load(computingInitialDistances);
 		Load(spreadingDistances);
 
+		tempGrid = CreateTexture3DUAV<float>(largestGridSize.x, largestGridSize.y, largestGridSize.z);
+		tempGrid->SetDebugName(L"Temporal Grid for DF");
+
 		// The grid for triangle hashing in space and build initial distances.
-		creatingGrid->Head = CreateTexture3DUAV<int>(GridSize, GridSize, GridSize);
+		creatingGrid->Head = CreateTexture3DUAV<int>(largestGridSize.x, largestGridSize.y, largestGridSize.z);
 		creatingGrid->Head->SetDebugName(L"Head Grid");
 		creatingGrid->Triangles = CreateBufferUAV<int>(10000000);
 		creatingGrid->Triangles->SetDebugName(L"Triangles Buffer");
@@ -217,18 +317,198 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 		computingInitialDistances->Triangles = creatingGrid->Triangles;
 		computingInitialDistances->NextBuffer = creatingGrid->NextBuffer;
 		
+		Execute_OnGPU(UploadCachedGrids);
 		Execute_OnGPU(BuildGrids);
+
+#ifdef USE_DF_PYRAMID
+		ReadBackBuiltGrids();
+		Execute_OnGPU(UploadBuiltGrids);
+#else
+		if (UseDistanceFieldCache)
+			ReadBackBuiltGrids();
+#endif
 	}
 
+	// Chooses the grid resolution and transform of every geometry.
+	// The resolution of the largest axis grows with the square root of the triangle count (surface detail),
+	// is limited for geometries that are small in world space compared to the largest one,
+	// and all resolutions are scaled down uniformly until the distance fields fit in the memory budget.
+	void SelectGridResolutions(float3* minims, float3* maxims) {
+		auto desc = scene->getScene();
+		int geometryCount = desc->Geometries().Count;
+
+#pragma region World extent of each geometry (largest instance)
+		float* worldExtents = new float[geometryCount];
+		for (int i = 0; i < geometryCount; i++)
+			worldExtents[i] = 0;
+		for (int i = 0; i < desc->Instances().Count; i++)
+		{
+			auto instance = desc->Instances().Data[i];
+			for (int j = 0; j < instance.Count; j++) {
+				int geometryIndex = instance.GeometryIndices[j];
+				auto geometry = desc->Geometries().Data[geometryIndex];
+
+				float4x4 geometryTransform = geometry.TransformIndex == -1 ?
+					float4x4(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1) :
+					Transforms::FromAffine(desc->getTransformsBuffer().Data[geometry.TransformIndex]);
+				float4x4 g2w = mul(geometryTransform, instance.Transform);
+				float scale = maxf(length(g2w[0].get_xyz()), maxf(length(g2w[1].get_xyz()), length(g2w[2].get_xyz())));
+
+				float3 extent = maxims[geometryIndex] - minims[geometryIndex];
+				worldExtents[geometryIndex] = maxf(worldExtents[geometryIndex], scale * maxf(extent.x, maxf(extent.y, extent.z)));
+			}
+		}
+		float largestWorldExtent = 0;
+		for (int i = 0; i < geometryCount; i++)
+			largestWorldExtent = maxf(largestWorldExtent, worldExtents[i]);
+#pragma endregion
+
+#pragma region Desired resolutions
+		float* desired = new float[geometryCount];
+		for (int i = 0; i < geometryCount; i++)
+		{
+			float triangles = desc->Geometries().Data[i].IndexCount / 3.0f;
+			float byDetail = CellsPerSqrtTriangle * sqrtf(triangles);
+			float byExtent = largestWorldExtent > 0 ? MaxGridSize * worldExtents[i] / largestWorldExtent : (float)MaxGridSize;
+			desired[i] = maxf((float)MinGridSize, minf((float)MaxGridSize, minf(byDetail, byExtent)));
+		}
+#pragma endregion
+
+#pragma region Fit in the memory budget
+		float factor = 1;
+		long long totalMemory;
+		for (int iteration = 0; iteration < 32; iteration++)
+		{
+			totalMemory = 0;
+			bool canReduce = false;
+			for (int i = 0; i < geometryCount; i++)
+			{
+				int resolution = max(MinGridSize, (int)(desired[i] * factor));
+				canReduce |= resolution > MinGridSize;
+				dfSelections[i].Size = DistanceFieldGridSize(minims[i], maxims[i], resolution);
+				totalMemory += (long long)dfSelections[i].Size.x * dfSelections[i].Size.y * dfSelections[i].Size.z * sizeof(float);
+			}
+			if (totalMemory <= DistanceFieldBudget || !canReduce)
+				break;
+			factor *= 0.99f * powf(DistanceFieldBudget / (float)totalMemory, 1 / 3.0f);
+		}
+#pragma endregion
+
+		for (int i = 0; i < geometryCount; i++)
+		{
+			int3 size = dfSelections[i].Size;
+			int resolution = max(size.x, max(size.y, size.z));
+			float3 extent = maxims[i] - minims[i];
+			float maxSize = maxf(extent.x, maxf(extent.y, extent.z));
+
+			gridTransforms[i] = mul(Transforms::Translate(-minims[i]), Transforms::Scale(resolution / maxSize));
+
+			dfSelections[i].Triangles = desc->Geometries().Data[i].IndexCount / 3;
+			dfSelections[i].CellSize = worldExtents[i] / resolution;
+			dfSelections[i].Memory = (long long)size.x * size.y * size.z * sizeof(float);
+			dfSelections[i].FromCache = false;
+		}
+
+		delete[] worldExtents;
+		delete[] desired;
+	}
+
+	// Inherited via IReportDistanceFields
+	virtual void getDistanceFields(DistanceFieldSelection*& selections, int& count) override {
+		selections = dfSelections;
+		count = scene->getScene()->Geometries().Count;
+	}
+
+	void UploadCachedGrids(gObj<GraphicsManager> manager) {
+		auto desc = scene->getScene();
+
+		for (int i = 0; i < desc->Geometries().Count; i++)
+			if (dfFromCache[i])
+				manager->ToGPU(perGeometryDF[i]);
+	}
+
+	void UploadBuiltGrids(gObj<GraphicsManager> manager) {
+		auto desc = scene->getScene();
+
+		for (int i = 0; i < desc->Geometries().Count; i++)
+			if (!dfFromCache[i])
+				manager->ToGPU(perGeometryDF[i]);
+	}
+
+	void DownloadBuiltGrids(gObj<GraphicsManager> manager) {
+		auto desc = scene->getScene();
+
+		for (int i = 0; i < desc->Geometries().Count; i++)
+			if (!dfFromCache[i])
+				manager->FromGPU(perGeometryDF[i]);
+	}
+
+	// Reads back the distance fields built in this session to store them in the cache and build the pyramids.
+	void ReadBackBuiltGrids() {
+		auto desc = scene->getScene();
+
+		Execute_OnGPU(DownloadBuiltGrids);
+		Flush().WaitFor();
+
+		float* field = new float[largestGridSize.x * largestGridSize.y * largestGridSize.z];
+		for (int i = 0; i < desc->Geometries().Count; i++)
+			if (!dfFromCache[i])
+			{
+				perGeometryDF[i]->Read((byte*)field);
+				if (UseDistanceFieldCache)
+					dfCache.Save(dfKeys[i], dfSelections[i].Size, field, gridTransforms[i]);
+#ifdef USE_DF_PYRAMID
+				CreatePyramid(i, field);
+#endif
+			}
+		delete[] field;
+	}
+
+	// Creates the texture of a geometry field to be built on the GPU.
+	void CreateGrid(int i) {
+		int3 size = dfSelections[i].Size;
+		perGeometryDF[i] = CreateTexture3DUAV<float>(size.x, size.y, size.z);
+		perGeometryDF[i]->SetDebugName(L"Distance Field");
+	}
+
+#ifdef USE_DF_PYRAMID
+	// Replaces the field of a geometry with a read-only texture holding the min-pyramid in its mips.
+	// The texture still has to be uploaded to the GPU.
+	void CreatePyramid(int i, const float* field) {
+		int3 size = dfSelections[i].Size;
+		DistanceFieldPyramid pyramid;
+		pyramid.Build(field, size);
+
+		perGeometryDF[i] = CreateTexture3DSRV<float>(size.x, size.y, size.z, pyramid.Levels);
+		perGeometryDF[i]->SetDebugName(L"Distance Field Pyramid");
+		perGeometryDF[i]->Write(pyramid.Data);
+
+		dfSelections[i].Memory = pyramid.Count * sizeof(float);
+		if (MeasurePyramidSteps)
+		{
+			DistanceFieldStepStatistics steps = MeasureSphereTracingSteps(pyramid);
+			dfSelections[i].MeasuredRays = steps.Rays;
+			dfSelections[i].FlatSteps = steps.FlatSteps;
+			dfSelections[i].PyramidSteps = steps.PyramidSteps;
+		}
+	}
+#endif
+
 	void BuildGrids(gObj<GraphicsManager> manager) {
 		auto desc = scene->getScene();
 
 		for (int i = 0; i < desc->Geometries().Count; i++)
 		{
+			if (dfFromCache[i])
+				continue;
+
 			auto geom = desc->Geometries().Data[i];
 
 #pragma region creating Grid for Geometry i
 			// Create grid with triangles linked lists
+			int3 size = dfSelections[i].Size;
+			int cells = size.x * size.y * size.z;
+
 			creatingGrid->GridTransform = gridTransforms[i];
 			creatingGrid->VertexBuffer = pipeline->VertexBuffer->Slice(geom.StartVertex, geom.VertexCount);
 			creatingGrid->IndexBuffer = pipeline->IndexBuffer->Slice(geom.StartIndex, geom.IndexCount);
@@ -242,22 +522,28 @@ struct SphereTracingBase : public PathtracingTechniqueBase {
 			computingInitialDistances->VertexBuffer = pipeline->VertexBuffer->Slice(geom.StartVertex, geom.VertexCount);
 			computingInitialDistances->IndexBuffer = pipeline->IndexBuffer->Slice(geom.StartIndex, geom.IndexCount);
 			computingInitialDistances->DistanceField = perGeometryDF[i];
-			computingInitialDistances->GridTransform = gridTransforms[i];
+			computingInitialDistances->GridTransform = { gridTransforms[i], size };
 			manager->SetPipeline(computingInitialDistances);
-			manager->Dispatch(GridSize * GridSize * GridSize / 1024);
-
-			// Spread distance for each possible level
-			for (int level = 0; level < ceil(log(GridSize) / log(3)); level++)
+			manager->Dispatch((int)ceil(cells / 1024.0));
+
+			// Spread distance for each possible level.
+			// Grids have different sizes and the temporal grid is shared, so the number of levels
+			// is forced to be even to end with the spread distances in the geometry grid.
+			int levels = (int)ceil(log(max(size.x, max(size.y, size.z))) / log(3));
+			levels += levels % 2;
+			gObj<Texture3D> src = perGeometryDF[i];
+			gObj<Texture3D> dst = tempGrid;
+			for (int level = 0; level < levels; level++)
 			{
-				spreadingDistances->GridSrc = perGeometryDF[i];
-				spreadingDistances->GridDst = tempGrid;
-				spreadingDistances->LevelInfo = level;
+				spreadingDistances->GridSrc = src;
+				spreadingDistances->GridDst = dst;
+				spreadingDistances->LevelInfo = { level, size };
 				manager->SetPipeline(spreadingDistances);
 
-				manager->Dispatch(GridSize * GridSize * GridSize / 1024);
+				manager->Dispatch((int)ceil(cells / 1024.0));
 
-				perGeometryDF[i] = spreadingDistances->GridDst;
-				tempGrid = spreadingDistances->GridSrc;
+				dst = spreadingDistances->GridSrc;
+				src = spreadingDistances->GridDst;
 			}
 #pragma endregion
 		}
@@ -0,0 +1,285 @@
+#pragma once
+
+#include "dx4xb_math.h"
+#include "../CPU/BatchFloat.h"
+#include "../CPU/PhaseSampling.h"
+#include "../CPU/Parallel.h"
+#include "../CPU/Stopwatch.h"
+
+using namespace dx4xb;
+
+// Bins of the exit variables (theta, beta and alpha in [-1, 1]) and of the scattering events (log2(N + 1))
+#define SPHERE_EXIT_BINS 32
+#define SPHERE_EVENT_BINS 24
+// Walks of a task of WalkSphereParallel
+#define SPHERE_WALK_CHUNK 65536
+
+/// Distribution of the exits of the walks inside the unit sphere for a (g, phi, r) configuration,
+/// with the variables of ExactSampleCosXAndW (STFPathtracing_RT.hlsl): theta is the cosine of the exit position
+/// with the incoming direction, beta and alpha the tangent and bitangent components of the exit direction.
+struct SphereExitStatistics {
+	long long Samples;
+	long long Exits;
+	// Sums over the exits
+	double Events;
+	double Theta, Beta, Alpha;
+	// Histograms of the exits
+	int EventBins[SPHERE_EVENT_BINS];
+	int ThetaBins[SPHERE_EXIT_BINS];
+	int BetaBins[SPHERE_EXIT_BINS];
+	int AlphaBins[SPHERE_EXIT_BINS];
+
+	static inline int Bin(float v) {
+		return max(0, min((int)((v * 0.5f + 0.5f) * SPHERE_EXIT_BINS), SPHERE_EXIT_BINS - 1));
+	}
+
+	void Clear() {
+		memset(this, 0, sizeof(SphereExitStatistics));
+	}
+
+	inline void AddAbsorbed() {
+		Samples++;
+	}
+
+	inline void AddExit(float events, float theta, float beta, float alpha) {
+		Samples++;
+		Exits++;
+		Events += events;
+		Theta += theta;
+		Beta += beta;
+		Alpha += alpha;
+		EventBins[min((int)log2f(events + 1), SPHERE_EVENT_BINS - 1)]++;
+		ThetaBins[Bin(theta)]++;
+		BetaBins[Bin(beta)]++;
+		AlphaBins[Bin(alpha)]++;
+	}
+
+	void Merge(const SphereExitStatistics& other) {
+		Samples += other.Samples;
+		Exits += other.Exits;
+		Events += other.Events;
+		Theta += other.Theta;
+		Beta += other.Beta;
+		Alpha += other.Alpha;
+		for (int i = 0; i < SPHERE_EVENT_BINS; i++)
+			EventBins[i] += other.EventBins[i];
+		for (int i = 0; i < SPHERE_EXIT_BINS; i++)
+		{
+			ThetaBins[i] += other.ThetaBins[i];
+			BetaBins[i] += other.BetaBins[i];
+			AlphaBins[i] += other.AlphaBins[i];
+		}
+	}
+
+	inline float ExitProbability() const { return Samples == 0 ? 0.0f : Exits / (float)Samples; }
+	inline float MeanEvents() const { return Exits == 0 ? 0.0f : (float)(Events / Exits); }
+	inline float MeanTheta() const { return Exits == 0 ? 0.0f : (float)(Theta / Exits); }
+
+	// Total variation distance between two normalized histograms, 0 for the same distribution and 1 if disjoint.
+	static float TotalVariation(const int* a, long long countA, const int* b, long long countB, int bins) {
+		if (countA == 0 || countB == 0)
+			return countA == countB ? 0.0f : 1.0f;
+		double distance = 0;
+		for (int i = 0; i < bins; i++)
+			distance += fabs(a[i] / (double)countA - b[i] / (double)countB);
+		return (float)(distance * 0.5);
+	}
+};
+
+/// Walks inside the unit sphere as ExactSampleCosXAndW with scattering coefficient r (optical radius), albedo phi and
+/// HG factor g: exponential free flights, absorption with probability 1 - phi and ImportanceSamplePhase at every event.
+/// With scatterAtCenter the walk starts with a scattering event at the center (as the paths sampled by the CVAE
+/// and the tabular samplers in the pathtracers and the dataset of generating/scatters.py), otherwise it starts with a
+/// free flight from the center as the shader function. The incoming direction is (0, 0, 1).
+/// BATCH_WIDTH walks advance at once, a lane starts a new walk when its walk ends.
+/// The walks are added to a SphereExitStatistics or to any accumulator with its AddExit and AddAbsorbed methods.
+template<typename Statistics>
+inline void WalkSphere(float g, float phi, float r, bool scatterAtCenter, int count, unsigned int seed, Statistics& statistics) {
+	// xorshift32 per lane
+	unsigned int states[BATCH_WIDTH];
+	for (int l = 0; l < BATCH_WIDTH; l++)
+	{
+		states[l] = (seed * 747796405u + 2891336453u) ^ ((l + 1) * 2654435761u);
+		if (states[l] == 0)
+			states[l] = 1;
+	}
+	auto random = [&states](int l) {
+		unsigned int state = states[l];
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		states[l] = state;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	float x[3][BATCH_WIDTH], w[3][BATCH_WIDTH], events[BATCH_WIDTH];
+	bool running[BATCH_WIDTH];
+	int started = 0;
+
+	// Starts the next walk in a lane, walks leaving without scattering are added directly.
+	// Returns false if there are no more walks.
+	auto start = [&](int l) {
+		while (started < count)
+		{
+			started++;
+			x[0][l] = x[1][l] = x[2][l] = 0;
+			w[0][l] = w[1][l] = 0;
+			w[2][l] = 1;
+			events[l] = 0;
+			if (scatterAtCenter)
+				return true;
+			float t = -logf(1 - random(l)) / r;
+			if (t < 1)
+			{
+				x[2][l] = t; // first flight
+				return true;
+			}
+			statistics.AddExit(0, 1, 0, 0);
+		}
+		return false;
+	};
+
+	batch_float gs = BatchSet(g);
+	batch_float absorption = BatchSet(1 - phi), invR = BatchSet(1 / r);
+	batch_float zero = BatchSet(0), one = BatchSet(1);
+
+	bool any = false;
+	for (int l = 0; l < BATCH_WIDTH; l++)
+		any |= running[l] = start(l);
+
+	float u[4][BATCH_WIDTH];
+	float absorbed[BATCH_WIDTH], exits[BATCH_WIDTH];
+	while (any)
+	{
+		for (int l = 0; l < BATCH_WIDTH; l++)
+			for (int i = 0; i < 4; i++)
+				u[i][l] = random(l);
+
+		batch_float px = BatchLoad(x[0]), py = BatchLoad(x[1]), pz = BatchLoad(x[2]);
+		batch_float dx = BatchLoad(w[0]), dy = BatchLoad(w[1]), dz = BatchLoad(w[2]);
+
+		BatchStore(absorbed, BatchSelectLess(BatchLoad(u[0]), absorption, one, zero));
+
+		// scattering event (ImportanceSamplePhase)
+		BatchSamplePhase(gs, dx, dy, dz, BatchLoad(u[2]), BatchLoad(u[1]));
+
+		// DistanceToSphereBoundary
+		batch_float b = BatchMul(BatchSet(2), BatchMulAdd(px, dx, BatchMulAdd(py, dy, BatchMul(pz, dz))));
+		batch_float c = BatchSub(BatchMulAdd(px, px, BatchMulAdd(py, py, BatchMul(pz, pz))), one);
+		batch_float disc = BatchSub(BatchMul(b, b), BatchMul(BatchSet(4), c));
+		batch_float d = BatchMax(zero, BatchMul(BatchSet(0.5f), BatchAdd(BatchSub(zero, b), BatchSqrt(BatchMax(zero, disc)))));
+		d = BatchSelectLess(zero, disc, d, zero);
+
+		// free flight
+		batch_float t = BatchMul(BatchSub(zero, BatchLog(BatchMax(BatchSet(0.000000001f), BatchSub(one, BatchLoad(u[3]))))), invR);
+		BatchStore(exits, BatchSelectLess(t, d, zero, one));
+		t = BatchMin(t, d);
+		BatchStore(x[0], BatchMulAdd(t, dx, px));
+		BatchStore(x[1], BatchMulAdd(t, dy, py));
+		BatchStore(x[2], BatchMulAdd(t, dz, pz));
+		BatchStore(w[0], dx);
+		BatchStore(w[1], dy);
+		BatchStore(w[2], dz);
+
+		any = false;
+		for (int l = 0; l < BATCH_WIDTH; l++)
+		{
+			if (!running[l])
+				continue;
+			if (absorbed[l] != 0)
+			{
+				statistics.AddAbsorbed();
+				running[l] = start(l);
+			}
+			else
+			{
+				events[l]++;
+				if (exits[l] != 0)
+				{
+					// exit in the frame of the shader, normx = (0, sin, cos), B = (1, 0, 0) and T = cross(normx, B)
+					float3 p = float3(x[0][l], x[1][l], x[2][l]);
+					float3 v = float3(w[0][l], w[1][l], w[2][l]);
+					float3 xAxis = fabsf(p.z) > 0.999f ? float3(1, 0, 0) : normalize(float3(p.y, -p.x, 0));
+					float3 yAxis = float3(-xAxis.y, xAxis.x, 0);
+					float3 normx = float3(dot(p, xAxis), dot(p, yAxis), p.z);
+					float3 normw = float3(dot(v, xAxis), dot(v, yAxis), v.z);
+					statistics.AddExit(events[l], normx.z, normw.y * normx.z - normw.z * normx.y, normw.x);
+					running[l] = start(l);
+				}
+			}
+			any |= running[l];
+		}
+	}
+}
+
+/// WalkSphere of count walks in chunks of SPHERE_WALK_CHUNK walks over threads threads (the logical processors by default).
+/// Every chunk has its own seed, the statistics are the same for any number of threads.
+inline void WalkSphereParallel(float g, float phi, float r, bool scatterAtCenter, int count, unsigned int seed,
+	SphereExitStatistics& statistics, int threads = 0) {
+	int chunks = (count + SPHERE_WALK_CHUNK - 1) / SPHERE_WALK_CHUNK;
+	SphereExitStatistics* chunkStatistics = new SphereExitStatistics[max(1, chunks)];
+	ParallelFor(chunks, [&](int chunk, int) {
+		chunkStatistics[chunk].Clear();
+		WalkSphere(g, phi, r, scatterAtCenter, min(SPHERE_WALK_CHUNK, count - chunk * SPHERE_WALK_CHUNK),
+			seed * 7919u + chunk, chunkStatistics[chunk]);
+	}, threads);
+	statistics.Clear();
+	for (int chunk = 0; chunk < chunks; chunk++)
+		statistics.Merge(chunkStatistics[chunk]);
+	delete[] chunkStatistics;
+}
+
+/// Scalar version of the walk (ExactSampleCosXAndW) used to check WalkSphere.
+inline void WalkSphereScalar(float g, float phi, float r, bool scatterAtCenter, int count, unsigned int seed, SphereExitStatistics& statistics) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto random = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	for (int s = 0; s < count; s++)
+	{
+		float3 x = float3(0, 0, 0);
+		float3 w = float3(0, 0, 1);
+		if (!scatterAtCenter)
+		{
+			float t = -logf(1 - random()) / r;
+			if (t >= 1)
+			{
+				statistics.AddExit(0, 1, 0, 0);
+				continue;
+			}
+			x.z = t;
+		}
+		for (int events = 1; ; events++)
+		{
+			if (random() < 1 - phi)
+			{
+				statistics.AddAbsorbed();
+				break;
+			}
+
+			float uCos = random();
+			w = SamplePhase(g, w, random(), uCos);
+
+			float b = 2 * dot(x, w);
+			float c = dot(x, x) - 1;
+			float disc = b * b - 4 * c;
+			float d = disc <= 0 ? 0 : maxf(0.0f, (-b + sqrtf(disc)) * 0.5f);
+			float t = -logf(maxf(0.000000001f, 1 - random())) / r;
+			if (t >= d)
+			{
+				x = x + w * d;
+				float3 xAxis = fabsf(x.z) > 0.999f ? float3(1, 0, 0) : normalize(float3(x.y, -x.x, 0));
+				float3 yAxis = float3(-xAxis.y, xAxis.x, 0);
+				float3 normx = float3(dot(x, xAxis), dot(x, yAxis), x.z);
+				float3 normw = float3(dot(w, xAxis), dot(w, yAxis), w.z);
+				statistics.AddExit((float)events, normx.z, normw.y * normx.z - normw.z * normx.y, normw.x);
+				break;
+			}
+			x = x + w * t;
+		}
+	}
+}
@@ -0,0 +1,539 @@
+#pragma once
+
+#include "SphereWalk.h"
+#include "TabularFile.h"
+
+// Version of the checkpoint of a table build.
+#define TABLE_BUILD_CHECKPOINT_VERSION 1
+// Walks of a task of BuildTables.
+#define TABLE_BUILD_CHUNK 4096
+// Scattering events counted exactly by the STF build, the albedo weights of longer walks are added at their exit.
+#define STF_BUILD_EXACT_EVENTS 256
+// Albedo weights phi^N not added for longer walks.
+#define STF_BUILD_MIN_WEIGHT 1e-12
+
+/// Resolution and sampling of a table build. Bins are the axes of the tables of the method,
+/// TABULAR_METHOD_STF: g, phi, r and theta (200 x 1000 x 9 x 45 in STFTechnique),
+/// TABULAR_METHOD_STFX: g, r, logN, theta, beta and alpha (100 x 8 x 100 x 40 x 20 x 10 in STFXTechnique).
+struct TableBuildSettings {
+	unsigned int Method;
+	unsigned int Bins[TABULAR_MAX_AXES];
+	// Walks per (g, r) bin
+	int Walks;
+	unsigned int Seed;
+};
+
+inline TableBuildSettings STFBuildSettings(int walks, unsigned int seed = 1) {
+	return { TABULAR_METHOD_STF, { 200, 1000, 9, 45 }, walks, seed };
+}
+
+inline TableBuildSettings STFXBuildSettings(int walks, unsigned int seed = 1) {
+	return { TABULAR_METHOD_STFX, { 100, 8, 100, 40, 20, 10 }, walks, seed };
+}
+
+/// State of a table build, reported when a g bin is written.
+struct TableBuildProgress {
+	// g bins of the tables, written and written by a resumed build
+	int Slices;
+	int Completed;
+	int Resumed;
+	// Walks and time of this build and estimated time to complete it
+	long long Walks;
+	float Milliseconds;
+	float RemainingMilliseconds;
+};
+
+/// Header of the checkpoint of a table build (file.checkpoint), followed by a byte per g bin set when its tables are
+/// written in the partial file (file.tmp).
+struct TableBuildCheckpointHeader {
+	char Magic[4]; // "TBCK"
+	unsigned int FileVersion;
+	TableBuildSettings Settings;
+	unsigned int Slices;
+};
+
+static_assert(sizeof(TableBuildCheckpointHeader) == 48, "Table build checkpoint header must be packed");
+
+// Values at the center of the bins, as the shaders map g, phi and r to bins.
+inline float TableBinG(int bin, int bins) {
+	return (bin + 0.5f) * 2 / bins - 1;
+}
+
+// SampleCosXAndW (STFPathtracing_RT.hlsl) maps phi linearly in log(1 / (1 - phi)) to the bins - 1 first bins up to 0.999,
+// the last bin is phi > 0.999 (built as 1).
+inline float STFBinPhi(int bin, int bins) {
+	return bin >= bins - 1 ? 1.0f : 1 - expf(-(bin + 0.5f) * logf(1000.0f) / (bins - 2));
+}
+
+inline float STFBinR(int bin) {
+	return powf(2.0f, (float)bin);
+}
+
+// SampleCosXAndW (STFXPathtracing_RT.hlsl) maps r >= 1 to log2(r) + 0.5 and interpolates linearly between
+// the bins 0 and 1 below, the bin 0 is r = 0.
+inline float STFXBinR(int bin) {
+	return bin == 0 ? 0.0f : powf(2.0f, bin - 0.5f);
+}
+
+inline int TableBin(float v, int bins) {
+	return max(0, min((int)((v * 0.5f + 0.5f) * bins), bins - 1));
+}
+
+/// Exits of the walks of a (g, r) bin added by a thread for STF, the walks are not absorbed (phi = 1) and the
+/// albedo of every phi bin weights the exits by phi^N. Walks leaving without scattering are not added
+/// (SampleCosXAndW samples them with exp(-r)).
+struct STFBuildAccumulator {
+	int Phi, Theta;
+	const float* LogPhi;
+	// Exits with N <= STF_BUILD_EXACT_EVENTS [N][theta]
+	unsigned int* Events;
+	// Sum of phi^N of the exits with more events [phi][theta]
+	double* Weights;
+
+	void Create(int phi, int theta, const float* logPhi) {
+		Phi = phi;
+		Theta = theta;
+		LogPhi = logPhi;
+		Events = new unsigned int[(STF_BUILD_EXACT_EVENTS + 1) * theta];
+		Weights = new double[phi * theta];
+	}
+
+	void Destroy() {
+		delete[] Events;
+		delete[] Weights;
+	}
+
+	void Clear() {
+		memset(Events, 0, sizeof(unsigned int) * (STF_BUILD_EXACT_EVENTS + 1) * Theta);
+		memset(Weights, 0, sizeof(double) * Phi * Theta);
+	}
+
+	inline void AddAbsorbed() {
+	}
+
+	inline void AddExit(float events, float theta, float /*beta*/, float /*alpha*/) {
+		int N = (int)events;
+		if (N == 0)
+			return;
+		int bin = TableBin(theta, Theta);
+		if (N <= STF_BUILD_EXACT_EVENTS)
+		{
+			Events[N * Theta + bin]++;
+			return;
+		}
+		// phi increases with the bin
+		for (int p = Phi - 1; p >= 0; p--)
+		{
+			double weight = exp(N * (double)LogPhi[p]);
+			if (weight < STF_BUILD_MIN_WEIGHT)
+				break;
+			Weights[p * Theta + bin] += weight;
+		}
+	}
+
+	void Merge(const STFBuildAccumulator& other) {
+		for (int i = 0; i < (STF_BUILD_EXACT_EVENTS + 1) * Theta; i++)
+			Events[i] += other.Events[i];
+		for (int i = 0; i < Phi * Theta; i++)
+			Weights[i] += other.Weights[i];
+	}
+};
+
+/// Exits of the walks of a (g, r) bin added by a thread for STFX, the walks start with a scattering at the center
+/// and are not absorbed (SampleCosXAndW absorbs with 1 - phi^N).
+struct STFXBuildAccumulator {
+	int LogN, Theta, Beta, Alpha;
+	// Exits [logN][theta][beta][alpha]
+	unsigned int* Exits;
+
+	void Create(int logN, int theta, int beta, int alpha) {
+		LogN = logN;
+		Theta = theta;
+		Beta = beta;
+		Alpha = alpha;
+		Exits = new unsigned int[logN * theta * beta * alpha];
+	}
+
+	void Destroy() {
+		delete[] Exits;
+	}
+
+	void Clear() {
+		memset(Exits, 0, sizeof(unsigned int) * LogN * Theta * Beta * Alpha);
+	}
+
+	inline void AddAbsorbed() {
+	}
+
+	inline void AddExit(float events, float theta, float beta, float alpha) {
+		// logN in [0, 8)
+		int logN = min((int)(logf(maxf(1.0f, events)) * LogN / 8), LogN - 1);
+		Exits[((logN * Theta + TableBin(theta, Theta)) * Beta + TableBin(beta, Beta)) * Alpha + TableBin(alpha, Alpha)]++;
+	}
+
+	void Merge(const STFXBuildAccumulator& other) {
+		for (int i = 0; i < LogN * Theta * Beta * Alpha; i++)
+			Exits[i] += other.Exits[i];
+	}
+};
+
+/// Builds the tables of STFTechnique or STFXTechnique with the walks of WalkSphere over threads threads (the logical
+/// processors by default), every thread adds its walks to its own accumulator. The tables are written in the layout
+/// of stf2.bin (one and multiple scattering albedos [g][phi][r] and cdfs of theta [g][phi][r][theta] ending at the
+/// multiple scattering albedo) or stfx.bin (normalized cdfs of logN [g][r][logN] and of the exit [g][r][logN][x]),
+/// see ConvertSTFTables and ConvertSTFXTables for other resolutions.
+/// The file is built aside (file.tmp) by g bins and every written bin is recorded in file.checkpoint, a build with the
+/// same settings resumes from the bins written before and a build with other settings starts again.
+/// progress(const TableBuildProgress&) is called when a g bin is written, the build stops if it returns false.
+/// Returns false if the settings are not valid, the files can not be written or the build was stopped (keeping the
+/// written bins).
+template<typename Progress>
+inline bool BuildTables(const char* fileName, const TableBuildSettings& settings, Progress progress, int threads = 0) {
+	const unsigned int* bins = settings.Bins;
+	bool stf = settings.Method == TABULAR_METHOD_STF;
+	int axes = stf ? 4 : 6;
+	if ((!stf && settings.Method != TABULAR_METHOD_STFX) || settings.Walks <= 0)
+		return false;
+	for (int a = 0; a < axes; a++)
+		if (bins[a] == 0 || bins[a] > 65536)
+			return false;
+	if (stf && bins[1] < 3)
+		return false;
+
+	// parts of a g bin in the file, all tables are [g]...
+	int G = bins[0], R = stf ? bins[2] : bins[1];
+	unsigned long long partSizes[3];
+	int parts;
+	if (stf)
+	{
+		parts = 3;
+		partSizes[0] = partSizes[1] = (unsigned long long)bins[1] * bins[2];
+		partSizes[2] = partSizes[0] * bins[3];
+	}
+	else
+	{
+		parts = 2;
+		partSizes[0] = (unsigned long long)bins[1] * bins[2];
+		partSizes[1] = partSizes[0] * bins[3] * bins[4] * bins[5];
+	}
+	unsigned long long sliceSize = 0, partOffsets[3];
+	for (int p = 0; p < parts; p++)
+	{
+		partOffsets[p] = sliceSize * G;
+		sliceSize += partSizes[p];
+	}
+	unsigned long long fileSize = sliceSize * G * sizeof(float);
+
+	char tempFileName[MAX_PATH], checkpointFileName[MAX_PATH];
+	sprintf_s(tempFileName, "%s.tmp", fileName);
+	sprintf_s(checkpointFileName, "%s.checkpoint", fileName);
+
+	TableBuildCheckpointHeader header = {};
+	memcpy(header.Magic, "TBCK", 4);
+	header.FileVersion = TABLE_BUILD_CHECKPOINT_VERSION;
+	header.Settings = settings;
+	for (int a = axes; a < TABULAR_MAX_AXES; a++)
+		header.Settings.Bins[a] = 0;
+	header.Slices = G;
+
+	// resumes a build with the same settings
+	byte* written = new byte[G];
+	memset(written, 0, G);
+	bool resumed = false;
+	FILE* checkpoint = nullptr;
+	FILE* data = nullptr;
+	if (fopen_s(&checkpoint, checkpointFileName, "r+b") == 0)
+	{
+		TableBuildCheckpointHeader saved;
+		resumed = fread(&saved, sizeof(TableBuildCheckpointHeader), 1, checkpoint) == 1 &&
+			memcmp(&saved, &header, sizeof(TableBuildCheckpointHeader)) == 0 &&
+			fread(written, 1, G, checkpoint) == (size_t)G &&
+			fopen_s(&data, tempFileName, "r+b") == 0 &&
+			_fseeki64(data, 0, SEEK_END) == 0 && (unsigned long long)_ftelli64(data) == fileSize;
+		if (!resumed)
+		{
+			fclose(checkpoint);
+			checkpoint = nullptr;
+			if (data)
+				fclose(data);
+			data = nullptr;
+			memset(written, 0, G);
+		}
+	}
+	if (!resumed)
+	{
+		bool created = fopen_s(&data, tempFileName, "wb") == 0 &&
+			_fseeki64(data, (long long)fileSize - 1, SEEK_SET) == 0 && fputc(0, data) == 0 && fflush(data) == 0 &&
+			fopen_s(&checkpoint, checkpointFileName, "wb") == 0 &&
+			fwrite(&header, sizeof(TableBuildCheckpointHeader), 1, checkpoint) == 1 &&
+			fwrite(written, 1, G, checkpoint) == (size_t)G && fflush(checkpoint) == 0;
+		if (!created)
+		{
+			if (data)
+				fclose(data);
+			if (checkpoint)
+				fclose(checkpoint);
+			delete[] written;
+			return false;
+		}
+	}
+
+	TableBuildProgress state = {};
+	state.Slices = G;
+	for (int g = 0; g < G; g++)
+		state.Resumed += written[g];
+	state.Completed = state.Resumed;
+
+	int workers = max(1, threads > 0 ? threads : ProcessorCount());
+	STFBuildAccumulator* stfAccumulators = nullptr;
+	STFXBuildAccumulator* stfxAccumulators = nullptr;
+	float* logPhi = nullptr;
+	if (stf)
+	{
+		logPhi = new float[bins[1]];
+		for (int p = 0; p < (int)bins[1]; p++)
+			logPhi[p] = logf(STFBinPhi(p, bins[1]));
+		stfAccumulators = new STFBuildAccumulator[workers];
+		for (int t = 0; t < workers; t++)
+			stfAccumulators[t].Create(bins[1], bins[3], logPhi);
+	}
+	else
+	{
+		stfxAccumulators = new STFXBuildAccumulator[workers];
+		for (int t = 0; t < workers; t++)
+			stfxAccumulators[t].Create(bins[2], bins[3], bins[4], bins[5]);
+	}
+	float* slice = new float[sliceSize];
+	double* powers = new double[STF_BUILD_EXACT_EVENTS + 1];
+
+	int chunks = (settings.Walks + TABLE_BUILD_CHUNK - 1) / TABLE_BUILD_CHUNK;
+	bool failed = false, stopped = false;
+	Stopwatch stopwatch;
+	for (int g = 0; g < G && !failed; g++)
+	{
+		if (written[g])
+			continue;
+
+		for (int r = 0; r < R; r++)
+		{
+			float gValue = TableBinG(g, G);
+			float rValue = stf ? STFBinR(r) : maxf(0.001f, STFXBinR(r));
+			unsigned int cellSeed = settings.Seed * 7919u + (unsigned int)((g * R + r) * chunks);
+			for (int t = 0; t < workers; t++)
+				if (stf)
+					stfAccumulators[t].Clear();
+				else
+					stfxAccumulators[t].Clear();
+
+			ParallelFor(chunks, [&](int chunk, int thread) {
+				int count = min(TABLE_BUILD_CHUNK, settings.Walks - chunk * TABLE_BUILD_CHUNK);
+				if (stf)
+					WalkSphere(gValue, 1.0f, rValue, false, count, cellSeed + chunk, stfAccumulators[thread]);
+				else
+					WalkSphere(gValue, 1.0f, rValue, true, count, cellSeed + chunk, stfxAccumulators[thread]);
+			}, workers);
+			state.Walks += settings.Walks;
+
+			if (stf)
+			{
+				STFBuildAccumulator& total = stfAccumulators[0];
+				for (int t = 1; t < workers; t++)
+					total.Merge(stfAccumulators[t]);
+				int Phi = bins[1], Theta = bins[3];
+				float* oneTimeSA = slice;
+				float* multiTimeSA = slice + partSizes[0];
+				float* cdfs = slice + partSizes[0] + partSizes[1];
+				double once = 0;
+				for (int t = 0; t < Theta; t++)
+					once += total.Events[Theta + t];
+				for (int p = 0; p < Phi; p++)
+				{
+					double phi = STFBinPhi(p, Phi);
+					powers[0] = 1;
+					for (int N = 1; N <= STF_BUILD_EXACT_EVENTS; N++)
+						powers[N] = powers[N - 1] * phi;
+					double cdf = 0;
+					float* row = cdfs + ((unsigned long long)p * R + r) * Theta;
+					for (int t = 0; t < Theta; t++)
+					{
+						double mass = total.Weights[p * Theta + t];
+						for (int N = 2; N <= STF_BUILD_EXACT_EVENTS; N++)
+							mass += total.Events[N * Theta + t] * powers[N];
+						cdf += mass;
+						row[t] = (float)(cdf / settings.Walks);
+					}
+					oneTimeSA[p * R + r] = (float)(once * phi / settings.Walks);
+					multiTimeSA[p * R + r] = row[Theta - 1];
+				}
+			}
+			else
+			{
+				STFXBuildAccumulator& total = stfxAccumulators[0];
+				for (int t = 1; t < workers; t++)
+					total.Merge(stfxAccumulators[t]);
+				int LogN = bins[2], X = bins[3] * bins[4] * bins[5];
+				float* logNCDF = slice + (unsigned long long)r * LogN;
+				float* xCDFs = slice + partSizes[0] + (unsigned long long)r * LogN * X;
+				unsigned long long exits = 0;
+				for (int n = 0; n < LogN; n++)
+				{
+					const unsigned int* counts = total.Exits + (unsigned long long)n * X;
+					unsigned long long rowExits = 0;
+					for (int x = 0; x < X; x++)
+						rowExits += counts[x];
+					float* row = xCDFs + (unsigned long long)n * X;
+					unsigned long long cdf = 0;
+					for (int x = 0; x < X; x++)
+					{
+						cdf += counts[x];
+						row[x] = rowExits == 0 ? 0.0f : (float)((double)cdf / rowExits);
+					}
+					if (rowExits > 0)
+						row[X - 1] = 1;
+					exits += rowExits;
+					logNCDF[n] = (float)exits;
+				}
+				for (int n = 0; n < LogN; n++)
+					logNCDF[n] = exits == 0 ? 0.0f : logNCDF[n] / exits;
+				if (exits > 0)
+					logNCDF[LogN - 1] = 1;
+			}
+		}
+
+		// tables of the g bin, then its mark in the checkpoint
+		const float* part = slice;
+		for (int p = 0; p < parts && !failed; p++)
+		{
+			failed = _fseeki64(data, (long long)((partOffsets[p] + partSizes[p] * g) * sizeof(float)), SEEK_SET) != 0 ||
+				fwrite(part, sizeof(float), partSizes[p], data) != partSizes[p];
+			part += partSizes[p];
+		}
+		failed = failed || fflush(data) != 0;
+		written[g] = 1;
+		failed = failed || _fseeki64(checkpoint, (long long)(sizeof(TableBuildCheckpointHeader) + g), SEEK_SET) != 0 ||
+			fwrite(&written[g], 1, 1, checkpoint) != 1 || fflush(checkpoint) != 0;
+		if (failed)
+			break;
+
+		state.Completed++;
+		state.Milliseconds = stopwatch.Milliseconds();
+		state.RemainingMilliseconds = state.Milliseconds * (G - state.Completed) / (state.Completed - state.Resumed);
+		if (!progress(state))
+		{
+			stopped = true;
+			break;
+		}
+	}
+
+	delete[] powers;
+	delete[] slice;
+	for (int t = 0; t < workers; t++)
+		if (stf)
+			stfAccumulators[t].Destroy();
+		else
+			stfxAccumulators[t].Destroy();
+	delete[] stfAccumulators;
+	delete[] stfxAccumulators;
+	delete[] logPhi;
+	delete[] written;
+
+	fclose(data);
+	fclose(checkpoint);
+	if (failed || stopped || !MoveFileExA(tempFileName, fileName, MOVEFILE_REPLACE_EXISTING))
+		return false;
+	DeleteFileA(checkpointFileName);
+	return true;
+}
+
+/// Builds the tables without reporting the progress.
+inline bool BuildTables(const char* fileName, const TableBuildSettings& settings, int threads = 0) {
+	return BuildTables(fileName, settings, [](const TableBuildProgress&) { return true; }, threads);
+}
+
+/// A table build stopped after some g bins and resumed, against a build without stops.
+/// The files are named after fileName (fileName and fileName.full, with their .tmp and .checkpoint) and removed at the end.
+struct TableBuildResumeCheck {
+	int Slices;
+	// Builds that failed (or the stopped build if it didn't stop), and stopped builds that left the final file
+	int Failures;
+	int StoppedFiles;
+	// g bins written by the stopped build and reported as resumed by the next one
+	int Stopped;
+	int Resumed;
+	// Size of the files, and bytes of the resumed file different from the file without stops
+	long long Bytes;
+	long long SizeDifference;
+	long long Mismatches;
+};
+
+inline TableBuildResumeCheck CheckTableBuildResume(const char* fileName, const TableBuildSettings& settings, int stopAfter, int threads = 4) {
+	char fullFileName[MAX_PATH];
+	sprintf_s(fullFileName, "%s.full", fileName);
+	const char* names[] = { fileName, fullFileName };
+	for (const char* name : names)
+	{
+		char aside[MAX_PATH];
+		DeleteFileA(name);
+		sprintf_s(aside, "%s.tmp", name);
+		DeleteFileA(aside);
+		sprintf_s(aside, "%s.checkpoint", name);
+		DeleteFileA(aside);
+	}
+
+	TableBuildResumeCheck check = {};
+	if (!BuildTables(fullFileName, settings, threads))
+		check.Failures++;
+
+	bool built = BuildTables(fileName, settings, [&](const TableBuildProgress& state) {
+		check.Slices = state.Slices;
+		check.Stopped = state.Completed;
+		return state.Completed < stopAfter;
+	}, threads);
+	if (built)
+		check.Failures++;
+	FILE* stopped;
+	if (fopen_s(&stopped, fileName, "rb") == 0)
+	{
+		check.StoppedFiles++;
+		fclose(stopped);
+	}
+
+	bool first = true;
+	built = BuildTables(fileName, settings, [&](const TableBuildProgress& state) {
+		if (first)
+			check.Resumed = state.Resumed;
+		first = false;
+		return true;
+	}, threads);
+	if (!built)
+		check.Failures++;
+
+	FILE* files[2] = {};
+	if (fopen_s(&files[0], fileName, "rb") == 0 && fopen_s(&files[1], fullFileName, "rb") == 0)
+	{
+		const int BLOCK = 1 << 16;
+		byte* blocks[2] = { new byte[BLOCK], new byte[BLOCK] };
+		while (true)
+		{
+			size_t read0 = fread(blocks[0], 1, BLOCK, files[0]);
+			size_t read1 = fread(blocks[1], 1, BLOCK, files[1]);
+			for (size_t i = 0; i < min(read0, read1); i++)
+				check.Mismatches += blocks[0][i] != blocks[1][i];
+			check.Bytes += min(read0, read1);
+			check.SizeDifference += (long long)read0 - (long long)read1;
+			if (read0 < BLOCK || read1 < BLOCK)
+				break;
+		}
+		delete[] blocks[0];
+		delete[] blocks[1];
+	}
+	else
+		check.Failures++;
+	for (FILE* file : files)
+		if (file)
+			fclose(file);
+
+	DeleteFileA(fileName);
+	DeleteFileA(fullFileName);
+	return check;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "dx4xb_scene.h"
+#include "../CPU/MappedFile.h"
+#include "../CPU/Stopwatch.h"
+
+using namespace dx4xb;
+
+/// Cost of loading the tables of a tabular technique (STFTechnique and STFXTechnique).
+struct TableLoadStatistics {
+	bool Loaded;
+	// Bytes read from the file
+	unsigned long long Bytes;
+	// Time to write the tables from the file to uploading memory, and until the tables are on the GPU
+	float ReadMilliseconds;
+	float TotalMilliseconds;
+	// Pages reachable from the volume materials without a slot in the last update, their media are pathtraced
+	int MissingPages;
+	// Peaks of the process after loading
+	ProcessMemoryPeaks Memory;
+};
+
+/// Reports to the debugger the pages reachable from the volume materials that got no slot.
+inline void ReportMissingPages(const char* technique, int missing, int reachable, int slots) {
+	char message[256];
+	sprintf_s(message, "%s: %d of %d reachable table pages have no slot (%d slots), their media are pathtraced\n",
+		technique, missing, reachable, slots);
+	OutputDebugStringA(message);
+}
+
+/// Writes a page of elements elements of a mapped table to a slot of the buffer and copies the slot to the GPU.
+inline void LoadTablePage(gObj<GraphicsManager> manager, gObj<Buffer> buffer, const float* page, int slot, int elements) {
+	D3D12_BOX region = { (UINT)(slot * elements), 0, 0, (UINT)((slot + 1) * elements), 1, 1 };
+	buffer->Write((byte*)page, region);
+	manager->ToGPU(buffer.Static_Cast<ResourceView>(), region);
+}
@@ -0,0 +1,205 @@
+#pragma once
+
+#include "dx4xb_scene.h"
+
+using namespace dx4xb;
+
+// Slot of a page that is not resident.
+#define TABLE_PAGE_NONE -1
+// Distance (in bins) to a bin boundary below which the bins at both sides are reachable,
+// the shaders may round the bin of a value to the other side.
+#define TABLE_PAGE_BIN_MARGIN 0.001f
+
+/// Page of a table to write in a slot of the resident tables.
+struct TablePageLoad {
+	int Page;
+	int Slot;
+};
+
+/// Residency of the pages of a table in a fixed number of slots, replacing the least recently required pages.
+/// The page table maps every page to its slot (TABLE_PAGE_NONE if it is not resident) and is read by the shaders
+/// to index the slots, pages no longer required stay resident until their slots are needed.
+class TablePageCache {
+	int pages = 0;
+	int slots = 0;
+	int* pageTable = nullptr;
+	int* slotPages = nullptr;
+	unsigned long long* slotUses = nullptr;
+	unsigned long long uses = 0;
+	int resident = 0;
+	int missing = 0;
+
+public:
+	TablePageCache() {}
+	TablePageCache(const TablePageCache&) = delete;
+	TablePageCache& operator = (const TablePageCache&) = delete;
+
+	~TablePageCache() {
+		Destroy();
+	}
+
+	void Create(int pages, int slots) {
+		Destroy();
+		this->pages = pages;
+		this->slots = slots;
+		pageTable = new int[pages];
+		slotPages = new int[slots];
+		slotUses = new unsigned long long[slots];
+		for (int p = 0; p < pages; p++)
+			pageTable[p] = TABLE_PAGE_NONE;
+		for (int s = 0; s < slots; s++)
+		{
+			slotPages[s] = TABLE_PAGE_NONE;
+			slotUses[s] = 0;
+		}
+		uses = 0;
+		resident = 0;
+		missing = 0;
+	}
+
+	void Destroy() {
+		delete[] pageTable;
+		delete[] slotPages;
+		delete[] slotUses;
+		pageTable = nullptr;
+		slotPages = nullptr;
+		slotUses = nullptr;
+		pages = 0;
+		slots = 0;
+	}
+
+	// Makes the required pages resident and adds the pages to write in their slots to loads.
+	// Slots of pages not required now are reused from the least recently required, the required pages that
+	// don't fit stay not resident (see Missing). Returns the number of pages to write.
+	int Require(const list<int>& required, list<TablePageLoad>& loads) {
+		uses++;
+		for (int i = 0; i < required.size(); i++)
+		{
+			int slot = pageTable[required[i]];
+			if (slot != TABLE_PAGE_NONE)
+				slotUses[slot] = uses;
+		}
+
+		int count = 0;
+		missing = 0;
+		for (int i = 0; i < required.size(); i++)
+		{
+			int page = required[i];
+			if (pageTable[page] != TABLE_PAGE_NONE)
+				continue;
+
+			// free slot or least recently required
+			int slot = TABLE_PAGE_NONE;
+			for (int s = 0; s < slots; s++)
+				if (slotUses[s] < uses && (slot == TABLE_PAGE_NONE || slotUses[s] < slotUses[slot]))
+				{
+					slot = s;
+					if (slotPages[s] == TABLE_PAGE_NONE)
+						break;
+				}
+			if (slot == TABLE_PAGE_NONE)
+			{
+				missing++;
+				continue;
+			}
+
+			if (slotPages[slot] != TABLE_PAGE_NONE)
+				pageTable[slotPages[slot]] = TABLE_PAGE_NONE;
+			else
+				resident++;
+			slotPages[slot] = page;
+			slotUses[slot] = uses;
+			pageTable[page] = slot;
+			loads.add({ page, slot });
+			count++;
+		}
+		return count;
+	}
+
+	inline int Pages() const { return pages; }
+
+	inline int Slots() const { return slots; }
+
+	// Pages in the slots.
+	inline int Resident() const { return resident; }
+
+	// Required pages of the last Require without a slot.
+	inline int Missing() const { return missing; }
+
+	inline int Slot(int page) const { return pageTable[page]; }
+
+	// Slot of every page.
+	inline const int* PageTable() const { return pageTable; }
+};
+
+// Adds the bins at coordinate (in bins) and at the margin at both sides.
+inline void AddReachableBins(float coordinate, int bins, int* found, int& count) {
+	int candidates[] = {
+		(int)(coordinate - TABLE_PAGE_BIN_MARGIN), (int)coordinate, (int)(coordinate + TABLE_PAGE_BIN_MARGIN)
+	};
+	for (int c = 0; c < 3; c++)
+	{
+		int bin = max(0, min(candidates[c], bins - 1));
+		bool added = false;
+		for (int i = 0; i < count; i++)
+			added |= found[i] == bin;
+		if (!added)
+			found[count++] = bin;
+	}
+}
+
+inline void AddReachablePage(int page, list<int>& pages) {
+	for (int i = 0; i < pages.size(); i++)
+		if (pages[i] == page)
+			return;
+	pages.add(page);
+}
+
+// gBin = min((g * 0.5 + 0.5) * BINS_G, BINS_G - 1) in the shaders.
+inline int ReachableGBins(float g, int binsG, int* found) {
+	int count = 0;
+	AddReachableBins((g * 0.5f + 0.5f) * binsG, binsG, found, count);
+	return count;
+}
+
+/// Pages of the STF tables (gBin * binsPhi + phiBin as PageSlot in STFPathtracing_RT.hlsl) reachable from the volume materials,
+/// for every channel with extinction of every material. phiMapBins is the phiBins of the sampler (PHI_BINS_SampleCosXAndW*).
+inline void ReachableSTFPages(const VolumeMaterial* materials, int count, int binsG, int binsPhi, int phiMapBins, list<int>& pages) {
+	for (int m = 0; m < count; m++)
+		for (int c = 0; c < 3; c++)
+		{
+			VolumeMaterial material = materials[m];
+			if (material.Extinction[c] <= 0)
+				continue;
+			int gBins[3], phiBins[4];
+			int gCount = ReachableGBins(material.G[c], binsG, gBins);
+
+			// log(1 / (1 - phi)) linear up to 0.999, the last bin above
+			float phi = clamp(material.ScatteringAlbedo[c], 0.0f, 1.0f);
+			int phiCount = 0;
+			if (phi > 0.999f - 0.00001f)
+				phiBins[phiCount++] = binsPhi - 1;
+			if (phi <= 0.999f + 0.00001f)
+				AddReachableBins(logf(1 / (1 - minf(phi, 0.999f))) * phiMapBins / logf(1 / 0.001f), binsPhi, phiBins, phiCount);
+
+			for (int g = 0; g < gCount; g++)
+				for (int p = 0; p < phiCount; p++)
+					AddReachablePage(gBins[g] * binsPhi + phiBins[p], pages);
+		}
+}
+
+/// Pages of the STFX tables (gBin, SampleCosXAndW in STFXPathtracing_RT.hlsl) reachable from the volume materials,
+/// for every channel with extinction of every material.
+inline void ReachableSTFXPages(const VolumeMaterial* materials, int count, int binsG, list<int>& pages) {
+	for (int m = 0; m < count; m++)
+		for (int c = 0; c < 3; c++)
+		{
+			VolumeMaterial material = materials[m];
+			if (material.Extinction[c] <= 0)
+				continue;
+			int gBins[3];
+			int gCount = ReachableGBins(material.G[c], binsG, gBins);
+			for (int g = 0; g < gCount; g++)
+				AddReachablePage(gBins[g], pages);
+		}
+}
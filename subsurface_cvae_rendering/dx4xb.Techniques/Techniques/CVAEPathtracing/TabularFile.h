@@ -0,0 +1,804 @@
+#pragma once
+
+#include "dx4xb_math.h"
+#include "../CPU/MappedFile.h"
+#include "../CPU/AliasTable.h"
+#include "../CPU/RansCoder.h"
+#include "../CPU/Stopwatch.h"
+
+using namespace dx4xb;
+
+// Version of the tabular file layout.
+#define TABULAR_FILE_VERSION 2
+
+#define TABULAR_MAX_AXES 6
+#define TABULAR_MAX_TABLES 4
+
+// Values stored as floats.
+#define TABULAR_ENCODING_FLOAT32 0
+// Every row stored as a float scale (the maximum of the row) and the values divided by the scale as unorm16.
+#define TABULAR_ENCODING_UNORM16 1
+// Same values than TABULAR_ENCODING_UNORM16 stored as deltas between consecutive entries of a row,
+// coded with RansEncode by blocks of TABULAR_BLOCK_ROWS rows. Decoded to unorm16 when the file is opened.
+#define TABULAR_ENCODING_UNORM16_DELTA_RANS 2
+// Cdf rows stored as alias tables (see AliasTableBuilder), a 32-bit entry per bin. Rows can only be sampled.
+#define TABULAR_ENCODING_ALIAS16 3
+
+// The rows of the table are cdfs to be sampled.
+#define TABULAR_TABLE_CDF 1
+
+#define TABULAR_METHOD_STF 0
+#define TABULAR_METHOD_STFX 1
+
+#define TABULAR_BLOCK_ROWS 256
+
+// Description of a table stored in a tabular file.
+struct TabularTableHeader {
+	char Name[16];
+	unsigned int Encoding;
+	// Number of axes and bins of every axis, from the outermost to the innermost.
+	unsigned int Axes;
+	unsigned int Bins[TABULAR_MAX_AXES];
+	// Number of innermost axes forming a row (a CDF for the sampling tables), the other axes select the row.
+	unsigned int RowAxes;
+	unsigned int Flags;
+	// Position from the start of the file and size of the stored table.
+	unsigned long long Offset;
+	unsigned long long StoredSize;
+};
+static_assert(sizeof(TabularTableHeader) == 72, "Tabular table header must be tightly packed");
+
+// Header of a file with the tables of a tabular method (STF or STFX).
+// All fields are fixed size and little-endian. Stored tables are:
+// TABULAR_ENCODING_FLOAT32, rows x row length floats.
+// TABULAR_ENCODING_UNORM16, rows float scales followed by rows x row length unorm16 values.
+// TABULAR_ENCODING_UNORM16_DELTA_RANS, offsets (from the first block) of the blocks and of the end,
+// and every block as three coded streams (its scales, the low bytes and the high bytes of its deltas),
+// each one preceded by its size as 4 bytes.
+// TABULAR_ENCODING_ALIAS16, rows x row length alias entries.
+struct TabularFileHeader {
+	char Magic[4]; // TABF
+	unsigned int FileVersion;
+	unsigned int Method;
+	unsigned int TableCount;
+	TabularTableHeader Tables[TABULAR_MAX_TABLES];
+};
+static_assert(sizeof(TabularFileHeader) == 304, "Tabular file header must be tightly packed");
+
+/// Index of the first entry of a cdf greater than value (length - 1 if none),
+/// the same search than SearchBin in STFXPathtracing_RT.hlsl and the theta search in STFPathtracing_RT.hlsl.
+inline int SearchCDF(const float* cdf, int length, float value) {
+	int begin = 0, end = length - 1;
+	while (begin < end)
+	{
+		int med = (begin + end) / 2;
+		if (value < cdf[med])
+			end = med;
+		else
+			begin = med + 1;
+	}
+	return begin;
+}
+
+/// Table of a tabular file. Values are decoded on the fly from the stored encoding.
+class TabularTable {
+	friend class TabularFile;
+
+	TabularTableHeader header = {};
+	unsigned long long rows = 0;
+	int rowLength = 0;
+	const float* values = nullptr;
+	const float* scales = nullptr;
+	const unsigned short* quantized = nullptr;
+	const unsigned int* aliases = nullptr;
+
+	void Set(const TabularTableHeader& header, const byte* data) {
+		this->header = header;
+		rowLength = 1;
+		rows = 1;
+		for (unsigned int a = 0; a < header.Axes; a++)
+			if (a + header.RowAxes < header.Axes)
+				rows *= header.Bins[a];
+			else
+				rowLength *= header.Bins[a];
+		values = nullptr;
+		scales = nullptr;
+		quantized = nullptr;
+		aliases = nullptr;
+		switch (header.Encoding) {
+		case TABULAR_ENCODING_FLOAT32:
+			values = (const float*)data;
+			break;
+		case TABULAR_ENCODING_ALIAS16:
+			aliases = (const unsigned int*)data;
+			break;
+		default:
+			scales = (const float*)data;
+			quantized = (const unsigned short*)(data + rows * sizeof(float));
+		}
+	}
+
+public:
+	inline const char* Name() const { return header.Name; }
+
+	inline unsigned int Encoding() const { return header.Encoding; }
+
+	inline unsigned int Axes() const { return header.Axes; }
+
+	inline unsigned int Bins(int axis) const { return header.Bins[axis]; }
+
+	inline unsigned int RowAxes() const { return header.RowAxes; }
+
+	inline unsigned long long Rows() const { return rows; }
+
+	inline int RowLength() const { return rowLength; }
+
+	inline bool IsQuantized() const { return quantized != nullptr; }
+
+	inline bool IsAlias() const { return aliases != nullptr; }
+
+	// Values of a float table (null for the other encodings).
+	inline const float* Values() const { return values; }
+
+	// Entries of a row of an alias table.
+	inline const unsigned int* AliasRow(unsigned long long row) const { return aliases + row * rowLength; }
+
+	inline bool IsCDF() const { return (header.Flags & TABULAR_TABLE_CDF) != 0; }
+
+	// Size of the table in the file.
+	inline unsigned long long StoredSize() const { return header.StoredSize; }
+
+	// Values, decoded rows and searches are not available for alias tables.
+	inline float Value(unsigned long long row, int index) const {
+		if (values)
+			return values[row * rowLength + index];
+		return quantized[row * rowLength + index] * (scales[row] * (1.0f / 65535));
+	}
+
+	void DecodeRow(unsigned long long row, float* output) const {
+		if (values)
+		{
+			memcpy(output, values + row * rowLength, sizeof(float) * rowLength);
+			return;
+		}
+		float scale = scales[row] * (1.0f / 65535);
+		const unsigned short* q = quantized + row * rowLength;
+		for (int i = 0; i < rowLength; i++)
+			output[i] = q[i] * scale;
+	}
+
+	// Index in the row of the first entry greater than value (RowLength() - 1 if none), as SearchCDF over the decoded row.
+	int Search(unsigned long long row, float value) const {
+		if (values)
+			return SearchCDF(values + row * rowLength, rowLength, value);
+		float scale = scales[row] * (1.0f / 65535);
+		const unsigned short* q = quantized + row * rowLength;
+		int begin = 0, end = rowLength - 1;
+		while (begin < end)
+		{
+			int med = (begin + end) / 2;
+			if (value < q[med] * scale)
+				end = med;
+			else
+				begin = med + 1;
+		}
+		return begin;
+	}
+
+	// Samples a bin of a row of a cdf or an alias table with 32 random bits.
+	// Cdf rows are searched for a value uniform between 0 and the last entry of the row.
+	inline int Sample(unsigned long long row, unsigned int random) const {
+		if (aliases)
+			return SampleAlias(aliases + row * rowLength, rowLength, random);
+		return Search(row, (random >> 8) * (1.0f / 16777216) * Value(row, rowLength - 1));
+	}
+};
+
+/// File of tables of a tabular method mapped in memory.
+/// Float and unorm16 tables are used in place, compressed tables are decoded when the file is opened.
+class TabularFile {
+	MappedFile file;
+	TabularFileHeader header = {};
+	TabularTable tables[TABULAR_MAX_TABLES];
+	byte* decoded[TABULAR_MAX_TABLES] = {};
+
+	// Decodes the next stream of a block (its size as 4 bytes followed by the stream) to size bytes.
+	static bool DecodeStream(const byte*& stream, const byte* end, byte* output, size_t size) {
+		unsigned int streamSize;
+		if (end - stream < 4)
+			return false;
+		memcpy(&streamSize, stream, 4);
+		stream += 4;
+		if ((size_t)(end - stream) < streamSize || !RansDecode(stream, streamSize, output, size))
+			return false;
+		stream += streamSize;
+		return true;
+	}
+
+	static bool Decode(const TabularTableHeader& table, const byte* stored, unsigned long long rows, int rowLength, byte* output) {
+		unsigned long long blocks = (rows + TABULAR_BLOCK_ROWS - 1) / TABULAR_BLOCK_ROWS;
+		const unsigned long long* offsets = (const unsigned long long*)stored;
+		const byte* data = stored + (blocks + 1) * sizeof(unsigned long long);
+		if ((blocks + 1) * sizeof(unsigned long long) > table.StoredSize ||
+			(blocks + 1) * sizeof(unsigned long long) + offsets[blocks] > table.StoredSize)
+			return false;
+
+		float* scales = (float*)output;
+		unsigned short* quantized = (unsigned short*)(output + rows * sizeof(float));
+		byte* planes = new byte[2 * TABULAR_BLOCK_ROWS * (size_t)rowLength];
+
+		bool success = true;
+		for (unsigned long long b = 0; success && b < blocks; b++)
+		{
+			unsigned long long firstRow = b * TABULAR_BLOCK_ROWS;
+			int blockRows = (int)min(rows - firstRow, (unsigned long long)TABULAR_BLOCK_ROWS);
+			size_t count = blockRows * (size_t)rowLength;
+			const byte* stream = data + offsets[b];
+			success = offsets[b + 1] >= offsets[b] && offsets[b + 1] <= offsets[blocks] &&
+				DecodeStream(stream, data + offsets[b + 1], (byte*)(scales + firstRow), blockRows * sizeof(float)) &&
+				DecodeStream(stream, data + offsets[b + 1], planes, count) &&
+				DecodeStream(stream, data + offsets[b + 1], planes + count, count) &&
+				stream == data + offsets[b + 1];
+			if (!success)
+				break;
+
+			for (int r = 0; r < blockRows; r++)
+			{
+				unsigned short* q = quantized + (firstRow + r) * rowLength;
+				const byte* low = planes + r * (size_t)rowLength;
+				const byte* high = low + count;
+				unsigned short value = 0;
+				for (int i = 0; i < rowLength; i++)
+					q[i] = value += (unsigned short)(low[i] | (high[i] << 8));
+			}
+		}
+		delete[] planes;
+		return success;
+	}
+
+public:
+	TabularFile() {}
+	TabularFile(const TabularFile&) = delete;
+	TabularFile& operator = (const TabularFile&) = delete;
+
+	~TabularFile() {
+		Close();
+	}
+
+	// Opens a tabular file. Returns false if the file doesn't exist or it is not valid.
+	bool Open(const char* fileName) {
+		Close();
+		if (!file.Open(fileName) || file.Size() < sizeof(TabularFileHeader))
+			return false;
+
+		header = *file.As<TabularFileHeader>();
+		if (memcmp(header.Magic, "TABF", 4) != 0 ||
+			header.FileVersion != TABULAR_FILE_VERSION ||
+			header.TableCount > TABULAR_MAX_TABLES)
+		{
+			Close();
+			return false;
+		}
+
+		for (unsigned int t = 0; t < header.TableCount; t++)
+		{
+			const TabularTableHeader& table = header.Tables[t];
+			if (table.Axes == 0 || table.Axes > TABULAR_MAX_AXES || table.RowAxes == 0 || table.RowAxes > table.Axes ||
+				table.Offset + table.StoredSize > file.Size())
+			{
+				Close();
+				return false;
+			}
+			tables[t].Set(table, file.Data() + table.Offset);
+
+			unsigned long long rows = tables[t].Rows();
+			unsigned long long decodedSize = rows * sizeof(float) + rows * tables[t].RowLength() * sizeof(unsigned short);
+			bool valid;
+			switch (table.Encoding) {
+			case TABULAR_ENCODING_FLOAT32:
+				valid = table.StoredSize == rows * tables[t].RowLength() * sizeof(float);
+				break;
+			case TABULAR_ENCODING_UNORM16:
+				valid = table.StoredSize == decodedSize;
+				break;
+			case TABULAR_ENCODING_ALIAS16:
+				valid = table.StoredSize == rows * tables[t].RowLength() * sizeof(unsigned int) && tables[t].RowLength() <= ALIAS_MAX_BINS;
+				break;
+			case TABULAR_ENCODING_UNORM16_DELTA_RANS:
+				decoded[t] = new byte[decodedSize];
+				valid = Decode(table, file.Data() + table.Offset, rows, tables[t].RowLength(), decoded[t]);
+				tables[t].Set(table, decoded[t]);
+				break;
+			default:
+				valid = false;
+			}
+			if (!valid)
+			{
+				Close();
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void Close() {
+		for (int t = 0; t < TABULAR_MAX_TABLES; t++)
+		{
+			if (decoded[t])
+				delete[] decoded[t];
+			decoded[t] = nullptr;
+			tables[t] = TabularTable();
+		}
+		header = {};
+		file.Close();
+	}
+
+	inline bool IsOpen() const { return file.IsOpen(); }
+
+	inline unsigned int Method() const { return header.Method; }
+
+	inline int TableCount() const { return header.TableCount; }
+
+	inline const TabularTable& Table(int index) const { return tables[index]; }
+
+	// Gets the table with a name or null if the file has not that table.
+	const TabularTable* Find(const char* name) const {
+		for (unsigned int t = 0; t < header.TableCount; t++)
+			if (strncmp(tables[t].Name(), name, 16) == 0)
+				return &tables[t];
+		return nullptr;
+	}
+};
+
+/// Table to be written in a tabular file. Data has the rows (all axes but the RowAxes innermost) of every row length floats,
+/// or null to decode the rows from Table (a cdf table with the same rows).
+struct TabularTableSource {
+	const char* Name;
+	unsigned int Encoding;
+	unsigned int Axes;
+	unsigned int Bins[TABULAR_MAX_AXES];
+	unsigned int RowAxes;
+	unsigned int Flags;
+	const float* Data;
+	const TabularTable* Table;
+};
+
+// Quantizes a row as unorm16 of the values divided by the maximum of the row, gets the maximum.
+inline float QuantizeTabularRow(const float* row, int length, unsigned short* quantized) {
+	float scale = 0;
+	for (int i = 0; i < length; i++)
+		scale = maxf(scale, row[i]);
+	for (int i = 0; i < length; i++)
+		quantized[i] = scale > 0 ? (unsigned short)(clamp(row[i] / scale, 0.0f, 1.0f) * 65535 + 0.5f) : 0;
+	return scale;
+}
+
+/// Writes a tabular file with the tables of a method (TABULAR_METHOD_STF or TABULAR_METHOD_STFX).
+/// The file is written aside and renamed at the end. Returns false if any table is not valid or the file can not be written.
+inline bool WriteTabularFile(const char* fileName, unsigned int method, const TabularTableSource* tables, int count) {
+	if (count > TABULAR_MAX_TABLES)
+		return false;
+
+	char tempFileName[MAX_PATH];
+	sprintf_s(tempFileName, "%s.tmp", fileName);
+	FILE* file;
+	if (fopen_s(&file, tempFileName, "wb"))
+		return false;
+
+	TabularFileHeader header = {};
+	memcpy(header.Magic, "TABF", 4);
+	header.FileVersion = TABULAR_FILE_VERSION;
+	header.Method = method;
+	header.TableCount = count;
+
+	bool written = fwrite(&header, sizeof(TabularFileHeader), 1, file) == 1;
+	unsigned long long position = sizeof(TabularFileHeader);
+
+	for (int t = 0; written && t < count; t++)
+	{
+		const TabularTableSource& source = tables[t];
+		TabularTableHeader& table = header.Tables[t];
+		strncpy_s(table.Name, source.Name, _TRUNCATE);
+		table.Encoding = source.Encoding;
+		table.Axes = source.Axes;
+		table.RowAxes = source.RowAxes;
+		table.Flags = source.Flags;
+		unsigned long long rows = 1;
+		int rowLength = 1;
+		for (unsigned int a = 0; a < source.Axes; a++)
+		{
+			table.Bins[a] = source.Bins[a];
+			if (a + source.RowAxes < source.Axes)
+				rows *= source.Bins[a];
+			else
+				rowLength *= source.Bins[a];
+		}
+		if (source.Axes == 0 || source.Axes > TABULAR_MAX_AXES || source.RowAxes == 0 || source.RowAxes > source.Axes ||
+			(!source.Data && (!source.Table || source.Table->IsAlias() || source.Table->Rows() != rows || source.Table->RowLength() != rowLength)) ||
+			(source.Encoding == TABULAR_ENCODING_ALIAS16 && rowLength > ALIAS_MAX_BINS))
+		{
+			written = false;
+			break;
+		}
+
+		// tables start 64-byte aligned
+		static const byte padding[64] = {};
+		unsigned long long aligned = (position + 63) / 64 * 64;
+		written &= fwrite(padding, 1, (size_t)(aligned - position), file) == aligned - position;
+		position = aligned;
+		table.Offset = position;
+
+		float* rowBuffer = new float[rowLength];
+		auto sourceRow = [&](unsigned long long r) {
+			if (source.Data)
+				return source.Data + r * rowLength;
+			source.Table->DecodeRow(r, rowBuffer);
+			return (const float*)rowBuffer;
+		};
+
+		unsigned short* quantized = new unsigned short[TABULAR_BLOCK_ROWS * (size_t)rowLength];
+		float scales[TABULAR_BLOCK_ROWS];
+		switch (source.Encoding) {
+		case TABULAR_ENCODING_FLOAT32:
+			table.StoredSize = rows * rowLength * sizeof(float);
+			for (unsigned long long r = 0; written && r < rows; r++)
+				written &= fwrite(sourceRow(r), sizeof(float), rowLength, file) == (size_t)rowLength;
+			break;
+		case TABULAR_ENCODING_UNORM16:
+			table.StoredSize = rows * sizeof(float) + rows * rowLength * sizeof(unsigned short);
+			for (unsigned long long r = 0; written && r < rows; r++)
+			{
+				const float* row = sourceRow(r);
+				float scale = 0;
+				for (int i = 0; i < rowLength; i++)
+					scale = maxf(scale, row[i]);
+				written &= fwrite(&scale, sizeof(float), 1, file) == 1;
+			}
+			for (unsigned long long r = 0; written && r < rows; r += TABULAR_BLOCK_ROWS)
+			{
+				int blockRows = (int)min(rows - r, (unsigned long long)TABULAR_BLOCK_ROWS);
+				for (int b = 0; b < blockRows; b++)
+					QuantizeTabularRow(sourceRow(r + b), rowLength, quantized + b * rowLength);
+				written &= fwrite(quantized, sizeof(unsigned short), blockRows * (size_t)rowLength, file) == blockRows * (size_t)rowLength;
+			}
+			break;
+		case TABULAR_ENCODING_UNORM16_DELTA_RANS:
+		{
+			unsigned long long blocks = (rows + TABULAR_BLOCK_ROWS - 1) / TABULAR_BLOCK_ROWS;
+			unsigned long long* offsets = new unsigned long long[blocks + 1];
+			offsets[0] = 0;
+			// offsets are written again at the end
+			written &= fwrite(offsets, sizeof(unsigned long long), 1, file) == 1;
+			for (unsigned long long b = 1; b <= blocks; b++)
+				written &= fwrite(offsets, sizeof(unsigned long long), 1, file) == 1;
+
+			// low and high bytes of the deltas are coded apart, the high bytes are mostly zero
+			byte* planes = new byte[2 * TABULAR_BLOCK_ROWS * (size_t)rowLength];
+			byte* coded = new byte[4 + RansBound(TABULAR_BLOCK_ROWS * (size_t)rowLength)];
+			for (unsigned long long b = 0; written && b < blocks; b++)
+			{
+				unsigned long long firstRow = b * TABULAR_BLOCK_ROWS;
+				int blockRows = (int)min(rows - firstRow, (unsigned long long)TABULAR_BLOCK_ROWS);
+				size_t count = blockRows * (size_t)rowLength;
+				for (int r = 0; r < blockRows; r++)
+				{
+					scales[r] = QuantizeTabularRow(sourceRow(firstRow + r), rowLength, quantized);
+					unsigned short previous = 0;
+					for (int i = 0; i < rowLength; i++)
+					{
+						unsigned short delta = (unsigned short)(quantized[i] - previous);
+						planes[r * (size_t)rowLength + i] = (byte)(delta & 0xFF);
+						planes[count + r * (size_t)rowLength + i] = (byte)(delta >> 8);
+						previous = quantized[i];
+					}
+				}
+				const byte* streams[] = { (const byte*)scales, planes, planes + count };
+				size_t sizes[] = { blockRows * sizeof(float), count, count };
+				unsigned long long blockSize = 0;
+				for (int s = 0; written && s < 3; s++)
+				{
+					unsigned int streamSize = (unsigned int)RansEncode(streams[s], sizes[s], coded + 4);
+					memcpy(coded, &streamSize, 4);
+					written &= fwrite(coded, 1, 4 + (size_t)streamSize, file) == 4 + (size_t)streamSize;
+					blockSize += 4 + streamSize;
+				}
+				offsets[b + 1] = offsets[b] + blockSize;
+			}
+			table.StoredSize = (blocks + 1) * sizeof(unsigned long long) + offsets[blocks];
+			written &= _fseeki64(file, (long long)table.Offset, SEEK_SET) == 0 &&
+				fwrite(offsets, sizeof(unsigned long long), (size_t)(blocks + 1), file) == blocks + 1 &&
+				_fseeki64(file, (long long)(table.Offset + table.StoredSize), SEEK_SET) == 0;
+			delete[] offsets;
+			delete[] planes;
+			delete[] coded;
+			break;
+		}
+		case TABULAR_ENCODING_ALIAS16:
+		{
+			table.StoredSize = rows * rowLength * sizeof(unsigned int);
+			AliasTableBuilder builder;
+			unsigned int* entries = new unsigned int[rowLength];
+			for (unsigned long long r = 0; written && r < rows; r++)
+			{
+				builder.Build(sourceRow(r), rowLength, entries);
+				written &= fwrite(entries, sizeof(unsigned int), rowLength, file) == (size_t)rowLength;
+			}
+			delete[] entries;
+			break;
+		}
+		default:
+			written = false;
+		}
+		delete[] quantized;
+		delete[] rowBuffer;
+		position += table.StoredSize;
+	}
+
+	written = written && _fseeki64(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(TabularFileHeader), 1, file) == 1;
+	fclose(file);
+
+	if (!written || !MoveFileExA(tempFileName, fileName, MOVEFILE_REPLACE_EXISTING))
+	{
+		DeleteFileA(tempFileName);
+		return false;
+	}
+	return true;
+}
+
+/// Converts the tables read by STFTechnique (stf2.bin: one and multiple scattering albedos [g][phi][r] and the
+/// cdf of theta [g][phi][r][theta] at 200 x 1000 x 9 x 45 bins, or the bins of a table build) to a tabular file.
+/// Albedos are kept as floats.
+inline bool ConvertSTFTables(const char* legacyFileName, const char* fileName, unsigned int encoding,
+	const unsigned int* legacyBins = nullptr) {
+	const unsigned int defaultBins[] = { 200, 1000, 9, 45 };
+	const unsigned int* bins = legacyBins ? legacyBins : defaultBins;
+	unsigned long long albedos = (unsigned long long)bins[0] * bins[1] * bins[2];
+	MappedFile legacy;
+	if (!legacy.Open(legacyFileName) || legacy.Size() < (albedos * 2 + albedos * bins[3]) * sizeof(float))
+		return false;
+	const float* data = legacy.As<float>();
+	TabularTableSource tables[] = {
+		{ "OneTimeSA", TABULAR_ENCODING_FLOAT32, 3, { bins[0], bins[1], bins[2] }, 1, 0, data, nullptr },
+		{ "MultiTimeSA", TABULAR_ENCODING_FLOAT32, 3, { bins[0], bins[1], bins[2] }, 1, 0, data + albedos, nullptr },
+		{ "STF", encoding, 4, { bins[0], bins[1], bins[2], bins[3] }, 1, TABULAR_TABLE_CDF, data + 2 * albedos, nullptr }
+	};
+	return WriteTabularFile(fileName, TABULAR_METHOD_STF, tables, 3);
+}
+
+/// Converts the tables read by STFXTechnique (stfx.bin: cdf of logN [g][r][logN] and cdf of the exit [g][r][logN][theta][beta][alpha]
+/// at 100 x 8 x 100 x 40 x 20 x 10 bins, or the bins of a table build) to a tabular file.
+/// The exit cdf is a single table (CDF_XW_L followed by CDF_XW_H).
+inline bool ConvertSTFXTables(const char* legacyFileName, const char* fileName, unsigned int encoding,
+	const unsigned int* legacyBins = nullptr) {
+	const unsigned int defaultBins[] = { 100, 8, 100, 40, 20, 10 };
+	const unsigned int* bins = legacyBins ? legacyBins : defaultBins;
+	unsigned long long logN = (unsigned long long)bins[0] * bins[1] * bins[2];
+	MappedFile legacy;
+	if (!legacy.Open(legacyFileName) || legacy.Size() < (logN + logN * bins[3] * bins[4] * bins[5]) * sizeof(float))
+		return false;
+	const float* data = legacy.As<float>();
+	TabularTableSource tables[] = {
+		{ "CDF_LogN", encoding, 3, { bins[0], bins[1], bins[2] }, 1, TABULAR_TABLE_CDF, data, nullptr },
+		{ "CDF_XW", encoding, 6, { bins[0], bins[1], bins[2], bins[3], bins[4], bins[5] }, 3, TABULAR_TABLE_CDF, data + logN, nullptr }
+	};
+	return WriteTabularFile(fileName, TABULAR_METHOD_STFX, tables, 2);
+}
+
+/// Writes the tables of a tabular file with the cdf tables converted to alias tables, the other tables keep their encoding.
+inline bool ConvertToAliasTables(const TabularFile& source, const char* fileName) {
+	TabularTableSource tables[TABULAR_MAX_TABLES] = {};
+	for (int t = 0; t < source.TableCount(); t++)
+	{
+		const TabularTable& table = source.Table(t);
+		if (table.IsAlias())
+			return false;
+		tables[t].Name = table.Name();
+		tables[t].Encoding = table.IsCDF() ? TABULAR_ENCODING_ALIAS16 : table.Encoding();
+		tables[t].Axes = table.Axes();
+		for (unsigned int a = 0; a < table.Axes(); a++)
+			tables[t].Bins[a] = table.Bins(a);
+		tables[t].RowAxes = table.RowAxes();
+		tables[t].Flags = table.IsCDF() ? TABULAR_TABLE_CDF : 0;
+		tables[t].Table = &table;
+	}
+	return WriteTabularFile(fileName, source.Method(), tables, source.TableCount());
+}
+
+/// Size of an encoded table and error of sampling it instead of the float table.
+struct TabularEncodingReport {
+	unsigned long long RawBytes;
+	unsigned long long StoredBytes;
+	float CompressionRatio;
+	// Maximum |cdf - reference| relative to the maximum of the row
+	float MaxCDFError;
+	// Total variation distance between the probabilities of the bins of a row and of the reference row (mean and maximum over rows)
+	float MeanDistance;
+	float MaxDistance;
+	// Fraction of random searches selecting a different bin than in the reference
+	float SearchMismatch;
+	// Single thread throughput of the searches (decoding on the fly) and of the searches in the float table
+	float SearchesPerSecond;
+	float ReferenceSearchesPerSecond;
+};
+
+/// Compares a table of a tabular file with the float table it was encoded from.
+inline TabularEncodingReport CompareTabularTable(const TabularTable& table, const float* reference,
+	int searches = 1 << 20, unsigned int seed = 0) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto next = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	};
+
+	TabularEncodingReport report = {};
+	unsigned long long rows = table.Rows();
+	int rowLength = table.RowLength();
+	report.RawBytes = rows * rowLength * sizeof(float);
+	report.StoredBytes = table.StoredSize();
+	report.CompressionRatio = report.RawBytes / (float)report.StoredBytes;
+
+	float* decoded = new float[rowLength];
+	double distanceSum = 0;
+	for (unsigned long long r = 0; r < rows; r++)
+	{
+		table.DecodeRow(r, decoded);
+		const float* expected = reference + r * rowLength;
+		float scale = 0;
+		for (int i = 0; i < rowLength; i++)
+			scale = maxf(scale, expected[i]);
+		if (scale <= 0)
+			continue;
+		float distance = 0;
+		for (int i = 0; i < rowLength; i++)
+		{
+			report.MaxCDFError = maxf(report.MaxCDFError, fabsf(decoded[i] - expected[i]) / scale);
+			float p = decoded[i] - (i > 0 ? decoded[i - 1] : 0);
+			float q = expected[i] - (i > 0 ? expected[i - 1] : 0);
+			distance += fabsf(p - q);
+		}
+		distance *= 0.5f / scale;
+		distanceSum += distance;
+		report.MaxDistance = maxf(report.MaxDistance, distance);
+	}
+	report.MeanDistance = (float)(distanceSum / rows);
+	delete[] decoded;
+
+	unsigned long long* searchRows = new unsigned long long[searches];
+	float* values = new float[searches];
+	int* bins = new int[searches];
+	for (int s = 0; s < searches; s++)
+	{
+		unsigned long long row = (((unsigned long long)next() << 32) | next()) % rows;
+		searchRows[s] = row;
+		values[s] = (next() >> 8) * (1.0f / 16777216.0f) * reference[row * rowLength + rowLength - 1];
+	}
+
+	Stopwatch stopwatch;
+	for (int s = 0; s < searches; s++)
+		bins[s] = SearchCDF(reference + searchRows[s] * rowLength, rowLength, values[s]);
+	report.ReferenceSearchesPerSecond = searches * 1000.0f / stopwatch.Milliseconds();
+
+	int mismatches = 0;
+	stopwatch.Start();
+	for (int s = 0; s < searches; s++)
+		mismatches += table.Search(searchRows[s], values[s]) != bins[s];
+	report.SearchesPerSecond = searches * 1000.0f / stopwatch.Milliseconds();
+	report.SearchMismatch = mismatches / (float)searches;
+
+	delete[] searchRows;
+	delete[] values;
+	delete[] bins;
+	return report;
+}
+
+/// Equivalence and cost of sampling an alias table instead of searching the cdf table it was built from.
+struct AliasSamplingReport {
+	// Total variation distance between the probabilities of the bins selected by the alias table and by the cdf
+	// (mean and maximum over rows)
+	float MeanDistance;
+	float MaxDistance;
+	// Mean distance between the histograms of the bins sampled with both tables in some rows,
+	// and between two histograms sampled with the cdf (the noise of the histograms)
+	float SampledDistance;
+	float NoiseDistance;
+	// Single thread throughput of samples in random rows
+	float SamplesPerSecond;
+	float ReferenceSamplesPerSecond;
+};
+
+/// Compares an alias table with the cdf table it was built from using samples samples.
+inline AliasSamplingReport CompareAliasTable(const TabularTable& cdf, const TabularTable& alias, int samples = 1 << 22, unsigned int seed = 0) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto next = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	};
+
+	AliasSamplingReport report = {};
+	unsigned long long rows = cdf.Rows();
+	int rowLength = cdf.RowLength();
+	if (!alias.IsAlias() || alias.Rows() != rows || alias.RowLength() != rowLength)
+		return report;
+
+	float* decoded = new float[rowLength];
+	double* probabilities = new double[rowLength];
+	double distanceSum = 0;
+	for (unsigned long long r = 0; r < rows; r++)
+	{
+		cdf.DecodeRow(r, decoded);
+		double total = decoded[rowLength - 1];
+		if (total <= 0)
+			continue;
+		AliasProbabilities(alias.AliasRow(r), rowLength, probabilities);
+		double distance = 0;
+		for (int i = 0; i < rowLength; i++)
+			distance += fabs((decoded[i] - (i > 0 ? decoded[i - 1] : 0)) / total - probabilities[i]);
+		distance *= 0.5;
+		distanceSum += distance;
+		report.MaxDistance = maxf(report.MaxDistance, (float)distance);
+	}
+	report.MeanDistance = (float)(distanceSum / rows);
+	delete[] decoded;
+	delete[] probabilities;
+
+	// histograms of some rows with mass
+	const int histogramRows = 16;
+	int perRow = max(1, samples / histogramRows);
+	int* aliasBins = new int[rowLength];
+	int* cdfBins = new int[rowLength];
+	int* noiseBins = new int[rowLength];
+	int sampledRows = 0;
+	for (int attempt = 0; attempt < histogramRows * 16 && sampledRows < histogramRows; attempt++)
+	{
+		unsigned long long row = (((unsigned long long)next() << 32) | next()) % rows;
+		if (cdf.Value(row, rowLength - 1) <= 0)
+			continue;
+		sampledRows++;
+		for (int i = 0; i < rowLength; i++)
+			aliasBins[i] = cdfBins[i] = noiseBins[i] = 0;
+		for (int s = 0; s < perRow; s++)
+		{
+			aliasBins[alias.Sample(row, next())]++;
+			cdfBins[cdf.Sample(row, next())]++;
+			noiseBins[cdf.Sample(row, next())]++;
+		}
+		int sampledDistance = 0, noiseDistance = 0;
+		for (int i = 0; i < rowLength; i++)
+		{
+			sampledDistance += abs(aliasBins[i] - cdfBins[i]);
+			noiseDistance += abs(noiseBins[i] - cdfBins[i]);
+		}
+		report.SampledDistance += 0.5f * sampledDistance / perRow;
+		report.NoiseDistance += 0.5f * noiseDistance / perRow;
+	}
+	report.SampledDistance /= max(1, sampledRows);
+	report.NoiseDistance /= max(1, sampledRows);
+	delete[] aliasBins;
+	delete[] cdfBins;
+	delete[] noiseBins;
+
+	unsigned long long* sampleRows = new unsigned long long[samples];
+	unsigned int* randoms = new unsigned int[samples];
+	for (int s = 0; s < samples; s++)
+	{
+		sampleRows[s] = (((unsigned long long)next() << 32) | next()) % rows;
+		randoms[s] = next();
+	}
+	int* bins = new int[samples];
+	Stopwatch stopwatch;
+	for (int s = 0; s < samples; s++)
+		bins[s] = cdf.Sample(sampleRows[s], randoms[s]);
+	report.ReferenceSamplesPerSecond = samples * 1000.0f / stopwatch.Milliseconds();
+	stopwatch.Start();
+	for (int s = 0; s < samples; s++)
+		bins[s] = alias.Sample(sampleRows[s], randoms[s]);
+	report.SamplesPerSecond = samples * 1000.0f / stopwatch.Milliseconds();
+	delete[] sampleRows;
+	delete[] randoms;
+	delete[] bins;
+	return report;
+}
@@ -0,0 +1,647 @@
+#pragma once
+
+#include "TabularFile.h"
+#include "SphereSamplerCheck.h"
+
+// Uniform random numbers of a sample of the tabular samplers.
+// STF: r bin, case, free flight or disc angle, phase or disc radius, theta in the bin.
+// STFX: r bin, logN search, logN in the bin, absorption, exit search, theta, beta and alpha in the bins.
+#define TABULAR_SAMPLE_RANDOMS 8
+
+class TabularSampleBatch;
+
+/// CPU version of SampleCosXAndW of the STF (STFPathtracing_RT.hlsl) and STFX (STFXPathtracing_RT.hlsl) tables of a tabular file.
+/// Sample samples a single (g, phi, r) with the random numbers given in the order of TABULAR_SAMPLE_RANDOMS (a line by line
+/// transcription of the shaders), SampleBatch samples a TabularSampleBatch with the bins, albedos and exits computed
+/// BATCH_WIDTH samples at once and the cdfs of float tables searched in lockstep with gathers. Rows of unorm16 and alias
+/// tables are searched (or sampled) lane by lane.
+/// Unlike the shaders, r bins above the tables are clamped to the last bin.
+class TabularSampler {
+	unsigned int method = 0;
+	const TabularTable* once = nullptr;
+	const TabularTable* multiple = nullptr;
+	const TabularTable* stf = nullptr;
+	const TabularTable* logN = nullptr;
+	const TabularTable* xw = nullptr;
+	int binsG = 0, binsPhi = 0, binsR = 0, binsLogN = 0;
+	int binsTheta = 0, binsBeta = 0, binsAlpha = 0;
+
+public:
+	// Binds the tables of an open tabular file, returns false if the file has not the tables of its method.
+	// The file must stay open while sampling.
+	bool Bind(const TabularFile& file) {
+		method = file.Method();
+		once = multiple = stf = logN = xw = nullptr;
+		if (method == TABULAR_METHOD_STF)
+		{
+			once = file.Find("OneTimeSA");
+			multiple = file.Find("MultiTimeSA");
+			stf = file.Find("STF");
+			if (!once || !multiple || !stf || once->IsAlias() || multiple->IsAlias() || stf->Axes() != 4 ||
+				once->Rows() * once->RowLength() != stf->Rows() || multiple->Rows() * multiple->RowLength() != stf->Rows())
+				return false;
+			binsG = stf->Bins(0);
+			binsPhi = stf->Bins(1);
+			binsR = stf->Bins(2);
+			binsTheta = stf->Bins(3);
+			return binsPhi >= 3;
+		}
+		if (method == TABULAR_METHOD_STFX)
+		{
+			logN = file.Find("CDF_LogN");
+			xw = file.Find("CDF_XW");
+			if (!logN || !xw || logN->Axes() != 3 || xw->Axes() != 6 || xw->Rows() != logN->Rows() * logN->RowLength())
+				return false;
+			binsG = logN->Bins(0);
+			binsR = logN->Bins(1);
+			binsLogN = logN->Bins(2);
+			binsTheta = xw->Bins(3);
+			binsBeta = xw->Bins(4);
+			binsAlpha = xw->Bins(5);
+			return true;
+		}
+		return false;
+	}
+
+	inline unsigned int Method() const { return method; }
+
+	// The STF walks start with a free flight from the center, the STFX walks with a scattering at the center.
+	inline bool ScattersAtCenter() const { return method == TABULAR_METHOD_STFX; }
+
+	// Samples the exit of a path as SampleCosXAndW. Returns false if the path is absorbed.
+	// n is the number of scattering events, the STF tables only tell 0, 1 or more (2).
+	bool Sample(float g, float phi, float r, const float* u, float& theta, float& beta, float& alpha, float& n) const {
+		theta = beta = alpha = n = 0;
+		int gBin = max(0, min((int)((g * 0.5f + 0.5f) * binsG), binsG - 1));
+
+		if (method == TABULAR_METHOD_STF)
+		{
+			float logR = maxf(0, log2f(r));
+			int rBin = (int)logR;
+			rBin += u[0] < logR - rBin;
+			rBin = min(rBin, binsR - 1);
+			r = (float)(1 << rBin);
+
+			int phiBin = phi > 0.999f ? binsPhi - 1 : max(0, (int)(logf(1 / (1 - phi)) * (binsPhi - 2) / logf(1 / 0.001f)));
+			unsigned long long row = ((unsigned long long)gBin * binsPhi + phiBin) * binsR + rBin;
+
+			float selectingCase = u[1];
+			float prob0Scat = expf(-r);
+			float prob1Scat = once->Value(row / once->RowLength(), (int)(row % once->RowLength()));
+			float probmScat = multiple->Value(row / multiple->RowLength(), (int)(row % multiple->RowLength()));
+
+			if (selectingCase < prob0Scat) // no scattering
+			{
+				theta = 1;
+				return true;
+			}
+			selectingCase -= prob0Scat;
+			if (selectingCase < prob1Scat) // a single scattering inside the sphere
+			{
+				float t = -logf(1 - u[2] * (1 - prob0Scat)) / r;
+				float wz = fabsf(g) < 0.001f ? 1 - 2 * u[3] : InvertHG(g, u[3]);
+				// DistanceToSphereBoundary(float3(0, 0, t), w)
+				float b = 2 * t * wz;
+				float c = t * t - 1;
+				float disc = b * b - 4 * c;
+				float d = disc <= 0 ? 0 : maxf(0, (-b + sqrtf(disc)) / 2);
+				float cosBeta = t * wz + d;
+				beta = sqrtf(maxf(0, 1 - cosBeta * cosBeta));
+				theta = t + wz * d;
+				n = 1;
+				return true;
+			}
+			selectingCase -= prob1Scat;
+			if (selectingCase < probmScat) // cosine weighted direction and theta from the table
+			{
+				float angle = u[2] * 2 * 3.141596f;
+				float rad = sqrtf(u[3]);
+				alpha = rad * sinf(angle);
+				beta = rad * cosf(angle);
+				int thetaBin = stf->IsAlias() ?
+					stf->Sample(row, UnitToBits(selectingCase / probmScat)) :
+					stf->Search(row, selectingCase);
+				theta = 2 * (thetaBin + u[4]) / binsTheta - 1;
+				n = 2;
+				return true;
+			}
+			return false;
+		}
+
+		int rBin = 0;
+		if (r < 1)
+			rBin = u[0] < r;
+		else
+		{
+			float logR = log2f(r) - 0.5f + 1;
+			rBin = (int)logR;
+			rBin += u[0] < logR - rBin;
+		}
+		rBin = min(rBin, binsR - 1);
+
+		unsigned long long row = (unsigned long long)gBin * binsR + rBin;
+		int logNBin = logN->IsAlias() ? logN->Sample(row, UnitToBits(u[1])) : logN->Search(row, u[1]);
+		float sampledLogN = 8.0f * (logNBin + u[2]) / binsLogN;
+		int N = (int)expf(sampledLogN);
+		if (u[3] >= powf(phi, (float)N)) // absorption given N
+			return false;
+
+		unsigned long long xwRow = row * binsLogN + logNBin;
+		int xwBin = xw->IsAlias() ? xw->Sample(xwRow, UnitToBits(u[4])) : xw->Search(xwRow, u[4]);
+		int thetaBin = xwBin / (binsBeta * binsAlpha);
+		int betaBin = (xwBin % (binsBeta * binsAlpha)) / binsAlpha;
+		int alphaBin = xwBin % binsAlpha;
+		theta = (thetaBin + u[5]) * 2.0f / binsTheta - 1;
+		beta = N > 1 ? (betaBin + u[6]) * 2.0f / binsBeta - 1 : 0.0f;
+		alpha = N > 2 ? (alphaBin + u[7]) * 2.0f / binsAlpha - 1 : 0.0f;
+		n = (float)N;
+		return true;
+	}
+
+	// Samples every sample of a batch. Returns the number of paths that are not absorbed.
+	int SampleBatch(TabularSampleBatch& batch) const;
+
+	// HG inverse cdf (invertcdf in HGPhaseFunction.h)
+	static inline float InvertHG(float g, float xi) {
+		float t = (1 - g * g) / (1 - g + 2 * g * xi);
+		return 0.5f / g * (1 + g * g - t * t);
+	}
+
+	// 32 random bits of a uniform in [0, 1)
+	static inline unsigned int UnitToBits(float u) {
+		double bits = u * 4294967296.0;
+		return bits >= 4294967295.0 ? 0xFFFFFFFFu : bits <= 0 ? 0 : (unsigned int)bits;
+	}
+
+private:
+	// Bins of the cdf rows (first entry greater than value, length - 1 if none).
+	// Float tables are searched in lockstep: the same steps of a branch-free binary search for all lanes with gathers.
+	static void SearchBatch(const TabularTable& table, const unsigned long long* rows, const float* values,
+		const float* scales, int* bins) {
+		int length = table.RowLength();
+		const float* data = table.Values();
+		if (!data || table.Rows() * length > 0x7FFFFFFF)
+		{
+			for (int l = 0; l < BATCH_WIDTH; l++)
+				bins[l] = table.IsAlias() ?
+					table.Sample(rows[l], UnitToBits(values[l] / maxf(scales[l], 1e-30f))) :
+					table.Search(rows[l], values[l]);
+			return;
+		}
+
+		// entries of the first length - 1 not greater than value
+		int indices[BATCH_WIDTH];
+		int starts[BATCH_WIDTH];
+		for (int l = 0; l < BATCH_WIDTH; l++)
+		{
+			starts[l] = (int)rows[l] * length;
+			bins[l] = 0;
+		}
+		batch_float value = BatchLoad(values);
+		batch_float zero = BatchSet(0);
+		float steps[BATCH_WIDTH];
+		int remaining = length - 1;
+		while (remaining > 1)
+		{
+			int half = remaining / 2;
+			for (int l = 0; l < BATCH_WIDTH; l++)
+				indices[l] = starts[l] + bins[l] + half - 1;
+			BatchStore(steps, BatchSelectLess(value, BatchGather(data, indices), zero, BatchSet((float)half)));
+			for (int l = 0; l < BATCH_WIDTH; l++)
+				bins[l] += (int)steps[l];
+			remaining -= half;
+		}
+		if (remaining == 1)
+		{
+			for (int l = 0; l < BATCH_WIDTH; l++)
+				indices[l] = starts[l] + bins[l];
+			BatchStore(steps, BatchSelectLess(value, BatchGather(data, indices), zero, BatchSet(1)));
+			for (int l = 0; l < BATCH_WIDTH; l++)
+				bins[l] += (int)steps[l];
+		}
+	}
+
+	// Values of a table without rows of a cdf (the albedos) at an index of its entries
+	static inline void GatherBatch(const TabularTable& table, const unsigned long long* entries, float* values) {
+		int length = table.RowLength();
+		for (int l = 0; l < BATCH_WIDTH; l++)
+			values[l] = table.Value(entries[l] / length, (int)(entries[l] % length));
+	}
+
+	void SampleSTF(TabularSampleBatch& batch, int s) const;
+	void SampleSTFX(TabularSampleBatch& batch, int s) const;
+};
+
+/// Samples of the tabular samplers stored by feature as in CVAESampleBatch.
+/// Usage: Resize, write G, Phi and Density of every sample, GenerateRandoms and TabularSampler::SampleBatch.
+class TabularSampleBatch {
+	float* data = nullptr;
+	int capacity = 0;
+	int count = 0;
+	int stride = 0;
+
+	TabularSampleBatch(const TabularSampleBatch&) = delete;
+	TabularSampleBatch& operator=(const TabularSampleBatch&) = delete;
+
+public:
+	// Inputs
+	float* G;
+	float* Phi;
+	float* Density;
+
+	// Uniform random numbers, TABULAR_SAMPLE_RANDOMS by sample
+	float* Random[TABULAR_SAMPLE_RANDOMS];
+
+	// Outputs. Scattered is 1 if the path is not absorbed, then N is the number of scattering events
+	// (0, 1 or 2 for more with the STF tables) and CosTheta, Wt and Wb the theta, beta and alpha of the exit.
+	float* Scattered;
+	float* N;
+	float* CosTheta;
+	float* Wt;
+	float* Wb;
+
+	TabularSampleBatch() {}
+
+	~TabularSampleBatch() {
+		delete[] data;
+	}
+
+	inline int Count() const { return count; }
+
+	// Sets the number of samples. Columns are padded to BATCH_WIDTH and their content is lost if the batch grows.
+	void Resize(int count) {
+		this->count = count;
+		if (count <= capacity)
+			return;
+
+		delete[] data;
+		capacity = count;
+		stride = (count + BATCH_WIDTH - 1) / BATCH_WIDTH * BATCH_WIDTH;
+
+		int columns = 3 + TABULAR_SAMPLE_RANDOMS + 5;
+		data = new float[columns * stride];
+		memset(data, 0, sizeof(float) * columns * stride);
+
+		float* next = data;
+		auto column = [&next, this]() {
+			float* c = next;
+			next += stride;
+			return c;
+		};
+		G = column(); Phi = column(); Density = column();
+		for (int i = 0; i < TABULAR_SAMPLE_RANDOMS; i++)
+			Random[i] = column();
+		Scattered = column(); N = column(); CosTheta = column(); Wt = column(); Wb = column();
+	}
+
+	// Random numbers of a sample in the order of TABULAR_SAMPLE_RANDOMS.
+	inline void GetRandoms(int s, float* u) const {
+		for (int i = 0; i < TABULAR_SAMPLE_RANDOMS; i++)
+			u[i] = Random[i][s];
+	}
+
+	// Generates the random numbers of all samples with xorshift32.
+	void GenerateRandoms(unsigned int seed) {
+		unsigned int state = seed * 747796405u + 2891336453u;
+		for (int s = 0; s < count; s++)
+			for (int i = 0; i < TABULAR_SAMPLE_RANDOMS; i++)
+			{
+				state ^= state << 13;
+				state ^= state >> 17;
+				state ^= state << 5;
+				Random[i][s] = (state >> 8) * (1.0f / 16777216.0f);
+			}
+	}
+};
+
+inline int TabularSampler::SampleBatch(TabularSampleBatch& batch) const {
+	int count = batch.Count();
+	int padded = (count + BATCH_WIDTH - 1) / BATCH_WIDTH * BATCH_WIDTH;
+	// the padding lanes sample valid bins of g = 0, phi = 0 and r = 0
+	for (int s = count; s < padded; s++)
+		batch.G[s] = batch.Phi[s] = batch.Density[s] = 0;
+	for (int s = 0; s < padded; s += BATCH_WIDTH)
+		if (method == TABULAR_METHOD_STF)
+			SampleSTF(batch, s);
+		else
+			SampleSTFX(batch, s);
+
+	int exits = 0;
+	for (int s = 0; s < count; s++)
+		exits += batch.Scattered[s] != 0;
+	return exits;
+}
+
+inline void TabularSampler::SampleSTF(TabularSampleBatch& batch, int s) const {
+	batch_float zero = BatchSet(0), one = BatchSet(1);
+	batch_float g = BatchLoad(batch.G + s), phi = BatchLoad(batch.Phi + s), r = BatchLoad(batch.Density + s);
+	batch_float u[5];
+	for (int i = 0; i < 5; i++)
+		u[i] = BatchLoad(batch.Random[i] + s);
+
+	// logR = max(0, log2(r)), rBin floor(logR) or the next bin with probability frac(logR), r = 2^rBin
+	batch_float logR = BatchMax(zero, BatchMul(BatchLog(BatchMax(r, BatchSet(1e-30f))), BatchSet(1.44269504088896341f)));
+	batch_float rBin = BatchFloor(logR);
+	rBin = BatchAdd(rBin, BatchSelectLess(u[0], BatchSub(logR, rBin), one, zero));
+	rBin = BatchMin(rBin, BatchSet((float)(binsR - 1)));
+	r = BatchPow2(rBin);
+
+	batch_float gBin = BatchMax(zero, BatchMin(BatchFloor(BatchMul(BatchAdd(BatchMul(g, BatchSet(0.5f)), BatchSet(0.5f)), BatchSet((float)binsG))),
+		BatchSet((float)(binsG - 1))));
+	// log(1 / (1 - phi)) linear up to 0.999, the last bin above
+	batch_float phiBin = BatchFloor(BatchMul(BatchSub(zero, BatchLog(BatchSub(one, BatchMin(phi, BatchSet(0.999f))))),
+		BatchSet((binsPhi - 2) / logf(1 / 0.001f))));
+	phiBin = BatchSelectLess(BatchSet(0.999f), phi, BatchSet((float)(binsPhi - 1)), BatchMax(zero, BatchMin(phiBin, BatchSet((float)(binsPhi - 2)))));
+
+	float bins[3][BATCH_WIDTH];
+	BatchStore(bins[0], gBin);
+	BatchStore(bins[1], phiBin);
+	BatchStore(bins[2], rBin);
+	unsigned long long rows[BATCH_WIDTH];
+	for (int l = 0; l < BATCH_WIDTH; l++)
+		rows[l] = ((unsigned long long)bins[0][l] * binsPhi + (unsigned long long)bins[1][l]) * binsR + (unsigned long long)bins[2][l];
+
+	float values[2][BATCH_WIDTH];
+	const float* onceValues = once->Values();
+	const float* multipleValues = multiple->Values();
+	if (onceValues && multipleValues && stf->Rows() <= 0x7FFFFFFF)
+	{
+		int indices[BATCH_WIDTH];
+		for (int l = 0; l < BATCH_WIDTH; l++)
+			indices[l] = (int)rows[l];
+		BatchStore(values[0], BatchGather(onceValues, indices));
+		BatchStore(values[1], BatchGather(multipleValues, indices));
+	}
+	else
+	{
+		GatherBatch(*once, rows, values[0]);
+		GatherBatch(*multiple, rows, values[1]);
+	}
+	batch_float prob0Scat = BatchExp(BatchSub(zero, r));
+	batch_float prob1Scat = BatchLoad(values[0]);
+	batch_float probmScat = BatchLoad(values[1]);
+
+	// cases, selectingCase is the value searched in the theta cdf in the multiple scattering case
+	batch_float selectingCase = u[1];
+	batch_float noScattering = BatchSelectLess(selectingCase, prob0Scat, one, zero);
+	selectingCase = BatchSub(selectingCase, prob0Scat);
+	batch_float singleScattering = BatchSelectLess(selectingCase, prob1Scat, one, zero);
+	selectingCase = BatchSub(selectingCase, prob1Scat);
+	batch_float multipleScattering = BatchSelectLess(selectingCase, probmScat, one, zero);
+
+	// single scattering, free flight in the sphere and exit along an HG direction
+	batch_float t = BatchDiv(BatchSub(zero, BatchLog(BatchMax(BatchSet(1e-30f), BatchSub(one, BatchMul(u[2], BatchSub(one, prob0Scat)))))), r);
+	batch_float absG = BatchMax(g, BatchSub(zero, g));
+	batch_float safeG = BatchSelectLess(absG, BatchSet(0.001f), one, g);
+	batch_float tHG = BatchDiv(BatchSub(one, BatchMul(safeG, safeG)), BatchMulAdd(BatchMul(BatchSet(2), safeG), u[3], BatchSub(one, safeG)));
+	batch_float wz = BatchDiv(BatchSub(BatchAdd(one, BatchMul(safeG, safeG)), BatchMul(tHG, tHG)), BatchMul(BatchSet(2), safeG));
+	wz = BatchSelectLess(absG, BatchSet(0.001f), BatchSub(one, BatchMul(BatchSet(2), u[3])), wz);
+	batch_float b = BatchMul(BatchMul(BatchSet(2), t), wz);
+	batch_float disc = BatchSub(BatchMul(b, b), BatchMul(BatchSet(4), BatchSub(BatchMul(t, t), one)));
+	batch_float d = BatchMax(zero, BatchMul(BatchSet(0.5f), BatchSub(BatchSqrt(BatchMax(zero, disc)), b)));
+	d = BatchSelectLess(zero, disc, d, zero);
+	batch_float cosBeta = BatchMulAdd(t, wz, d);
+	batch_float singleTheta = BatchMulAdd(wz, d, t);
+	batch_float singleBeta = BatchSqrt(BatchMax(zero, BatchSub(one, BatchMul(cosBeta, cosBeta))));
+
+	// multiple scattering, cosine weighted direction and theta from the table
+	batch_float sine, cosine;
+	BatchSinCos(BatchMul(u[2], BatchSet(2 * 3.141596f)), sine, cosine);
+	batch_float rad = BatchSqrt(u[3]);
+	float searched[BATCH_WIDTH], scales[BATCH_WIDTH];
+	BatchStore(searched, selectingCase);
+	BatchStore(scales, probmScat);
+	int thetaBins[BATCH_WIDTH];
+	SearchBatch(*stf, rows, searched, scales, thetaBins);
+	float thetaBin[BATCH_WIDTH];
+	for (int l = 0; l < BATCH_WIDTH; l++)
+		thetaBin[l] = (float)thetaBins[l];
+	batch_float multipleTheta = BatchSub(BatchMul(BatchAdd(BatchLoad(thetaBin), u[4]), BatchSet(2.0f / binsTheta)), one);
+
+	// outputs of the case of every lane
+	batch_float scattered = BatchMax(noScattering, BatchMax(singleScattering, multipleScattering));
+	batch_float isSingle = BatchMul(singleScattering, BatchSub(one, noScattering));
+	batch_float isMultiple = BatchMul(BatchMul(multipleScattering, BatchSub(one, singleScattering)), BatchSub(one, noScattering));
+	batch_float theta = BatchSelectLess(zero, noScattering, one,
+		BatchSelectLess(zero, isSingle, singleTheta, BatchMul(isMultiple, multipleTheta)));
+	batch_float beta = BatchSelectLess(zero, isSingle, singleBeta, BatchMul(isMultiple, BatchMul(rad, cosine)));
+	batch_float alpha = BatchMul(isMultiple, BatchMul(rad, sine));
+	BatchStore(batch.Scattered + s, scattered);
+	BatchStore(batch.N + s, BatchAdd(isSingle, BatchMul(BatchSet(2), isMultiple)));
+	BatchStore(batch.CosTheta + s, theta);
+	BatchStore(batch.Wt + s, beta);
+	BatchStore(batch.Wb + s, alpha);
+}
+
+inline void TabularSampler::SampleSTFX(TabularSampleBatch& batch, int s) const {
+	batch_float zero = BatchSet(0), one = BatchSet(1);
+	batch_float g = BatchLoad(batch.G + s), phi = BatchLoad(batch.Phi + s), r = BatchLoad(batch.Density + s);
+	batch_float u[TABULAR_SAMPLE_RANDOMS];
+	for (int i = 0; i < TABULAR_SAMPLE_RANDOMS; i++)
+		u[i] = BatchLoad(batch.Random[i] + s);
+
+	// rBin 0 or 1 linearly for r < 1, otherwise floor(log2(r) + 0.5) or the next bin with probability frac(log2(r) + 0.5)
+	batch_float logR = BatchMulAdd(BatchLog(BatchMax(r, BatchSet(1e-30f))), BatchSet(1.44269504088896341f), BatchSet(0.5f));
+	batch_float rBin = BatchFloor(logR);
+	rBin = BatchAdd(rBin, BatchSelectLess(u[0], BatchSub(logR, rBin), one, zero));
+	rBin = BatchSelectLess(r, one, BatchSelectLess(u[0], r, one, zero), rBin);
+	rBin = BatchMin(rBin, BatchSet((float)(binsR - 1)));
+
+	batch_float gBin = BatchMax(zero, BatchMin(BatchFloor(BatchMul(BatchAdd(BatchMul(g, BatchSet(0.5f)), BatchSet(0.5f)), BatchSet((float)binsG))),
+		BatchSet((float)(binsG - 1))));
+
+	float bins[2][BATCH_WIDTH];
+	BatchStore(bins[0], gBin);
+	BatchStore(bins[1], rBin);
+	unsigned long long rows[BATCH_WIDTH];
+	for (int l = 0; l < BATCH_WIDTH; l++)
+		rows[l] = (unsigned long long)bins[0][l] * binsR + (unsigned long long)bins[1][l];
+
+	// logN from the table, N = int(e^logN), absorbed if the random is not below phi^N
+	float searched[BATCH_WIDTH], scales[BATCH_WIDTH];
+	BatchStore(searched, u[1]);
+	BatchStore(scales, one);
+	int logNBins[BATCH_WIDTH];
+	SearchBatch(*logN, rows, searched, scales, logNBins);
+	float logNBin[BATCH_WIDTH];
+	for (int l = 0; l < BATCH_WIDTH; l++)
+	{
+		logNBin[l] = (float)logNBins[l];
+		rows[l] = rows[l] * binsLogN + logNBins[l];
+	}
+	batch_float sampledLogN = BatchMul(BatchAdd(BatchLoad(logNBin), u[2]), BatchSet(8.0f / binsLogN));
+	batch_float n = BatchFloor(BatchExp(sampledLogN));
+	batch_float phiN = BatchExp(BatchMul(n, BatchLog(BatchMax(phi, BatchSet(1e-30f)))));
+	phiN = BatchSelectLess(phi, BatchSet(1e-30f), zero, phiN);
+	batch_float scattered = BatchSelectLess(u[3], phiN, one, zero);
+
+	// exit from the table
+	BatchStore(searched, u[4]);
+	int xwBins[BATCH_WIDTH];
+	SearchBatch(*xw, rows, searched, scales, xwBins);
+	float xwBin[3][BATCH_WIDTH];
+	for (int l = 0; l < BATCH_WIDTH; l++)
+	{
+		xwBin[0][l] = (float)(xwBins[l] / (binsBeta * binsAlpha));
+		xwBin[1][l] = (float)((xwBins[l] % (binsBeta * binsAlpha)) / binsAlpha);
+		xwBin[2][l] = (float)(xwBins[l] % binsAlpha);
+	}
+	batch_float theta = BatchSub(BatchMul(BatchAdd(BatchLoad(xwBin[0]), u[5]), BatchSet(2.0f / binsTheta)), one);
+	batch_float beta = BatchSub(BatchMul(BatchAdd(BatchLoad(xwBin[1]), u[6]), BatchSet(2.0f / binsBeta)), one);
+	batch_float alpha = BatchSub(BatchMul(BatchAdd(BatchLoad(xwBin[2]), u[7]), BatchSet(2.0f / binsAlpha)), one);
+	beta = BatchSelectLess(one, n, beta, zero); // only if N > 1
+	alpha = BatchSelectLess(BatchSet(2), n, alpha, zero); // only if N > 2
+
+	BatchStore(batch.Scattered + s, scattered);
+	BatchStore(batch.N + s, BatchMul(scattered, n));
+	BatchStore(batch.CosTheta + s, BatchMul(scattered, theta));
+	BatchStore(batch.Wt + s, BatchMul(scattered, beta));
+	BatchStore(batch.Wb + s, BatchMul(scattered, alpha));
+}
+
+/// Exits of a tabular sampler (TabularSampler::SampleBatch) for a configuration, as SampleCVAEExits.
+inline void SampleTabularExits(const TabularSampler& sampler, float g, float phi, float r, int count, unsigned int seed,
+	SphereExitStatistics& statistics, int batchSize = 512) {
+	TabularSampleBatch batch;
+	batch.Resize(batchSize);
+	for (int b = 0; b * batchSize < count; b++)
+	{
+		int size = min(batchSize, count - b * batchSize);
+		batch.Resize(size);
+		for (int s = 0; s < size; s++)
+		{
+			batch.G[s] = g;
+			batch.Phi[s] = phi;
+			batch.Density[s] = r;
+		}
+		batch.GenerateRandoms(seed * 7919u + b);
+		sampler.SampleBatch(batch);
+		for (int s = 0; s < size; s++)
+			if (batch.Scattered[s] != 0)
+				statistics.AddExit(batch.N[s], batch.CosTheta[s], batch.Wt[s], batch.Wb[s]);
+			else
+				statistics.AddAbsorbed();
+	}
+}
+
+/// Compares a tabular sampler with the walks for a configuration. The walks of the STF tables start with a free flight
+/// and their events error and distance only tell the ratio of exits with 0, 1 or more events.
+inline SphereSamplerAccuracy CompareTabularSampler(const TabularSampler& sampler, float g, float phi, float r,
+	int samples = 1 << 20, unsigned int seed = 1, int threads = 0) {
+	return CompareSphereSampler(g, phi, r, [&sampler](float g, float phi, float r, int count, unsigned int seed, SphereExitStatistics& statistics) {
+		SampleTabularExits(sampler, g, phi, r, count, seed, statistics);
+	}, samples, seed, threads, sampler.ScattersAtCenter());
+}
+
+struct TabularSamplingBenchmark {
+	int BatchSize;
+	// Fraction of the samples that are not absorbed
+	float ExitRatio;
+	// Single thread throughput in samples per second, sampling sample by sample with TabularSampler::Sample and with SampleBatch
+	float ScalarSamplesPerSecond;
+	float BatchSamplesPerSecond;
+	// Samples where the versions don't agree in the absorption or the number of events (bins decided by the last bits of
+	// the approximated logarithms), and maximum difference of theta, beta and alpha of the other samples
+	int Mismatches;
+	float MaxExitError;
+};
+
+/// Compares SampleBatch with the sample by sample version for random inputs and the same random numbers.
+/// Albedos are in [0.975, 1] as in the scenes of the paper, densities in [0, 200].
+inline TabularSamplingBenchmark BenchmarkTabularSampling(const TabularSampler& sampler, int batchSize = 512,
+	int samples = 1 << 20, unsigned int seed = 1) {
+	unsigned int state = seed * 747796405u + 2891336453u;
+	auto random = [&state]() {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return (state >> 8) * (1.0f / 16777216.0f);
+	};
+
+	int batches = max(1, samples / batchSize);
+	samples = batches * batchSize;
+
+	TabularSamplingBenchmark result = {};
+	result.BatchSize = batchSize;
+
+	TabularSampleBatch batch;
+	batch.Resize(batchSize);
+	float* scalarOutputs = new float[batchSize * 5];
+	float scalarTime = 0, batchTime = 0;
+	int exits = 0;
+
+	for (int b = 0; b < batches; b++)
+	{
+		for (int s = 0; s < batchSize; s++)
+		{
+			batch.G[s] = random() * 2 - 1;
+			batch.Phi[s] = 1 - 0.025f * random();
+			batch.Density[s] = random() * 200;
+		}
+		batch.GenerateRandoms(seed * 7919 + b);
+
+		Stopwatch stopwatch;
+		for (int s = 0; s < batchSize; s++)
+		{
+			float u[TABULAR_SAMPLE_RANDOMS];
+			batch.GetRandoms(s, u);
+			float* o = scalarOutputs + s * 5;
+			o[0] = sampler.Sample(batch.G[s], batch.Phi[s], batch.Density[s], u, o[1], o[2], o[3], o[4]) ? 1.0f : 0.0f;
+		}
+		scalarTime += stopwatch.Milliseconds();
+
+		stopwatch.Start();
+		exits += sampler.SampleBatch(batch);
+		batchTime += stopwatch.Milliseconds();
+
+		for (int s = 0; s < batchSize; s++)
+		{
+			const float* o = scalarOutputs + s * 5;
+			if (o[0] != batch.Scattered[s] || (o[0] != 0 && o[4] != batch.N[s]))
+			{
+				result.Mismatches++;
+				continue;
+			}
+			if (o[0] != 0)
+				result.MaxExitError = maxf(result.MaxExitError, maxf(fabsf(o[1] - batch.CosTheta[s]),
+					maxf(fabsf(o[2] - batch.Wt[s]), fabsf(o[3] - batch.Wb[s]))));
+		}
+	}
+
+	result.ExitRatio = exits / (float)samples;
+	result.ScalarSamplesPerSecond = samples * 1000.0f / scalarTime;
+	result.BatchSamplesPerSecond = samples * 1000.0f / batchTime;
+
+	delete[] scalarOutputs;
+	return result;
+}
+
+/// Accuracy of the tabular and the CVAE samplers for a configuration when both take the same time.
+struct TabularCVAEComparison {
+	// Samples of every sampler in the time
+	int TabularSamples;
+	int CVAESamples;
+	SphereSamplerAccuracy Tabular;
+	SphereSamplerAccuracy CVAE;
+};
+
+/// Measures the single thread cost of both samplers with timingSamples samples and compares them with the walks
+/// with the samples each one takes in milliseconds.
+inline TabularCVAEComparison CompareTabularAndCVAEAtEqualTime(const TabularSampler& sampler, const CVAEModels& models,
+	float g, float phi, float r, float milliseconds, unsigned int seed = 1, int threads = 0, int timingSamples = 1 << 14) {
+	SphereExitStatistics timing;
+	timing.Clear();
+	Stopwatch stopwatch;
+	SampleTabularExits(sampler, g, phi, r, timingSamples, seed, timing);
+	float tabularMilliseconds = maxf(1e-6f, stopwatch.Milliseconds());
+	stopwatch.Start();
+	SampleCVAEExits(models, g, phi, r, timingSamples, seed, timing);
+	float cvaeMilliseconds = maxf(1e-6f, stopwatch.Milliseconds());
+
+	TabularCVAEComparison result = {};
+	result.TabularSamples = max(1, (int)minf(1 << 30, timingSamples * milliseconds / tabularMilliseconds));
+	result.CVAESamples = max(1, (int)minf(1 << 30, timingSamples * milliseconds / cvaeMilliseconds));
+	result.Tabular = CompareTabularSampler(sampler, g, phi, r, result.TabularSamples, seed, threads);
+	result.CVAE = CompareCVAESampler(models, g, phi, r, result.CVAESamples, seed, threads);
+	return result;
+}
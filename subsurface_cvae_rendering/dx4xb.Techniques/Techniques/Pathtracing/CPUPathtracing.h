@@ -0,0 +1,607 @@
+#pragma once
+
+#include "dx4xb_scene_types.h"
+#include "../../scene_traits.h"
+#include "../Tools/Parameters.h"
+#include "../CPU/TriangleBVH.h"
+#include "../CPU/CounterRandom.h"
+#include "../CPU/PhaseSampling.h"
+#include "../CPU/Parallel.h"
+#include "../CPU/Stopwatch.h"
+#ifdef RANDOMS_LOW_DISCREPANCY
+#include "../CPU/LowDiscrepancy.h"
+#endif
+#include <math.h>
+#include <stdio.h>
+
+using namespace dx4xb;
+
+/// Random numbers of a ray drawn as random() in Tools/Randoms.h, with the generator selected by the same defines.
+struct CPUPathtracingRandom {
+#if defined(RANDOMS_LOW_DISCREPANCY)
+	// Tile and sequence are set by the tracer when LOW_DISCREPANCY_BLUE_NOISE is defined
+	LowDiscrepancySampler Sampler;
+
+	// The bounce selects the scramble, the frame is the index of the sample.
+	void Start(const RandomStreamGrid& grid, unsigned int x, unsigned int y, unsigned int bounce, unsigned int frame) {
+		Sampler.Seed = bounce;
+		Sampler.Start(x, y, frame);
+	}
+
+	inline float Next() {
+		return Sampler.Next();
+	}
+#else
+#if defined(RANDOMS_HYBRID_TAUS)
+	HybridTausRandom Random;
+#else
+	CounterRandom Random;
+#endif
+
+	void Start(const RandomStreamGrid& grid, unsigned int x, unsigned int y, unsigned int bounce, unsigned int frame) {
+		Random.Start(grid, x, y, bounce, frame);
+	}
+
+	inline float Next() {
+		return Random.Next();
+	}
+#endif
+};
+
+/// Time spent by CPUPathtracing::Render.
+struct CPUPathtracingReport {
+	int Frames;
+	int Threads;
+	float Seconds;
+	// Paths (pixels per frame) and path segments (intersection queries, the complexity) per second
+	double PathsPerSecond;
+	double SegmentsPerSecond;
+};
+
+/// Headless version of PathtracingTechnique on CPU, for references and regression images without a raytracing device.
+/// Consumes the scene of the SceneManager as PathtracingTechniqueBase (triangles placed by the instance transforms,
+/// surfels by the geometry and instance transforms, materials and volume materials), follows the paths of
+/// Pathtracing_RT.hlsl with the random numbers of Tools/Randoms.h, and accumulates the same statistics
+/// (Accumulation and SqrAccumulation as float4 per pixel with rgb used, Complexity) restarted when the scene changes.
+/// Pixels of a frame are traced by rows on all logical processors, every pixel has its own random stream so
+/// the images don't depend on the number of threads.
+/// Textures are not sampled: materials are used as untextured and normals without bump mapping.
+class CPUPathtracing : public IManageScene {
+public:
+	// Per (instance, geometry) as ObjInfo of the hit groups
+	struct ObjInfo {
+		int StartTriangle;
+		int VertexOffset;
+		int TransformIndex;
+		int MaterialIndex;
+		// First triangle of the geometry in the hierarchy
+		int FirstTriangle;
+	};
+
+	CPUPathtracing(int width, int height) : width(width), height(height) {
+		Accumulation = new float[width * height * 4]();
+		SqrAccumulation = new float[width * height * 4]();
+		Complexity = new unsigned int[width * height]();
+	}
+
+	CPUPathtracing(const CPUPathtracing&) = delete;
+	CPUPathtracing& operator=(const CPUPathtracing&) = delete;
+
+	~CPUPathtracing() {
+		delete[] Accumulation;
+		delete[] SqrAccumulation;
+		delete[] Complexity;
+		delete[] vertices;
+		delete[] indices;
+		delete[] materials;
+		delete[] volMaterials;
+		delete[] transforms;
+		delete[] objects;
+		delete[] triangleObjects;
+	}
+
+	// Threads tracing a frame, the logical processors by default.
+	int Threads = 0;
+
+	// Sum and squared sum of the frames since the last restart (float4 per pixel) and sum of the path segments.
+	float* Accumulation;
+	float* SqrAccumulation;
+	unsigned int* Complexity;
+	// Frames accumulated, 0 after a change of the scene
+	int Pass = 0;
+
+	int Width() const { return width; }
+	int Height() const { return height; }
+
+	void getAccumulators(const float*& sum, const float*& sqrSum, int& frames) const {
+		sum = Accumulation;
+		sqrSum = SqrAccumulation;
+		frames = Pass;
+	}
+
+	// Takes the scene of the SceneManager, as OnLoad of PathtracingTechniqueBase.
+	void OnLoad() {
+		auto desc = scene->getScene();
+
+		int globalGeometryCount = 0;
+		for (int i = 0; i < desc->Instances().Count; i++)
+			globalGeometryCount += desc->Instances().Data[i].Count;
+
+		vertices = new SceneVertex[max(1, desc->Vertices().Count)];
+		indices = new int[max(1, desc->Indices().Count)];
+		transforms = new float4x3[max(1, globalGeometryCount)];
+		materials = new SceneMaterial[max(1, desc->Materials().Count)];
+		volMaterials = new VolumeMaterial[max(1, desc->Materials().Count)];
+		objects = new ObjInfo[max(1, globalGeometryCount)];
+		objectCount = globalGeometryCount;
+
+#if defined(RANDOMS_LOW_DISCREPANCY) && defined(LOW_DISCREPANCY_BLUE_NOISE)
+		blueNoise.Build();
+#endif
+
+		Pass = 0;
+		UpdateBuffers(scene->Updated(sceneVersion));
+		CreateScene();
+	}
+
+	// Updates dirty elements and accumulates a frame, as OnDispatch of PathtracingTechniqueBase.
+	void OnDispatch() {
+		SceneElement elements = scene->Updated(sceneVersion);
+		UpdateBuffers(elements);
+		if (+(elements & (SceneElement::Vertices | SceneElement::Indices | SceneElement::InstanceTransforms)))
+			CreateScene();
+		if (elements != SceneElement::None)
+			Pass = 0; // restart frame for Pathtracing...
+		DrawScene();
+	}
+
+	// Accumulates frames. If statsPrefix is given the statistics are saved at every power of 2 of frames after
+	// the first (prefix_N_sum.bin and prefix_N_sqrSum.bin), as SAVE_STATS.
+	CPUPathtracingReport Render(int frames, const char* statsPrefix = nullptr) {
+		CPUPathtracingReport report = {};
+		report.Frames = frames;
+		report.Threads = Threads > 0 ? Threads : ProcessorCount();
+
+		double segments = 0;
+		Stopwatch watch;
+		for (int f = 0; f < frames; f++)
+		{
+			OnDispatch();
+			segments += frameComplexity;
+			if (statsPrefix && Pass > 1 && (Pass & (Pass - 1)) == 0)
+				SaveStatistics(statsPrefix);
+		}
+		report.Seconds = watch.Milliseconds() / 1000;
+		if (report.Seconds > 0)
+		{
+			report.PathsPerSecond = (double)frames * width * height / report.Seconds;
+			report.SegmentsPerSecond = segments / report.Seconds;
+		}
+		return report;
+	}
+
+	// Saves the float4 sums as the textures saved by SAVE_STATS, prefix_Pass_sum.bin and prefix_Pass_sqrSum.bin.
+	bool SaveStatistics(const char* prefix) const {
+		char fileName[1024];
+		sprintf_s(fileName, "%s_%d_sum.bin", prefix, Pass);
+		bool saved = SaveFloats(fileName, Accumulation, width * height * 4);
+		sprintf_s(fileName, "%s_%d_sqrSum.bin", prefix, Pass);
+		return SaveFloats(fileName, SqrAccumulation, width * height * 4) && saved;
+	}
+
+	// Traces the path of the pixel (x, y) in the current frame, as RayGen without accumulating.
+	float3 TracePixel(int x, int y, int& complexity) const {
+		CPUPathtracingRandom random;
+#if defined(RANDOMS_LOW_DISCREPANCY) && defined(LOW_DISCREPANCY_BLUE_NOISE)
+		random.Sampler.Sequence = SampleSequence::BlueNoiseSobol;
+		random.Sampler.Tile = &blueNoise;
+#endif
+		RandomStreamGrid grid = { (unsigned int)width, (unsigned int)height, 1 };
+		random.Start(grid, x, y, 0, Pass);
+
+		float cx = (x + random.Next()) / width;
+		float cy = (y + random.Next()) / height;
+
+		float4 ndcP = float4(2 * cx - 1, -(2 * cy - 1), 0, 1);
+		float4 ndcT = ndcP + float4(0, 0, 1, 0);
+
+		float4 viewP = mul(ndcP, projectionToWorld);
+		float4 viewT = mul(ndcT, projectionToWorld);
+
+		float3 O = float3(viewP.x, viewP.y, viewP.z) / viewP.w;
+		float3 D = normalize(float3(viewT.x, viewT.y, viewT.z) / viewT.w - O);
+
+		complexity = 0;
+		float3 color = ComputePath(O, D, random, complexity);
+
+		if (isnan(color.x) || isnan(color.y) || isnan(color.z))
+			color = float3(0, 0, 0);
+		return color;
+	}
+
+	int TriangleCount() const { return bvh.TriangleCount(); }
+
+private:
+	int width, height;
+
+	SceneVertex* vertices = nullptr;
+	int* indices = nullptr;
+	SceneMaterial* materials = nullptr;
+	VolumeMaterial* volMaterials = nullptr;
+	// Geometry and instance transform per (instance, geometry)
+	float4x3* transforms = nullptr;
+	ObjInfo* objects = nullptr;
+	int objectCount = 0;
+	// Object of every triangle of the hierarchy
+	int* triangleObjects = nullptr;
+	TriangleBVH bvh;
+
+	float4x4 projectionToWorld;
+	float3 lightIntensity;
+	float3 lightDirection;
+
+	double frameComplexity = 0;
+
+#if defined(RANDOMS_LOW_DISCREPANCY) && defined(LOW_DISCREPANCY_BLUE_NOISE)
+	BlueNoiseTile blueNoise;
+#endif
+
+	static bool SaveFloats(const char* fileName, const float* data, int count) {
+		FILE* file;
+		if (fopen_s(&file, fileName, "wb"))
+			return false;
+		bool written = fwrite(data, sizeof(float), count, file) == (size_t)count;
+		fclose(file);
+		return written;
+	}
+
+	static inline float3 TransformPoint(const float3& p, const float4x3& m) {
+		return float3(
+			p.x * m._m00 + p.y * m._m10 + p.z * m._m20 + m._m30,
+			p.x * m._m01 + p.y * m._m11 + p.z * m._m21 + m._m31,
+			p.x * m._m02 + p.y * m._m12 + p.z * m._m22 + m._m32);
+	}
+
+	static inline float3 TransformDirection(const float3& d, const float4x3& m) {
+		return float3(
+			d.x * m._m00 + d.y * m._m10 + d.z * m._m20,
+			d.x * m._m01 + d.y * m._m11 + d.z * m._m21,
+			d.x * m._m02 + d.y * m._m12 + d.z * m._m22);
+	}
+
+	static inline float Component(const float3& v, int c) {
+		return c == 0 ? v.x : c == 1 ? v.y : v.z;
+	}
+
+	void UpdateBuffers(SceneElement elements) {
+		auto desc = scene->getScene();
+
+		if (+(elements & SceneElement::Vertices))
+			memcpy(vertices, desc->Vertices().Data, sizeof(SceneVertex) * desc->Vertices().Count);
+
+		if (+(elements & SceneElement::Indices))
+			memcpy(indices, desc->Indices().Data, sizeof(int) * desc->Indices().Count);
+
+		if (+(elements & SceneElement::Materials))
+			for (int i = 0; i < desc->Materials().Count; i++)
+			{
+				materials[i] = desc->Materials().Data[i];
+				volMaterials[i] = desc->VolumeMaterials().Data[i];
+			}
+
+		if (+(elements & SceneElement::Camera))
+		{
+			float4x4 proj, view;
+			scene->getCamera().GetMatrices(width, height, view, proj);
+			projectionToWorld = mul(inverse(proj), inverse(view));
+		}
+
+		if (+(elements & SceneElement::Lights))
+		{
+			lightIntensity = scene->getMainLight().Intensity;
+			lightDirection = scene->getMainLight().Direction;
+		}
+
+		if (+(elements & SceneElement::GeometryTransforms) ||
+			+(elements & SceneElement::InstanceTransforms))
+		{
+			int transformIndex = 0;
+			for (int i = 0; i < desc->Instances().Count; i++)
+			{
+				auto instance = desc->Instances().Data[i];
+				for (int j = 0; j < instance.Count; j++) {
+					auto geometry = desc->Geometries().Data[instance.GeometryIndices[j]];
+
+					float4x4 geometryTransform = geometry.TransformIndex == -1 ?
+						float4x4(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1) :
+						Transforms::FromAffine(desc->getTransformsBuffer().Data[geometry.TransformIndex]);
+
+					transforms[transformIndex] = (float4x3)mul(geometryTransform, instance.Transform);
+
+					transformIndex++;
+				}
+			}
+		}
+	}
+
+	// Builds the hierarchy of the triangles of every (instance, geometry), as CreateRTXScene. Triangles are placed only
+	// by the instance transform (geometries are created without transform) and the hits are identified as in the hit groups.
+	void CreateScene() {
+		auto desc = scene->getScene();
+
+		int triangleCount = 0;
+		int geometryOffset = 0;
+		for (int i = 0; i < desc->Instances().Count; i++)
+		{
+			auto instance = desc->Instances().Data[i];
+			for (int j = 0; j < instance.Count; j++) {
+				auto geometry = desc->Geometries().Data[instance.GeometryIndices[j]];
+				ObjInfo& object = objects[geometryOffset + j];
+				object.StartTriangle = geometry.StartIndex / 3;
+				object.VertexOffset = geometry.StartVertex;
+				object.TransformIndex = geometryOffset + j;
+				object.MaterialIndex = geometry.MaterialIndex;
+				object.FirstTriangle = triangleCount;
+				triangleCount += geometry.IndexCount / 3; // only indexed geometries are traced
+			}
+			geometryOffset += instance.Count;
+		}
+
+		float3* positions = new float3[max(1, triangleCount * 3)];
+		delete[] triangleObjects;
+		triangleObjects = new int[max(1, triangleCount)];
+		geometryOffset = 0;
+		for (int i = 0; i < desc->Instances().Count; i++)
+		{
+			auto instance = desc->Instances().Data[i];
+			float4x3 instanceTransform = (float4x3)instance.Transform;
+			for (int j = 0; j < instance.Count; j++) {
+				auto geometry = desc->Geometries().Data[instance.GeometryIndices[j]];
+				const ObjInfo& object = objects[geometryOffset + j];
+				for (int t = 0; t < geometry.IndexCount / 3; t++)
+				{
+					for (int k = 0; k < 3; k++)
+						positions[(object.FirstTriangle + t) * 3 + k] = TransformPoint(
+							vertices[indices[geometry.StartIndex + t * 3 + k] + geometry.StartVertex].Position, instanceTransform);
+					triangleObjects[object.FirstTriangle + t] = geometryOffset + j;
+				}
+			}
+			geometryOffset += instance.Count;
+		}
+
+		bvh.Build(positions, triangleCount);
+		delete[] positions;
+	}
+
+	void DrawScene() {
+		if (Pass == 0) // first frame after scene dirty
+		{
+			memset(Accumulation, 0, sizeof(float) * width * height * 4);
+			memset(SqrAccumulation, 0, sizeof(float) * width * height * 4);
+			memset(Complexity, 0, sizeof(unsigned int) * width * height);
+		}
+
+		double* rowComplexity = new double[height];
+		ParallelFor(height, [&](int y, int /*thread*/) {
+			double sum = 0;
+			for (int x = 0; x < width; x++)
+			{
+				int complexity;
+				float3 color = TracePixel(x, y, complexity);
+
+				// AccumulateOutput
+				float* accumulation = Accumulation + (y * width + x) * 4;
+				float* sqrAccumulation = SqrAccumulation + (y * width + x) * 4;
+				accumulation[0] += color.x;
+				accumulation[1] += color.y;
+				accumulation[2] += color.z;
+				sqrAccumulation[0] += color.x * color.x;
+				sqrAccumulation[1] += color.y * color.y;
+				sqrAccumulation[2] += color.z * color.z;
+				Complexity[y * width + x] += complexity;
+				sum += complexity;
+			}
+			rowComplexity[y] = sum;
+		}, Threads);
+
+		frameComplexity = 0;
+		for (int y = 0; y < height; y++)
+			frameComplexity += rowComplexity[y];
+		delete[] rowComplexity;
+
+		Pass++;
+	}
+
+#pragma region Pathtracing_RT.hlsl
+
+	// Surfel of GetHitInfo. Only position and normal are used without textures (bump mapping only normalizes the normal).
+	void GetHitInfo(const TriangleHit& hit, float3& P, float3& N, int& materialIndex) const {
+		const ObjInfo& object = objects[triangleObjects[hit.Triangle]];
+		int triangleIndex = object.StartTriangle + hit.Triangle - object.FirstTriangle;
+		const SceneVertex& v1 = vertices[indices[triangleIndex * 3 + 0] + object.VertexOffset];
+		const SceneVertex& v2 = vertices[indices[triangleIndex * 3 + 1] + object.VertexOffset];
+		const SceneVertex& v3 = vertices[indices[triangleIndex * 3 + 2] + object.VertexOffset];
+		float b1 = 1 - hit.U - hit.V;
+		const float4x3& transform = transforms[object.TransformIndex];
+		P = TransformPoint(v1.Position * b1 + v2.Position * hit.U + v3.Position * hit.V, transform);
+		N = normalize(TransformDirection(v1.Normal * b1 + v2.Normal * hit.U + v3.Normal * hit.V, transform));
+		materialIndex = object.MaterialIndex;
+	}
+
+	float3 SampleSkybox(const float3& L) const {
+#ifdef USE_SKYBOX
+		static const float3 BG_COLORS[5] =
+		{
+			float3(0.1f, 0.05f, 0.01f), // GROUND DARKER BLUE
+			float3(0.01f, 0.05f, 0.2f), // HORIZON GROUND DARK BLUE
+			float3(0.8f, 0.9f, 1.0f), // HORIZON SKY WHITE
+			float3(0.1f, 0.3f, 1.0f),  // SKY LIGHT BLUE
+			float3(0.01f, 0.1f, 0.7f)  // SKY BLUE
+		};
+		static const float BG_DISTS[5] = { -1.0f, -0.1f, 0.0f, 0.4f, 1.0f };
+
+		float3 col = BG_COLORS[0];
+		for (int i = 1; i < 5; i++)
+			col = lerp(col, BG_COLORS[i], float3(smoothstep(BG_DISTS[i - 1], BG_DISTS[i], L.y)));
+		return col;
+#else
+		return float3(0, 0, 0);
+#endif
+	}
+
+	float3 SampleLight(const float3& L) const {
+#ifdef USE_NARROW_LIGHTSOURCE
+		int N = 80;
+#else
+		int N = 10;
+#endif
+		float phongNorm = (N + 2) / (4 * 3.14159f);
+		return lightIntensity * (powf(maxf(0.0f, dot(L, lightDirection)), (float)N) * phongNorm);
+	}
+
+	static inline float ComputeFresnel(float NdotL, float ratio) {
+		float divOneMinusByOnePlus = (1 - ratio) / (1 + ratio);
+		float f = divOneMinusByOnePlus * divOneMinusByOnePlus;
+		return f + (1 - f) * powf(1 - NdotL, 5);
+	}
+
+	// HLSL refract, zero on total internal reflection.
+	static inline float3 Refract(const float3& i, const float3& n, float eta) {
+		float cosi = dot(n, i);
+		float k = 1 - eta * eta * (1 - cosi * cosi);
+		if (k < 0)
+			return float3(0, 0, 0);
+		return i * eta - n * (eta * cosi + sqrtf(k));
+	}
+
+	// ComputeImpulses and RandomScatterRay (Scattering.h) followed by the update of SurfelScattering.
+	void SurfelScattering(float3& x, float3& w, float3& importance, const float3& P, const float3& N,
+		const SceneMaterial& material, CPUPathtracingRandom& random) const {
+		float3 V = w * -1;
+
+		float NdotV = dot(V, N);
+		bool invertNormal = NdotV < 0;
+		NdotV = fabsf(NdotV);
+		float eta = !invertNormal ? material.RefractionIndex : 1 / material.RefractionIndex;
+		float3 fN = invertNormal ? N * -1 : N;
+		float3 R = w - fN * (2 * dot(w, fN));
+		float Rw = ComputeFresnel(NdotV, eta);
+		float3 T = Refract(w, fN, eta);
+		float Tw = 1 - Rw;
+		if (T.x == 0 && T.y == 0 && T.z == 0)
+		{
+			Rw = 1;
+			Tw = 0; // total internal reflection
+		}
+		Rw = material.Roulette.z + Rw * material.Roulette.w;
+		Tw *= material.Roulette.w;
+
+		// randomHSDirection
+		float r1 = random.Next();
+		float r2 = random.Next() * 2 - 1;
+		float sqrtOneMinusSqrR2 = sqrtf(1 - r2 * r2);
+		float3 D = float3(cosf(6.28318531f * r1) * sqrtOneMinusSqrR2, sinf(6.28318531f * r1) * sqrtOneMinusSqrR2, r2);
+		float NdotD = dot(fN, D);
+		if (NdotD < 0)
+		{
+			D = D * -1;
+			NdotD = -NdotD;
+		}
+
+		float roulette[4] = { material.Roulette.x, material.Roulette.y, Rw, Tw };
+		float selection = random.Next();
+		float lowerBound = 0;
+		int selected = -1;
+		for (int i = 0; i < 4; i++)
+		{
+			if (lowerBound <= selection && selection < lowerBound + roulette[i])
+				selected = i;
+			lowerBound += roulette[i];
+		}
+
+		float3 ratio = float3(0, 0, 0);
+		float3 direction = float3(0, 0, 0);
+		switch (selected)
+		{
+		case 0: // Diffuse
+			ratio = material.Diffuse * 2 * NdotD;
+			direction = D;
+			break;
+		case 1: // Specular (Glossy)
+		{
+			float HdotN = maxf(0.0001f, dot(normalize(V + D), fN));
+			ratio = material.Specular * (powf(HdotN, material.SpecularPower) * (2 + material.SpecularPower) * NdotD);
+			direction = D;
+			break;
+		}
+		case 2: // Mirror
+			ratio = material.Specular;
+			direction = R;
+			break;
+		case 3: // Fresnel
+			ratio = material.Specular;
+			direction = T;
+			break;
+		}
+
+		importance = importance * maxf(float3(0, 0, 0), ratio);
+		w = direction;
+		float side = dot(direction, fN);
+		x = P + fN * ((side > 0 ? 1.0f : side < 0 ? -1.0f : 0.0f) * 0.001f);
+	}
+
+	float3 ComputePath(float3 O, float3 D, CPUPathtracingRandom& random, int& complexity) const {
+		int cmp = Pass % 3;
+		float3 importance = float3(cmp == 0 ? 3.0f : 0.0f, cmp == 1 ? 3.0f : 0.0f, cmp == 2 ? 3.0f : 0.0f);
+		float3 x = O;
+		float3 w = D;
+
+		int bounces = 0;
+
+		bool isOutside = true;
+
+		while (true)
+		{
+			complexity++;
+
+			TriangleHit hit;
+			if (!bvh.Intersect(x, w, 100.0f, hit))
+				return importance * (SampleSkybox(w) + SampleLight(w));
+
+			float3 P, N;
+			int materialIndex;
+			GetHitInfo(hit, P, N, materialIndex);
+			const SceneMaterial& material = materials[materialIndex];
+			const VolumeMaterial& volMaterial = volMaterials[materialIndex];
+
+			float d = length(P - x); // Distance to the hit position.
+			// The number is drawn even outside, both operands of ?: are evaluated in HLSL.
+			float xi = random.Next();
+			float extinction = Component(volMaterial.Extinction, cmp);
+			float t = isOutside || extinction == 0 ? 100000000 : -logf(maxf(0.000000000001f, 1 - xi)) / extinction;
+
+			if (t >= d)
+			{
+				bounces += isOutside;
+				if (bounces >= MAX_PATHTRACING_BOUNCES)
+					return float3(0, 0, 0);
+
+				SurfelScattering(x, w, importance, P, N, material, random);
+
+				if ((material.Specular.x != 0 || material.Specular.y != 0 || material.Specular.z != 0) && material.Roulette.w > 0)
+					isOutside = dot(N, w) >= 0;
+			}
+			else
+			{ // Volume scattering or absorption
+				x = x + w * t; // free traverse in a medium
+				if (random.Next() < 1 - Component(volMaterial.ScatteringAlbedo, cmp)) // absorption instead
+					return float3(0, 0, 0);
+				float uPhi = random.Next();
+				float uCos = random.Next();
+				w = SamplePhase(Component(volMaterial.G, cmp), w, uPhi, uCos); // scattering event...
+			}
+		}
+	}
+
+#pragma endregion
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "CPUPathtracing.h"
+
+/// Glass sphere of radius 0.5 filled with a thin forward-scattering medium, built without model files.
+/// Paths of the medium are short, so a few frames of a small image are traced in a fraction of a second.
+class SphereMediumScene : public SceneManager {
+	int slices, stacks;
+public:
+	SphereMediumScene(int slices = 24, int stacks = 12) : SceneManager(), slices(slices), stacks(stacks) {
+	}
+
+	void SetupScene() {
+		camera.Position = float3(0, 0, 1.6);
+		lights[0].Direction = normalize(float3(1, 1, 1));
+		lights[0].Intensity = float3(10, 10, 10);
+
+		// UV sphere, rings from the north to the south pole with a repeated seam vertex
+		list<SceneVertex> vertices;
+		for (int j = 0; j <= stacks; j++)
+			for (int i = 0; i <= slices; i++)
+			{
+				float theta = PI * j / stacks, phi = 2 * PI * i / slices;
+				SceneVertex v = {};
+				v.Normal = float3(sinf(theta) * cosf(phi), cosf(theta), sinf(theta) * sinf(phi));
+				v.Position = v.Normal * 0.5f;
+				vertices.add(v);
+			}
+		list<int> indices;
+		for (int j = 0; j < stacks; j++)
+			for (int i = 0; i < slices; i++)
+			{
+				int a = j * (slices + 1) + i, b = a + slices + 1;
+				for (int k : { a, a + 1, b, a + 1, b + 1, b })
+					indices.add(k);
+			}
+
+		int startVertex = scene->appendVertices(&vertices.first(), vertices.size());
+		int startIndex = scene->appendIndices(&indices.first(), indices.size());
+		int material = scene->appendMaterial(SceneMaterial());
+		scene->appendVolumeMaterial(VolumeMaterial{
+			float3(8, 8, 8),
+			float3(0.95, 0.9, 0.8),
+			float3(0.5, 0.5, 0.5)
+			});
+		int geometry = scene->appendGeometry(0, 0, startVertex, vertices.size(), startIndex, indices.size(), material);
+		scene->appendInstance(&geometry, 1);
+		setGlassMaterial(0, 1, 1 / 1.5);
+
+		SceneManager::SetupScene();
+	}
+};
+
+/// Statistics of frames of SphereMediumScene traced by CPUPathtracing with a thread and with several threads.
+struct CPUPathtracingCheck {
+	int Pixels;
+	int Frames;
+	// Mean of the image (Accumulation / frames) per channel, and mean over the pixels of the variance of the frames
+	// of a pixel (SqrAccumulation / frames - mean^2), as computed from the statistics saved by SAVE_STATS
+	float Mean[3];
+	float Variance[3];
+	// Standard error of the mean of the image
+	float StandardError[3];
+	// Pixels whose sums differ (any bit) between the tracers with a thread and with threads threads
+	int ThreadMismatches;
+};
+
+inline CPUPathtracingCheck CheckCPUPathtracing(int width = 64, int height = 64, int frames = 48, int threads = 4) {
+	gObj<SceneManager> scene = new SphereMediumScene();
+	scene->SetupScene();
+
+	CPUPathtracing single(width, height), parallel(width, height);
+	single.Threads = 1;
+	parallel.Threads = threads;
+	for (CPUPathtracing* tracer : { &single, &parallel })
+	{
+		tracer->SetSceneManager(scene);
+		tracer->OnLoad();
+		tracer->Render(frames);
+	}
+
+	CPUPathtracingCheck check = {};
+	check.Pixels = width * height;
+	check.Frames = frames;
+	for (int c = 0; c < 3; c++)
+	{
+		double sum = 0, variance = 0;
+		for (int p = 0; p < check.Pixels; p++)
+		{
+			double mean = single.Accumulation[p * 4 + c] / (double)frames;
+			sum += mean;
+			variance += single.SqrAccumulation[p * 4 + c] / (double)frames - mean * mean;
+		}
+		check.Mean[c] = (float)(sum / check.Pixels);
+		check.Variance[c] = (float)(variance / check.Pixels);
+		check.StandardError[c] = (float)sqrt(variance / check.Pixels / ((double)check.Pixels * frames));
+	}
+	for (int p = 0; p < check.Pixels; p++)
+		check.ThreadMismatches +=
+			memcmp(single.Accumulation + p * 4, parallel.Accumulation + p * 4, sizeof(float) * 4) != 0 ||
+			memcmp(single.SqrAccumulation + p * 4, parallel.SqrAccumulation + p * 4, sizeof(float) * 4) != 0 ||
+			single.Complexity[p] != parallel.Complexity[p];
+	return check;
+}
@@ -3,6 +3,9 @@
 #include "dx4xb_scene.h"
 #include "../../gui_traits.h"
 #include "../Tools/Parameters.h"
+#if defined(RANDOMS_LOW_DISCREPANCY) && defined(LOW_DISCREPANCY_BLUE_NOISE)
+#include "../CPU/LowDiscrepancy.h"
+#endif
 
 using namespace dx4xb;
 
@@ -44,6 +47,11 @@ public:
 				binder->ADS(0, Context()->Scene);
 				binder->CBV(0, Context()->Lighting);
 				binder->CBV(1, Context()->ProjectionToWorld);
+
+#if defined(RANDOMS_LOW_DISCREPANCY) && defined(LOW_DISCREPANCY_BLUE_NOISE)
+				binder->Space(3);
+				binder->SRV(0, Context()->BlueNoise);
+#endif
 			}
 
 			void HitGroup_Bindings(gObj<RaytracingBinder> binder) {
@@ -106,6 +114,9 @@ public:
 		gObj<InstanceCollection> Scene;
 		gObj<Buffer> Lighting;
 		gObj<Buffer> ProjectionToWorld;
+
+		// Space 3 (LowDiscrepancy.h)
+		gObj<Buffer> BlueNoise;
 	};
 	gObj<RTXPathtracingPipelineBase> pipeline;
 
@@ -167,6 +178,13 @@ public:
 		pipeline->ProjectionToWorld = CreateBufferCB<float4x4>();
 		pipeline->AccumulativeInfo = {};
 
+#if defined(RANDOMS_LOW_DISCREPANCY) && defined(LOW_DISCREPANCY_BLUE_NOISE)
+		BlueNoiseTile tile;
+		tile.Build();
+		pipeline->BlueNoise = CreateBufferSRV<float>(tile.Count());
+		pipeline->BlueNoise->Write(tile.Values());
+#endif
+
 #ifdef SHOW_COMPLEXITY
 		pipeline->AccumulativeInfo.ShowComplexity = 1;
 		pipeline->AccumulativeInfo.PathtracingRatio = 0.5;
@@ -183,6 +201,9 @@ public:
 	void LoadAssets(gObj<GraphicsManager> manager) {
 		SceneElement elements = scene->Updated(sceneVersion);
 		UpdateBuffers(manager, elements);
+#if defined(RANDOMS_LOW_DISCREPANCY) && defined(LOW_DISCREPANCY_BLUE_NOISE)
+		manager->ToGPU(pipeline->BlueNoise);
+#endif
 	}
 
 	virtual void OnDispatch() override {
@@ -369,6 +390,7 @@ public:
 			//pipeline->AccumulativeInfo.PathtracingRatio = 1;
 			pipeline->AccumulativeInfo.Pass = 0;
 			manager->ClearUAV(pipeline->Accumulation, uint4(0));
+			manager->ClearUAV(pipeline->SqrAccumulation, uint4(0));
 			manager->ClearUAV(pipeline->Complexity, uint4(0));
 		}
 
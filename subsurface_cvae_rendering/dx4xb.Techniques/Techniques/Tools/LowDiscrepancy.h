@@ -0,0 +1,106 @@
+#ifndef LOW_DISCREPANCY_H
+#define LOW_DISCREPANCY_H
+
+// Owen-scrambled Sobol sequences indexed by sample and dimension, the same numbers than LowDiscrepancySampler in
+// CPU/LowDiscrepancy.h. Dimensions are taken in groups of 4 with an own scramble and shuffle of the sample indices.
+// Define LOW_DISCREPANCY_BLUE_NOISE to share the scramble among the pixels and rotate the points of every pixel and dimension
+// with the blue-noise tile (BLUE_NOISE_TILE x BLUE_NOISE_TILE values in space 3) uploaded by PathtracingTechniqueBase.
+// Needs pcg4d of Randoms.h.
+
+#define BLUE_NOISE_TILE 64
+
+// Direction numbers of the first 4 dimensions of the Sobol sequence (Joe and Kuo), bit k of dimension d at [d * 32 + k].
+static const uint SobolDirections[128] = {
+	0x80000000, 0x40000000, 0x20000000, 0x10000000, 0x08000000, 0x04000000, 0x02000000, 0x01000000,
+	0x00800000, 0x00400000, 0x00200000, 0x00100000, 0x00080000, 0x00040000, 0x00020000, 0x00010000,
+	0x00008000, 0x00004000, 0x00002000, 0x00001000, 0x00000800, 0x00000400, 0x00000200, 0x00000100,
+	0x00000080, 0x00000040, 0x00000020, 0x00000010, 0x00000008, 0x00000004, 0x00000002, 0x00000001,
+
+	0x80000000, 0xc0000000, 0xa0000000, 0xf0000000, 0x88000000, 0xcc000000, 0xaa000000, 0xff000000,
+	0x80800000, 0xc0c00000, 0xa0a00000, 0xf0f00000, 0x88880000, 0xcccc0000, 0xaaaa0000, 0xffff0000,
+	0x80008000, 0xc000c000, 0xa000a000, 0xf000f000, 0x88008800, 0xcc00cc00, 0xaa00aa00, 0xff00ff00,
+	0x80808080, 0xc0c0c0c0, 0xa0a0a0a0, 0xf0f0f0f0, 0x88888888, 0xcccccccc, 0xaaaaaaaa, 0xffffffff,
+
+	0x80000000, 0xc0000000, 0x60000000, 0x90000000, 0xe8000000, 0x5c000000, 0x8e000000, 0xc5000000,
+	0x68800000, 0x9cc00000, 0xee600000, 0x55900000, 0x80680000, 0xc09c0000, 0x60ee0000, 0x90550000,
+	0xe8808000, 0x5cc0c000, 0x8e606000, 0xc5909000, 0x6868e800, 0x9c9c5c00, 0xeeee8e00, 0x5555c500,
+	0x8000e880, 0xc0005cc0, 0x60008e60, 0x9000c590, 0xe8006868, 0x5c009c9c, 0x8e00eeee, 0xc5005555,
+
+	0x80000000, 0xc0000000, 0x20000000, 0x50000000, 0xf8000000, 0x74000000, 0xa2000000, 0x93000000,
+	0xd8800000, 0x25400000, 0x59e00000, 0xe6d00000, 0x78080000, 0xb40c0000, 0x82020000, 0xc3050000,
+	0x208f8000, 0x51474000, 0xfbea2000, 0x75d93000, 0xa0858800, 0x914e5400, 0xdbe79e00, 0x25db6d00,
+	0x58800080, 0xe54000c0, 0x79e00020, 0xb6d00050, 0x800800f8, 0xc00c0074, 0x200200a2, 0x50050093
+};
+
+#ifdef LOW_DISCREPANCY_BLUE_NOISE
+StructuredBuffer<float> BlueNoiseTile : register(t0, space3);
+#endif
+
+uint LaineKarrasPermutation(uint x, uint seed) {
+	x += seed;
+	x ^= x * 0x6c50b47cu;
+	x ^= x * 0xb82f1e52u;
+	x ^= x * 0xc7afe638u;
+	x ^= x * 0x8d22f6e6u;
+	return x;
+}
+
+// Owen scramble of base 2 (Burley, Practical Hash-based Owen Scrambling)
+uint NestedUniformScramble(uint x, uint seed) {
+	return reversebits(LaineKarrasPermutation(reversebits(x), seed));
+}
+
+uint HashCombine(uint seed, uint v) {
+	return seed ^ (v + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+}
+
+uint SobolBits(uint index, uint dimension) {
+	uint x = 0;
+	for (uint bit = 0; index != 0; bit++, index >>= 1)
+		if (index & 1)
+			x ^= SobolDirections[dimension * 32 + bit];
+	return x;
+}
+
+uint OwenSobolBits(uint index, uint dimension, uint seed) {
+	uint groupSeed = HashCombine(seed, dimension / 4);
+	uint shuffled = NestedUniformScramble(index, groupSeed);
+	uint x = SobolBits(shuffled, dimension % 4);
+	return NestedUniformScramble(x, HashCombine(groupSeed, 0x5bd1e995u + dimension % 4));
+}
+
+// (pixel.x, pixel.y, seed, next dimension)
+static uint4 ld_state;
+// Sample index (the frame) and scramble of the pixel
+static uint ld_index;
+static uint ld_pixelSeed;
+
+void StartLowDiscrepancy(uint2 pixel, uint seed, uint sampleIndex) {
+	ld_state = uint4(pixel, seed, 0);
+	ld_index = sampleIndex;
+	ld_pixelSeed = pcg4d(uint4(pixel, seed, 0x2c1b3c6du)).x;
+}
+
+uint LowDiscrepancyBits(uint dimension) {
+#ifdef LOW_DISCREPANCY_BLUE_NOISE
+	uint h = LaineKarrasPermutation(HashCombine(ld_state.z, dimension), 0x68e31da4u);
+	uint2 p = (ld_state.xy + uint2(h & 0xffff, h >> 16)) & (BLUE_NOISE_TILE - 1);
+	float rotation = BlueNoiseTile[p.y * BLUE_NOISE_TILE + p.x];
+	return OwenSobolBits(ld_index, dimension, ld_state.z) + (uint)(rotation * 4294967296.0);
+#else
+	return OwenSobolBits(ld_index, dimension, ld_pixelSeed);
+#endif
+}
+
+// Uniform in [0, 1) of the next dimension of the sample.
+float ldrandom() {
+	uint bits = LowDiscrepancyBits(ld_state.w);
+	ld_state.w++;
+	return (bits >> 8) * (1.0 / 16777216.0);
+}
+
+void SkipLowDiscrepancy(uint count) {
+	ld_state.w += count;
+}
+
+#endif
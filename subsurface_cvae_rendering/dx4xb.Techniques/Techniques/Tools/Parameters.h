@@ -6,9 +6,22 @@
 
 #define USE_CVAE_X
 
+// Evaluate the CVAE networks from the model file CVAE_MODEL_FILE uploaded to a buffer instead of the baked ones.
+// The file is watched and the networks are replaced while running.
+//#define USE_CVAE_MODEL_BUFFER
+#define CVAE_MODEL_FILE "cvae_model.bin"
+
 // Use skybox to show fancy scenes
 #define USE_SKYBOX
 
+// Use the min-pyramid of distance fields to get larger safe radii in empty regions
+#define USE_DF_PYRAMID
+
+// Draw the random numbers of the rays from Owen-scrambled Sobol sequences (Tools/LowDiscrepancy.h), and with blue-noise
+// rotations of the pixels (a tile built on load in space 3)
+//#define RANDOMS_LOW_DISCREPANCY
+//#define LOW_DISCREPANCY_BLUE_NOISE
+
 // Max number of outside bounces allowed in a Pathtracer
 #define MAX_PATHTRACING_BOUNCES 5
 
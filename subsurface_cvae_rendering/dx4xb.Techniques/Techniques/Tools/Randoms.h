@@ -1,6 +1,16 @@
 #ifndef RANDOMS_H
 #define RANDOMS_H
 
+// Random numbers of a ray are counter-based by default: the n-th number of the stream of (pixel, bounce, frame) is
+// a lane of pcg4d(pixel.x, pixel.y, frame * maxBounces + bounce, n / 4) (Jarzynski and Olano, Hash Functions for GPU Rendering).
+// Streams start without warm-up and jump ahead in constant time (SkipRandoms).
+// Define RANDOMS_HYBRID_TAUS to use the HybridTaus generator seeded with the index of the ray and warmed up.
+// CPU versions of both generators in CPU/CounterRandom.h.
+// Define RANDOMS_LOW_DISCREPANCY (Parameters.h) to draw the numbers of a ray as the dimensions of the sample NumberOfPasses
+// of an Owen-scrambled Sobol sequence of the pixel (LowDiscrepancy.h).
+
+#ifdef RANDOMS_HYBRID_TAUS
+
 static uint4 rng_state;
 
 uint TausStep(uint z, int S1, int S2, int S3, uint M)
@@ -44,14 +54,108 @@ void StartRandomSeedForRay(uint2 gridDimensions, int maxBounces, uint2 raysIndex
 		random();
 }
 
+void SkipRandoms(uint count) {
+	for (uint i = 0; i < count; i++)
+		random();
+}
+
+uint4 getRNG() {
+	return rng_state;
+}
+
+void setRNG(uint4 state) {
+	rng_state = state;
+}
+
+#else
+
+uint4 pcg4d(uint4 v)
+{
+	v = v * 1664525u + 1013904223u;
+	v.x += v.y * v.w;
+	v.y += v.z * v.x;
+	v.z += v.x * v.y;
+	v.w += v.y * v.z;
+	v ^= v >> 16u;
+	v.x += v.y * v.w;
+	v.y += v.z * v.x;
+	v.z += v.x * v.y;
+	v.w += v.y * v.z;
+	return v;
+}
+
+#ifdef RANDOMS_LOW_DISCREPANCY
+
+#include "LowDiscrepancy.h"
+
+float random() {
+	return ldrandom();
+}
+
+// The bounce selects the scramble, the frame is the index of the sample.
+void StartRandomSeedForRay(uint2 gridDimensions, int maxBounces, uint2 raysIndex, int bounce, int frame) {
+	StartLowDiscrepancy(raysIndex, bounce, frame);
+}
+
+void SkipRandoms(uint count) {
+	SkipLowDiscrepancy(count);
+}
+
+// The index of the sample is not part of the state, it is the same for all rays of a frame.
+uint4 getRNG() {
+	return ld_state;
+}
+
+void setRNG(uint4 state) {
+	ld_state = state;
+}
+
+#else
+
+// (pixel.x, pixel.y, frame * maxBounces + bounce, index of the next number)
+static uint4 rng_state;
+// Numbers of the block of the next number
+static uint4 rng_block;
+
+void LoadRandomBlock() {
+	rng_block = pcg4d(uint4(rng_state.xyz, rng_state.w >> 2));
+}
+
+float random() {
+	uint lane = rng_state.w & 3;
+	if (lane == 0)
+		LoadRandomBlock();
+	uint bits = lane == 0 ? rng_block.x : lane == 1 ? rng_block.y : lane == 2 ? rng_block.z : rng_block.w;
+	rng_state.w++;
+	return (bits >> 8) * (1.0 / 16777216.0);
+}
+
+// gridDimensions is not needed by the counter-based streams, kept for the HybridTaus seeding.
+void StartRandomSeedForRay(uint2 gridDimensions, int maxBounces, uint2 raysIndex, int bounce, int frame) {
+	rng_state = uint4(raysIndex, frame * maxBounces + bounce, 0);
+}
+
+// Jumps over the next count numbers of the stream.
+void SkipRandoms(uint count) {
+	rng_state.w += count;
+	if ((rng_state.w & 3) != 0)
+		LoadRandomBlock();
+}
+
 uint4 getRNG() {
 	return rng_state;
 }
 
 void setRNG(uint4 state) {
 	rng_state = state;
+	if ((rng_state.w & 3) != 0)
+		LoadRandomBlock();
 }
 
+#endif
+
+#endif
+
 float3 randomHSDirection(float3 N, out float NdotD)
 {
 	float r1 = random();
@@ -1,18 +1,33 @@
 #pragma once
 
 #include "dx4xb_scene.h"
+#include "scene_traits.h"
 
 using namespace dx4xb;
 
-struct IManageScene {
-	gObj<SceneManager> scene = nullptr;
-	SceneVersion sceneVersion;
-	virtual void SetSceneManager(gObj<SceneManager> scene) {
-		this->scene = scene;
-	}
+struct IGatherImageStatistics {
+	virtual void getAccumulators(gObj<Texture2D>& sum, gObj<Texture2D>& sqrSum, int& frames) = 0;
 };
 
+struct DistanceFieldSelection {
+	// Number of triangles of the geometry.
+	int Triangles;
+	// Grid resolution selected.
+	int3 Size = int3(0, 0, 0);
+	// Size of a cell in world space (largest instance).
+	float CellSize;
+	// Memory used by the field in bytes.
+	long long Memory;
+	// Determines if the field was loaded from the cache.
+	bool FromCache;
+	// Rays used to measure sphere tracing steps (0 if not measured).
+	int MeasuredRays = 0;
+	// Average sphere tracing steps using only the distance field.
+	float FlatSteps = 0;
+	// Average sphere tracing steps using the min-pyramid.
+	float PyramidSteps = 0;
+};
 
-struct IGatherImageStatistics {
-	virtual void getAccumulators(gObj<Texture2D>& sum, gObj<Texture2D>& sqrSum, int& frames) = 0;
-};
\ No newline at end of file
+struct IReportDistanceFields {
+	virtual void getDistanceFields(DistanceFieldSelection*& selections, int& count) = 0;
+};
@@ -0,0 +1,131 @@
+#ifndef DX4XB_PLATFORM_H
+#define DX4XB_PLATFORM_H
+
+// Windows and CRT names used by dx4xb and the CPU techniques. On Windows they come from the SDK and the CRT,
+// elsewhere they are defined here with the C++ standard library, so the CPU code builds headless (CMakeLists.txt).
+
+#ifdef _WIN32
+
+#include <Windows.h>
+
+#else
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <type_traits>
+#include <pthread.h>
+
+typedef long HRESULT;
+#define S_OK ((HRESULT)0)
+#define FAILED(hr) (((HRESULT)(hr)) < 0)
+typedef unsigned char byte;
+typedef int errno_t;
+typedef int BOOL;
+typedef unsigned int DWORD;
+typedef long LONG;
+typedef long long LONG64;
+
+#define MAX_PATH 260
+
+// Clears the bytes of any object, as RtlZeroMemory does (dx4xb clears descriptions holding non-trivial members)
+inline void ZeroMemory(void* destination, size_t length) { memset(destination, 0, length); }
+
+// min and max are macros in Windows.h, operands of different types are compared in their common type
+template<typename A, typename B>
+inline typename std::common_type<A, B>::type min(A a, B b) {
+	typedef typename std::common_type<A, B>::type C;
+	return (C)a < (C)b ? (C)a : (C)b;
+}
+template<typename A, typename B>
+inline typename std::common_type<A, B>::type max(A a, B b) {
+	typedef typename std::common_type<A, B>::type C;
+	return (C)a > (C)b ? (C)a : (C)b;
+}
+
+inline long InterlockedAdd(volatile long* addend, long value) {
+	return __atomic_add_fetch(addend, value, __ATOMIC_SEQ_CST);
+}
+inline long InterlockedExchange(volatile long* target, long value) {
+	return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST);
+}
+// Returns the initial value, as InterlockedExchangeAdd64
+inline long long InterlockedExchangeAdd64(volatile long long* addend, long long value) {
+	return __atomic_fetch_add(addend, value, __ATOMIC_SEQ_CST);
+}
+
+// Slim reader/writer locks as pthread read-write locks
+typedef pthread_rwlock_t SRWLOCK;
+#define SRWLOCK_INIT PTHREAD_RWLOCK_INITIALIZER
+inline void AcquireSRWLockExclusive(SRWLOCK* lock) { pthread_rwlock_wrlock(lock); }
+inline void ReleaseSRWLockExclusive(SRWLOCK* lock) { pthread_rwlock_unlock(lock); }
+inline void AcquireSRWLockShared(SRWLOCK* lock) { pthread_rwlock_rdlock(lock); }
+inline void ReleaseSRWLockShared(SRWLOCK* lock) { pthread_rwlock_unlock(lock); }
+
+#define MOVEFILE_REPLACE_EXISTING 1
+// rename replaces an existing file
+inline BOOL MoveFileExA(const char* existingFileName, const char* newFileName, DWORD /*flags*/) {
+	return rename(existingFileName, newFileName) == 0;
+}
+inline BOOL DeleteFileA(const char* fileName) {
+	return remove(fileName) == 0;
+}
+
+inline errno_t fopen_s(FILE** file, const char* fileName, const char* mode) {
+	*file = fopen(fileName, mode);
+	return *file ? 0 : errno;
+}
+
+inline size_t fread_s(void* buffer, size_t bufferSize, size_t elementSize, size_t count, FILE* stream) {
+	if (elementSize == 0 || count > bufferSize / elementSize)
+		return 0;
+	return fread(buffer, elementSize, count, stream);
+}
+
+inline errno_t strcpy_s(char* destination, size_t size, const char* source) {
+	size_t length = strlen(source);
+	if (length >= size)
+	{
+		if (size > 0)
+			destination[0] = 0;
+		return ERANGE;
+	}
+	memcpy(destination, source, length + 1);
+	return 0;
+}
+
+template<size_t N>
+inline errno_t strcpy_s(char(&destination)[N], const char* source) {
+	return strcpy_s(destination, N, source);
+}
+
+#define _TRUNCATE ((size_t)-1)
+// Only the truncating copy is used
+template<size_t N>
+inline errno_t strncpy_s(char(&destination)[N], const char* source, size_t count) {
+	size_t length = strnlen(source, min(count, N - 1));
+	memcpy(destination, source, length);
+	destination[length] = 0;
+	return 0;
+}
+
+template<size_t N>
+inline errno_t strcat_s(char(&destination)[N], const char* source) {
+	size_t length = strnlen(destination, N);
+	return length == N ? EINVAL : strcpy_s(destination + length, N - length, source);
+}
+
+template<size_t N, typename... Arguments>
+inline int sprintf_s(char(&buffer)[N], const char* format, Arguments... arguments) {
+	return snprintf(buffer, N, format, arguments...);
+}
+
+// Only numbers are scanned, sscanf_s has the same arguments than sscanf for them
+#define sscanf_s sscanf
+
+#define _fseeki64 fseeko
+#define _ftelli64 ftello
+
+#endif
+
+#endif
@@ -1,4 +1,4 @@
-#include "dx4xb_scene.h"
+#include "dx4xb_scene_types.h"
 
 namespace dx4xb {
 
@@ -12,8 +12,7 @@ namespace dx4xb {
 	public:
 		Tokenizer(FILE* stream) {
 			fseek(stream, 0, SEEK_END);
-			fpos_t count;
-			fgetpos(stream, &count);
+			long long count = _ftelli64(stream);
 			fseek(stream, 0, SEEK_SET);
 			buffer = new char[count];
 			size_t offset = 0;
@@ -617,8 +616,9 @@ namespace dx4xb {
 
 			string full(filePath);
 
-			string subDir = full.substr(0, full.find_last_of("\\") + 1);
-			string name = full.substr(full.find_last_of("\\") + 1);
+			int separator = max(full.find_last_of("\\"), full.find_last_of("/"));
+			string subDir = full.substr(0, separator + 1);
+			string name = full.substr(separator + 1);
 
 			FILE* stream;
 
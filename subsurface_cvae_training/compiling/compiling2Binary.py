@@ -0,0 +1,76 @@
+import os
+import struct
+from torch import nn
+
+from compiling.compiling2HLSL import flattenLayers
+
+# Model files read by CVAEModels::Load (dx4xb.Techniques/Techniques/CPU/MLP.h and CVAEPathtracing/CVAEModels.h).
+# A header (magic, version, words) followed by an image of 32-bit words, integers are stored with the bits of a float.
+MODEL_FILE_VERSION = 1
+CVAE_FILE_MAGIC = 0x45415643 # "CVAE"
+
+# same values than MLPActivation
+ACTIVATIONS = {
+    nn.Softplus: 1,
+    nn.Sigmoid: 2,
+    nn.Tanh: 3,
+    nn.ReLU: 4
+}
+
+def intWord(value):
+    return struct.unpack('<f', struct.pack('<i', value))[0]
+
+def getLayers(model):
+    '''
+    Gets the dense layers of a model as (weights, bias, activation) with weights as [inputs][outputs].
+    '''
+    layers = []
+    for l in flattenLayers(model):
+        if isinstance(l, nn.Linear):
+            layers.append([l.weight.detach().numpy().T, l.bias.detach().numpy(), 0])
+        elif l is not None:
+            if layers[-1][2] != 0 or not type(l) in ACTIVATIONS:
+                raise Exception('Only a supported activation per layer can be compiled')
+            layers[-1][2] = ACTIVATIONS[type(l)]
+    return layers
+
+def compileMLPImage(model):
+    '''
+    Image of a network: [layers, inputs, outputs], for each layer [inputs, outputs, activation, weights offset, bias offset],
+    input scale and offset, output scale and offset (identity) and the weights and bias of every layer.
+    '''
+    layers = getLayers(model)
+    inputs = layers[0][0].shape[0]
+    outputs = layers[-1][0].shape[1]
+    image = [intWord(len(layers)), intWord(inputs), intWord(outputs)]
+    offset = 3 + 5 * len(layers) + 2 * inputs + 2 * outputs
+    parameters = []
+    for W, b, activation in layers:
+        image += [intWord(W.shape[0]), intWord(W.shape[1]), intWord(activation), intWord(offset), intWord(offset + W.size)]
+        parameters += [float(v) for v in W.flatten()] + [float(v) for v in b]
+        offset += W.size + b.size
+    image += [1.0] * inputs + [0.0] * inputs + [1.0] * outputs + [0.0] * outputs
+    return image + parameters
+
+def compileModelToBinary(models):
+    '''
+    Compiles the lenModel, pathModel and (optional) scatModel networks to the content of a model file.
+    '''
+    images = [compileMLPImage(models[name]) for name in ['lenModel', 'pathModel', 'scatModel'] if name in models]
+    offsets = [4]
+    for image in images[:-1]:
+        offsets.append(offsets[-1] + len(image))
+    offsets += [0] * (3 - len(images))
+    words = [intWord(len(images))] + [intWord(o) for o in offsets]
+    for image in images:
+        words += image
+    return struct.pack('<Iii', CVAE_FILE_MAGIC, MODEL_FILE_VERSION, len(words)) + struct.pack('<%df' % len(words), *words)
+
+def writeModelFile(fileName, data):
+    '''
+    Writes the file aside and renames it, a running renderer never reads a partial file.
+    '''
+    file = open(fileName + '.tmp', 'wb')
+    file.write(data)
+    file.close()
+    os.replace(fileName + '.tmp', fileName)
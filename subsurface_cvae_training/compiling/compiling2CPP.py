@@ -0,0 +1,26 @@
+from compiling.compiling2Binary import getLayers
+
+# Networks compiled as StaticMLP types (dx4xb.Techniques/Techniques/CPU/StaticMLP.h),
+# the sizes and activations are template parameters and the weights a constexpr array.
+
+# same names than MLPActivation
+ACTIVATION_NAMES = ['None', 'Softplus', 'Sigmoid', 'Tanh', 'ReLU']
+
+def compileModelToCPP(models):
+    code = ""
+    for modelName, model in models.items():
+        layers = getLayers(model)
+        parameters = []
+        for W, b, activation in layers:
+            parameters += [float(v) for v in W.flatten()] + [float(v) for v in b]
+
+        code += "constexpr float "+modelName+"Parameters[] = {"
+        for i in range(0, len(parameters), 8):
+            code += ("\n\t" if i == 0 else ",\n\t") + ', '.join(['%#.9gf' % v for v in parameters[i:i+8]])
+        code += " };\n"
+
+        code += "typedef StaticMLP<"+modelName+"Parameters, "+str(layers[0][0].shape[0])
+        for W, b, activation in layers:
+            code += ",\n\tStaticLayer<"+str(W.shape[1])+", MLPActivation::"+ACTIVATION_NAMES[activation]+">"
+        code += "> "+modelName+"Static;\n\n"
+    return code
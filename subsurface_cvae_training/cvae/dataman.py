@@ -4,6 +4,8 @@ from torch.nn import functional as F
 from torch import Tensor
 import numpy as np
 
+from cvae import scatterds
+
 
 class DataManager:
     '''
@@ -13,12 +15,12 @@ class DataManager:
     def __init__(self, path, conditions, targets, data_count = None):
         '''
         Constructor.
-        path: path to the dataset file
+        path: path to the dataset file, a .npz file or a scatter dataset file (.sds) mapped in memory
         conditions: dictionary with the name of the tensor for the conditions and the mapping function. 
         targets: dictionary with the name of the tensor for the targets and the mapping function.
         Maps function must be None if no map is needed.
         '''
-        data = np.load(path)
+        data = scatterds.load(path) if path.endswith('.sds') else np.load(path)
         def get_data_and_map (dataID, map): return data[dataID].astype(np.float32) if map is None else map(data[dataID].astype(np.float32))
         # Build the conditional part and the target part
         self.conditions = torch.tensor(np.array([get_data_and_map(d, map) for d, map in conditions.items()]).T, dtype=torch.float)
@@ -0,0 +1,47 @@
+import os
+import struct
+import numpy as np
+
+# Scatter dataset files (.sds) read and written by ScatterDataset and ScatterDatasetWriter
+# (dx4xb.Techniques/Techniques/CVAEPathtracing/ScatterDataset.h).
+# A header (magic, version, columns, data offset, rows, stride) followed by the columns as little-endian float32 arrays
+# of stride values, the first rows values of every column are valid.
+SCATTER_DATASET_MAGIC = b'SCDS'
+SCATTER_DATASET_FILE_VERSION = 1
+SCATTER_DATASET_DATA_OFFSET = 64
+SCATTER_DATASET_ROW_ALIGNMENT = 16
+
+# Names of the columns, same as the arrays of the .npz files
+COLUMNS = [
+    'sigma', 'g', 'albedo', 'n', 'z', 'tangent_beta', 'tangent_alpha',
+    'representative_Xx', 'representative_Xy', 'representative_Xz',
+    'representative_Wx', 'representative_Wy', 'representative_Wz'
+]
+
+def load(path):
+    '''
+    Maps a scatter dataset file. Returns a dictionary from the column names to read-only arrays,
+    values are read from the file when accessed.
+    '''
+    with open(path, 'rb') as file:
+        magic, version, columns, offset, rows, stride = struct.unpack('<4sIIIQQ', file.read(32))
+    if magic != SCATTER_DATASET_MAGIC or version != SCATTER_DATASET_FILE_VERSION or columns != len(COLUMNS):
+        raise Exception('Not a valid scatter dataset file: ' + path)
+    data = np.memmap(path, dtype='<f4', mode='r', offset=offset, shape=(columns, stride))
+    return {name: data[c, :rows] for c, name in enumerate(COLUMNS)}
+
+def save(path, data):
+    '''
+    Writes a scatter dataset file with the arrays of data (a dictionary or a .npz file with all the columns).
+    The file is written aside and renamed.
+    '''
+    rows = len(data[COLUMNS[0]])
+    stride = (rows + SCATTER_DATASET_ROW_ALIGNMENT - 1) // SCATTER_DATASET_ROW_ALIGNMENT * SCATTER_DATASET_ROW_ALIGNMENT
+    header = struct.pack('<4sIIIQQ', SCATTER_DATASET_MAGIC, SCATTER_DATASET_FILE_VERSION, len(COLUMNS), SCATTER_DATASET_DATA_OFFSET, rows, stride)
+    with open(path + '.tmp', 'wb') as file:
+        file.write(header.ljust(SCATTER_DATASET_DATA_OFFSET, b'\0'))
+        padding = np.zeros(stride - rows, dtype='<f4')
+        for name in COLUMNS:
+            file.write(np.ascontiguousarray(data[name], dtype='<f4').tobytes())
+            file.write(padding.tobytes())
+    os.replace(path + '.tmp', path)
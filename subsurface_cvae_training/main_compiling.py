@@ -13,6 +13,8 @@ import cvae.training
 import hashlib
 
 import compiling.compiling2HLSL
+import compiling.compiling2Binary
+import compiling.compiling2CPP
 
 folder = '.\\Running'
 
@@ -73,12 +75,26 @@ scatGenModel = cvae.training.get_last_state(
     top_state=None
 )
 
-code = compiling.compiling2HLSL.compileModelToHLSL({
+models = {
     'lenModel' : lenGenModel.model.cpu().decoder.model.model,
     'pathModel' : pathGenModel.model.cpu().decoder.model.model,
     'scatModel' : scatGenModel.model.cpu().decoder.model.model
-})
+}
+
+code = compiling.compiling2HLSL.compileModelToHLSL(models)
 
 file = open('compiledModels.h','w+')
 file.write(code)
-file.close()
\ No newline at end of file
+file.close()
+
+# Same networks as StaticMLP types for the CPU (e.g. CVAEScatteringModelXStatic.h)
+file = open('compiledModelsStatic.h','w+')
+file.write(compiling.compiling2CPP.compileModelToCPP(models))
+file.close()
+
+# Model file loaded by the renderer with USE_CVAE_MODEL_BUFFER (see CVAE_MODEL_FILE in Tools/Parameters.h), reloaded while running
+modelFile = compiling.compiling2Binary.compileModelToBinary(models)
+compiling.compiling2Binary.writeModelFile('cvae_model.bin', modelFile)
+# Same file shipped with the baked shader (e.g. CVAEScatteringModelX.bin next to CVAEScatteringModelX.h),
+# the weights used by the CPU runtime and checked against compiledModels.h
+compiling.compiling2Binary.writeModelFile('compiledModels.bin', modelFile)
@@ -3,14 +3,18 @@
 '''
 # Converting Data
 
-This notebook converts the data from a csv format in the .ds files to the npz format in numpy.
+This notebook converts the data from a csv format in the .ds files to the npz format in numpy
+and to the binary scatter dataset format (.sds) mapped by DataManager.
+ConvertScatterDatasetCSV (ScatterDataset.h) does the same .ds to .sds conversion with all the cores.
 '''
 # %%
 import numpy as np
 
+from cvae import scatterds
+
 def convertFile(folderName, name):
     '''
-    Takes the file <name>.ds and convert into the file <name>.npz
+    Takes the file <name>.ds and convert into the files <name>.npz and <name>.sds
     '''
     print('[INFO] Reading file: '+name+'.ds')
     file = open(folderName+'\\'+name+'.ds', 'r')
@@ -55,6 +59,9 @@ def convertFile(folderName, name):
         representative_Wy = data[:, 11],
         representative_Wz = data[:, 12]
     )
+
+    print('[INFO] Storing data in *.sds format.')
+    scatterds.save(folderName+'\\'+name+'.sds', {c: data[:, i] for i, c in enumerate(scatterds.COLUMNS)})
 # %% [markdown]
 '''
 Choosing the files to convert...
@@ -25,7 +25,7 @@ The value of n (number of scatters) is scaled to logarithm.
 '''
 # %%
 # Loading the data set for training the LenGen model
-lenGen_ds = DataManager('.\\DataSets\\ScattersDataSet.npz', 
+lenGen_ds = DataManager('.\\DataSets\\ScattersDataSet.sds', 
             conditions = {
                 'sigma' : None,
                 'g'     : None
@@ -25,7 +25,7 @@ value of n (number of scatters log scale) as conditioning. Result z, and tangent
 '''
 # %%
 # Loading the data set for training the LenGen model
-pathGen_ds = DataManager('.\\DataSets\\ScattersDataSet.npz', 
+pathGen_ds = DataManager('.\\DataSets\\ScattersDataSet.sds', 
             conditions = {
                 'sigma' : None,
                 'g'     : None,
@@ -26,7 +26,7 @@ Loading the data set.
 # %%
 
 # Loading the data set for training the LenGen model
-scatGen_ds = DataManager('.\\DataSets\\ScattersDataSet.npz', 
+scatGen_ds = DataManager('.\\DataSets\\ScattersDataSet.sds', 
             conditions = {
                 'sigma'         : None,
                 'g'             : None,
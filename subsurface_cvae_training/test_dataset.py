@@ -13,7 +13,7 @@ import matplotlib.pyplot as plt
 
 # %%
 
-dataset = DataManager('.\\DataSets\\ScattersDataSet.npz',
+dataset = DataManager('.\\DataSets\\ScattersDataSet.sds',
     conditions={
         'sigma' : None,
         'g' : None